@@ -24,7 +24,9 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
-
+ @ Oct 17, 2026 - agent
+   Count the cross section evaluations and accepted events of the rejection
+   method (see KineGeneratorWithCache::PrintSamplingStats()).
 */
 //____________________________________________________________________________
 
@@ -157,6 +159,7 @@ void COHKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      // computing cross section for the current kinematics
      xsec = fXSecModel->XSec(interaction, kPSxyfE);
+     fNKineTrials++;
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -176,6 +179,7 @@ void COHKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        fNKineEvents++;
         LOG("COHKinematics", pNOTICE) << "Selected: x = "<< gx << ", y = "<< gy;
 
         // the COH cross section should be a triple differential cross section
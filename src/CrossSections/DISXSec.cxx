@@ -25,7 +25,9 @@
  @ Jan 29, 2013 - CA
    Don't look-up depreciated $GDISABLECACHING environmental variable.
    Use the RunOpt singleton instead.
-
+ @ Oct 17, 2026 - agent
+   Access the free nucleon cache branches through integer handles, memoized
+   by Interaction::Key().
 */
 //____________________________________________________________________________
 
@@ -129,14 +131,13 @@ double DISXSec::Integrate(
   if(precalc_bare_xsec) {
      Cache * cache = Cache::Instance();
      Interaction * interaction = new Interaction(*in);
-     string key = this->CacheBranchName(model,interaction);
-     LOG("DISXSec", pINFO) << "Finding cache branch with key: " << key;
+     int handle = this->CacheBranchHandle(model,interaction);
      CacheBranchFx * cache_branch =
-           dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+           dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
      if(!cache_branch) {
          this->CacheFreeNucleonXSec(model,interaction);
          cache_branch =
-           dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+           dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
          assert(cache_branch);
      }
      const CacheBranchFx & cb = (*cache_branch);
@@ -246,12 +247,12 @@ void DISXSec::CacheFreeNucleonXSec(
 
   // Create the cache branch
   Cache * cache = Cache::Instance();
-  string key = this->CacheBranchName(model,interaction);
+  int handle = this->CacheBranchHandle(model,interaction);
   CacheBranchFx * cache_branch =
-           dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+           dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
   assert(!cache_branch);
   cache_branch = new CacheBranchFx("DIS XSec");
-  cache->AddCacheBranch(key, cache_branch);
+  cache->AddCacheBranch(handle, cache_branch);
 
   // Tweak interaction to be on a free nucleon target
   Target * target = interaction->InitStatePtr()->TgtPtr();
@@ -353,10 +354,29 @@ string DISXSec::CacheBranchName(
 
   Cache * cache = Cache::Instance();
       
-  string algkey = model->Id().Key();
   string ikey   = interaction->AsString();  
-  string key    = cache->CacheBranchKey(algkey, ikey);
+  string key    = cache->CacheBranchKey(model, ikey);
   return key;
 }
 //____________________________________________________________________________
+int DISXSec::CacheBranchHandle(
+          const XSecAlgorithmI * model, const Interaction * interaction) const
+{
+// Get the cache branch handle. The cache branch name is only built the first
+// time the model / interaction pair is seen.
+
+  pair<const XSecAlgorithmI *, ULong64_t> hkey(model, interaction->Key());
+
+  map<pair<const XSecAlgorithmI *, ULong64_t>, int>::const_iterator 
+                                        iter = fCacheHandles.find(hkey);
+  if(iter != fCacheHandles.end()) return iter->second;
+
+  string key = this->CacheBranchName(model, interaction);
+  LOG("DISXSec", pINFO) << "Cache branch key: " << key;
+  int handle = Cache::Instance()->CacheBranchHandle(key);
+  fCacheHandles[hkey] = handle;
+
+  return handle;
+}
+//____________________________________________________________________________
 
@@ -20,8 +20,13 @@
 #ifndef _DIS_XSEC_H_
 #define _DIS_XSEC_H_
 
+#include <map>
+
 #include "Base/XSecIntegratorI.h"
 
+using std::map;
+using std::pair;
+
 namespace genie {
 
 class DISXSec : public XSecIntegratorI {
@@ -44,9 +49,12 @@ private:
 
   void   CacheFreeNucleonXSec(const XSecAlgorithmI * model, const Interaction * in) const;
   string CacheBranchName     (const XSecAlgorithmI * model, const Interaction * in) const;
+  int    CacheBranchHandle   (const XSecAlgorithmI * model, const Interaction * in) const;
 
   double fVldEmin;
   double fVldEmax;
+
+  mutable map<pair<const XSecAlgorithmI *, ULong64_t>, int> fCacheHandles; ///< (model, interaction code) -> cache branch handle
 };
 
 }       // genie namespace
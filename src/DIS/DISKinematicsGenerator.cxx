@@ -15,12 +15,17 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 17, 2026 - agent
+   Optionally generate the (x,y) candidates from an adaptive, piecewise
+   constant envelope built per interaction and energy bin (KineEnvelope2D)
+   rather than uniformly. Count the xsec evaluations and accepted events.
 */
 //____________________________________________________________________________
 
 #include <cfloat>
 
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Base/XSecAlgorithmI.h"
 #include "Conventions/GBuild.h"
@@ -31,6 +36,7 @@
 #include "EVGCore/EVGThreadException.h"
 #include "EVGCore/EventGeneratorI.h"
 #include "EVGCore/RunningThreadInfo.h"
+#include "EVGModules/KineEnvelope2D.h"
 #include "GHEP/GHepRecord.h"
 #include "GHEP/GHepFlags.h"
 #include "Messenger/Messenger.h"
@@ -58,7 +64,7 @@ KineGeneratorWithCache("genie::DISKinematicsGenerator", config)
 //___________________________________________________________________________
 DISKinematicsGenerator::~DISKinematicsGenerator()
 {
-
+  this->DeleteEnvelopes();
 }
 //___________________________________________________________________________
 void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
@@ -111,7 +117,12 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   If the candidates are generated from the adaptive envelope the 
+  //   envelope cell bounds are used instead.
+  KineEnvelope2D * envelope = 
+     (fUseEnvelope && !fGenerateUniformly) ? this->Envelope(interaction) : 0;
+  double xsec_max = 
+     (fGenerateUniformly || envelope) ? -1 : this->MaxXSec(evrec);
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
@@ -133,9 +144,17 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        throw exception;
      }
 
-     //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
+     //-- random x,y (uniformly, or from the envelope)
+     unsigned int icell = 0;
+     if(envelope) {
+        double u = 0, v = 0;
+        icell = envelope->Generate(u,v);
+        gx = xl.min + dx * u;
+        gy = yl.min + dy * v;
+     } else {
+        gx = xl.min + dx * rnd->RndKine().Rndm();
+        gy = yl.min + dy * rnd->RndKine().Rndm();
+     }
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
      kinematics::UpdateWQ2FromXY(interaction);
@@ -147,11 +166,27 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- compute the cross section for current kinematics
      xsec = fXSecModel->XSec(interaction, kPSxyfE);
+     fNKineTrials++;
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
-        double t = xsec_max * rnd->RndKine().Rndm();
+        double max = xsec_max;
+        if(envelope) {
+          // if the cell bound is exceeded, the candidate can not be accepted
+          // against it: raise the cell bound and reject the candidate
+          max = envelope->CellMax(icell);
+          if(xsec > max) {
+             this->AssertXSecLimits(interaction, xsec, max);
+             LOG("DISKinematics", pINFO) 
+               << "xsec = " << xsec << " > envelope = " << max 
+               << " - Raising the envelope & rejecting the candidate";
+             envelope->Raise(icell, fSafetyFactor * xsec);
+             continue;
+          }
+        } else {
+          this->AssertXSecLimits(interaction, xsec, xsec_max);
+        }
+        double t = max * rnd->RndKine().Rndm();
 	double J = 1;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -166,6 +201,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+         fNKineEvents++;
          LOG("DISKinematics", pNOTICE) 
             << "Selected:  x = " << gx << ", y = " << gy
             << " (W  = " << interaction->KinePtr()->W()  << ","
@@ -242,6 +278,18 @@ void DISKinematicsGenerator::LoadConfig(void)
   //-- Generate kinematics uniformly over allowed phase space and compute
   //   an event weight?
   fGenerateUniformly = fConfig->GetBoolDef("UniformOverPhaseSpace", false);
+
+  //-- Generate (x,y) from an adaptive, piecewise-constant envelope?
+  //   Number of envelope cells in x and y, number of envelopes per energy 
+  //   decade and minimum cell bound (fraction of the largest cell bound)
+  fUseEnvelope        = fConfig->GetBoolDef   ("UseAdaptiveEnvelope",     false);
+  fEnvNx              = fConfig->GetIntDef    ("Envelope-NCellsX",           20);
+  fEnvNy              = fConfig->GetIntDef    ("Envelope-NCellsY",           10);
+  fEnvNBinsPerDecade  = fConfig->GetIntDef    ("Envelope-NBinsPerDecade",    10);
+  fEnvMinCellFraction = fConfig->GetDoubleDef ("Envelope-MinCellFraction", 0.02);
+  assert(fEnvNx>0 && fEnvNy>0 && fEnvNBinsPerDecade>0);
+
+  this->DeleteEnvelopes();
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -385,3 +433,109 @@ double DISKinematicsGenerator::ComputeMaxXSec(
 }
 //___________________________________________________________________________
 
+KineEnvelope2D * DISKinematicsGenerator::Envelope(
+                                       const Interaction * interaction) const
+{
+// Returns the envelope for the input interaction at its energy bin, building
+// it the first time the bin is visited. Returns 0 if no envelope can be built
+// (the standard rejection method is used instead).
+
+  double E = this->Energy(interaction);
+  if(E <= 0) return 0;
+
+  int ebin = TMath::FloorNint(TMath::Log10(E) * fEnvNBinsPerDecade);
+  pair<ULong64_t,int> key(interaction->Key(), ebin);
+
+  map<pair<ULong64_t,int>, KineEnvelope2D *>::const_iterator 
+                                           iter = fEnvelopes.find(key);
+  if(iter != fEnvelopes.end()) return iter->second;
+
+  // build it at the upper edge of the energy bin (the xsec rises with E)
+  double Eup = TMath::Power(10., double(ebin+1)/fEnvNBinsPerDecade);
+  KineEnvelope2D * envelope = this->BuildEnvelope(interaction, Eup/E);
+  fEnvelopes.insert(
+    map<pair<ULong64_t,int>, KineEnvelope2D *>::value_type(key, envelope));
+
+  return envelope;
+}
+//___________________________________________________________________________
+KineEnvelope2D * DISKinematicsGenerator::BuildEnvelope(
+                          const Interaction * interaction, double scale) const
+{
+// Builds the envelope by evaluating the differential cross section at the 
+// corners and the centre of each cell, for the input interaction with its 
+// probe 4-momentum scaled by the input factor. The bound of each cell is the
+// largest of these values times the safety factor.
+
+  Interaction * in = new Interaction(*interaction);
+  in->SetBit(kISkipProcessChk);
+  TLorentzVector * p4 = in->InitState().GetProbeP4(kRfLab);
+  in->InitStatePtr()->SetProbeP4(scale * (*p4));
+  delete p4;
+
+  const KPhaseSpace & kps = in->PhaseSpace();
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+  if(xl.max <= xl.min || yl.max <= yl.min) {
+    delete in;
+    return 0;
+  }
+  double dx = (xl.max - xl.min) / fEnvNx;
+  double dy = (yl.max - yl.min) / fEnvNy;
+
+  // cross section at the cell corners
+  vector<double> corner((fEnvNx+1)*(fEnvNy+1), 0.);
+  for(int ix = 0; ix <= fEnvNx; ix++) {
+    for(int iy = 0; iy <= fEnvNy; iy++) {
+      in->KinePtr()->Setx(xl.min + ix*dx);
+      in->KinePtr()->Sety(yl.min + iy*dy);
+      kinematics::UpdateWQ2FromXY(in);
+      corner[ix*(fEnvNy+1) + iy] = 
+          TMath::Max(0., fXSecModel->XSec(in, kPSxyfE));
+    }
+  }
+
+  KineEnvelope2D * envelope = new KineEnvelope2D(fEnvNx, fEnvNy);
+  for(int ix = 0; ix < fEnvNx; ix++) {
+    for(int iy = 0; iy < fEnvNy; iy++) {
+      in->KinePtr()->Setx(xl.min + (ix+0.5)*dx);
+      in->KinePtr()->Sety(yl.min + (iy+0.5)*dy);
+      kinematics::UpdateWQ2FromXY(in);
+      double max = fXSecModel->XSec(in, kPSxyfE);
+      max = TMath::Max(max, corner[ ix   *(fEnvNy+1) + iy  ]);
+      max = TMath::Max(max, corner[ ix   *(fEnvNy+1) + iy+1]);
+      max = TMath::Max(max, corner[(ix+1)*(fEnvNy+1) + iy  ]);
+      max = TMath::Max(max, corner[(ix+1)*(fEnvNy+1) + iy+1]);
+      envelope->SetCellMax(envelope->Cell(ix,iy), fSafetyFactor * max);
+    }
+  }
+  envelope->Finalize(fEnvMinCellFraction);
+
+  int nevals = (fEnvNx+1)*(fEnvNy+1) + fEnvNx*fEnvNy;
+
+  LOG("DISKinematics", pINFO)
+    << "Built (x,y) envelope for " << interaction->AsString() 
+    << " at E = " << this->Energy(in) << " GeV (" << nevals 
+    << " xsec evaluations): integral = " << envelope->Integral();
+
+  delete in;
+
+  if(!envelope->IsValid()) {
+    LOG("DISKinematics", pWARN)
+      << "Null (x,y) envelope for " << interaction->AsString();
+    delete envelope;
+    return 0;
+  }
+  return envelope;
+}
+//___________________________________________________________________________
+void DISKinematicsGenerator::DeleteEnvelopes(void)
+{
+  map<pair<ULong64_t,int>, KineEnvelope2D *>::iterator 
+                                           iter = fEnvelopes.begin();
+  for( ; iter != fEnvelopes.end(); ++iter) {
+    if(iter->second) delete iter->second;
+  }
+  fEnvelopes.clear();
+}
+//___________________________________________________________________________
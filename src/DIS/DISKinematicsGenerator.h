@@ -11,6 +11,16 @@
           previously computed values, is inherited from the KineGeneratorWithCache
           abstract class.
 
+          Optionally (UseAdaptiveEnvelope), the (x,y) candidates of the
+          rejection method are generated from a piecewise-constant envelope
+          of the differential cross section (see KineEnvelope2D) rather than
+          uniformly below a single max xsec. An envelope is built per
+          interaction and log(E) bin, by scanning the differential cross
+          section over the phase space at the upper edge of the bin, and it
+          adapts if its bound is found to be exceeded during generation
+          (the cell bound is raised and the candidate is rejected).
+          The mode is off by default.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
 
@@ -25,11 +35,19 @@
 #ifndef _DIS_KINEMATICS_GENERATOR_H_
 #define _DIS_KINEMATICS_GENERATOR_H_
 
+#include <map>
+#include <utility>
+
 #include "EVGModules/KineGeneratorWithCache.h"
 #include "Utils/Range1.h"
 
+using std::map;
+using std::pair;
+
 namespace genie {
 
+class KineEnvelope2D;
+
 class DISKinematicsGenerator : public KineGeneratorWithCache {
 
 public :
@@ -46,8 +64,19 @@ public :
   void Configure(string config);
 
 private:
-  void   LoadConfig      (void);
-  double ComputeMaxXSec  (const Interaction * interaction) const;
+  void             LoadConfig      (void);
+  double           ComputeMaxXSec  (const Interaction * interaction) const;
+  KineEnvelope2D * Envelope        (const Interaction * interaction) const;
+  KineEnvelope2D * BuildEnvelope   (const Interaction * interaction, double scale) const;
+  void             DeleteEnvelopes (void);
+
+  bool   fUseEnvelope;             ///< generate (x,y) from the adaptive envelope?
+  int    fEnvNx;                   ///< number of envelope cells along x
+  int    fEnvNy;                   ///< number of envelope cells along y
+  int    fEnvNBinsPerDecade;       ///< number of log(E) bins per decade (one envelope each)
+  double fEnvMinCellFraction;      ///< min cell bound, as a fraction of the largest one
+
+  mutable map<pair<ULong64_t,int>, KineEnvelope2D *> fEnvelopes; ///< (interaction key, E bin) -> envelope
 };
 
 }      // genie namespace
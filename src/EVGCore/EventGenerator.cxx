@@ -16,6 +16,9 @@
  @ Feb 01, 2013 - CA
    The GUNPHYSMASK env. var is no longer used. The bit-field mask is stored
    in the GHEP record and GHepRecord::Accept() is now checked.
+ @ Oct 17, 2026 - agent
+   Added NModules() and Module(int) to access the event record processing
+   modules (eg for building max differential xsec tables offline).
 */
 //____________________________________________________________________________
 
@@ -214,6 +217,17 @@ const XSecAlgorithmI * EventGenerator::CrossSectionAlg(void) const
   return fXSecModel;
 }
 //___________________________________________________________________________
+int EventGenerator::NModules(void) const
+{
+  return (fEVGModuleVec) ? fEVGModuleVec->size() : 0;
+}
+//___________________________________________________________________________
+const EventRecordVisitorI * EventGenerator::Module(int i) const
+{
+  if(i < 0 || i >= this->NModules()) return 0;
+  return (*fEVGModuleVec)[i];
+}
+//___________________________________________________________________________
 void EventGenerator::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -51,6 +51,10 @@ public :
   const InteractionListGeneratorI * IntListGenerator (void) const;
   const XSecAlgorithmI *            CrossSectionAlg  (void) const;
 
+  //-- access the event record processing modules
+  int                         NModules (void)  const;
+  const EventRecordVisitorI * Module   (int i) const;
+
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
   void Configure (const Registry & config);
@@ -10,7 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
-
+ @ Oct 17, 2026 - agent
+   FindGenerator() looks-up the generator using Interaction::Key() rather
+   than Interaction::AsString().
 */
 //____________________________________________________________________________
 
@@ -78,6 +80,7 @@ void InteractionGeneratorMap::CleanUp(void)
   delete fInteractionList;
 
   this->clear();
+  fKeyMap.clear();
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
@@ -97,6 +100,7 @@ void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
 
     this->insert(map<string, const EventGeneratorI *>::value_type(code,evg));
   }
+  fKeyMap = xsmap.fKeyMap;
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::UseGeneratorList(const EventGeneratorList * l)
@@ -154,6 +158,8 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
               << "\nLinking: " << code << " --> to: " << evgen->Id().Key();
         this->insert(
              map<string, const EventGeneratorI *>::value_type(code,evgen));
+        fKeyMap.insert(map<ULong64_t, const EventGeneratorI *>::value_type(
+             interaction->Key(),evgen));
      } // loop over interactions
      delete ilst;
      ilst = 0;
@@ -167,11 +173,12 @@ const EventGeneratorI * InteractionGeneratorMap::FindGenerator(
     LOG("IntGenMap", pWARN) << "Null interaction!!";
     return 0;
   }
-  string code = interaction->AsString();
-  InteractionGeneratorMap::const_iterator evgiter = this->find(code);
-  if(evgiter == this->end()) {
+  map<ULong64_t, const EventGeneratorI *>::const_iterator evgiter = 
+                                        fKeyMap.find(interaction->Key());
+  if(evgiter == fKeyMap.end()) {
     LOG("IntGenMap", pWARN)
-             << "No EventGeneratorI was found for interaction: \n" << code;
+             << "No EventGeneratorI was found for interaction: \n" 
+             << interaction->AsString();
     return 0;
   }
   const EventGeneratorI * evg = evgiter->second;
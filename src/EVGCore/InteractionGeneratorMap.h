@@ -68,6 +68,8 @@ private:
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  map<ULong64_t, const EventGeneratorI *> fKeyMap; ///< interaction code (see Interaction::Key()) -> generator
 };
 
 }      // genie namespace
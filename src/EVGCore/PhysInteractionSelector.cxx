@@ -17,10 +17,29 @@
    itself doesn't and its hard to diagnose problems from its actuall err mesg.
  @ Jun 23, 2008 - CA
    Protect against round off err / negative xsec
+ @ Oct 17, 2026 - agent
+   Don't build the interaction string in the per-interaction debug printout
+   unless low level messages are enabled.
+ @ Oct 17, 2026 - agent
+   The cross section algorithm, spline and frame boost of each interaction
+   are looked-up once per initial state and kept in a selection table. Each
+   selection is a single sweep over that table (no Interaction copies when
+   evaluating splines) followed by a binary search in the cumulative xsec
+   array. The xsec table printout is only built if it is to be printed.
+   Negative xsecs are now actually set to 0 (the TMath::Max() result was
+   previously discarded).
+ @ Oct 17, 2026 - agent
+   Added an optional approximate selection mode (UserPhysicsOptions param
+   IntSel-UseBinnedXSecTables): the xsec splines of each initial state are
+   tabulated on a log(E) grid with an alias table of the interaction 
+   probabilities at each node, and an interaction is selected in O(1) time.
+   The max relative error w.r.t. the exact selection is reported when the
+   tables are built.
 */
 //____________________________________________________________________________
 
 #include <vector>
+#include <algorithm>
 #include <sstream>
 #include <cstdlib>
 #include <iomanip>
@@ -28,7 +47,9 @@
 #include <TMath.h>
 #include <TLorentzVector.h>
 
+#include "Algorithm/AlgConfigPool.h"
 #include "Base/XSecAlgorithmI.h"
+#include "Conventions/GBuild.h"
 #include "Conventions/Units.h"
 #include "EVGCore/PhysInteractionSelector.h"
 #include "EVGCore/EventRecord.h"
@@ -65,7 +86,12 @@ InteractionSelectorI("genie::PhysInteractionSelector", config)
 //___________________________________________________________________________
 PhysInteractionSelector::~PhysInteractionSelector()
 {
-
+  map<const InteractionGeneratorMap *, SelTable *>::iterator 
+                                             iter = fSelTables.begin();
+  for( ; iter != fSelTables.end(); ++iter) {
+    delete iter->second;
+  }
+  fSelTables.clear();
 }
 //___________________________________________________________________________
 EventRecord * PhysInteractionSelector::SelectInteraction
@@ -82,140 +108,444 @@ EventRecord * PhysInteractionSelector::SelectInteraction
      return 0;
   }
 
-  // Get the list of spline objects
-  // Should have been constructed at the job initialization
-  XSecSplineList * xssl = 0;
-  if (fUseSplines) xssl = XSecSplineList::Instance();
-
   const InteractionList & ilst = igmap->GetInteractionList();
-  vector<double> xseclist(ilst.size());
 
-  string istate = ilst[0]->InitState().AsString();
-  ostringstream msg;
-  msg << "Selecting an interaction for the given initial state = "
-      << istate << " at E = " << p4.E() << " GeV";
+  // The interaction table printout is built only if it is to be printed
+  bool print = 
+     (*Messenger::Instance())("IntSel").isPriorityEnabled(pNOTICE);
+
+  if(print) {
+    string istate = ilst[0]->InitState().AsString();
+    ostringstream msg;
+    msg << "Selecting an interaction for the given initial state = "
+        << istate << " at E = " << p4.E() << " GeV";
+
+    LOG("IntSel", pNOTICE)
+               << utils::print::PrintFramedMesg(msg.str(), 0, '=');
+  }
+
+  // Get the selection table for this initial state
+  // (built the first time an interaction is selected for it)
+  SelTable * table = this->GetSelTable(igmap);
+  vector<double> & xseclist = table->fXSecSum;
+
+  unsigned int nint = ilst.size();
+
+  int    isel     = -1; // selected interaction
+  double xsec_sel = 0;  // and its cross section
+
+  // Approximate selection from the energy-binned alias tables, if built.
+  // The interpolation may pick an interaction just below its threshold;
+  // the exact selection is used instead in that case.
+  if(table->fBinned) {
+     isel = this->SelectBinned(table, p4.E());
+     if(isel >= 0) {
+        xsec_sel = this->SplineXSec(table->fSpline[isel], p4.E());
+        if(xsec_sel <= 0) isel = -1;
+     }
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+     LOG("IntSel", pINFO)
+        << "Binned table selection: " << isel << " (xsec = " << xsec_sel << ")";
+#endif
+  }
+
+  if(isel < 0) {
+
+    if(print) {
+      LOG("IntSel", pNOTICE)
+         << "Computing xsecs for all relevant modeled interactions:";
+    }
+
+    // Compute the cumulative cross section for all interactions in the list
+
+    const double Elab = p4.E();
+    const double px   = p4.Px();
+    const double py   = p4.Py();
+    const double pz   = p4.Pz();
+
+    double xsec_sum = 0;
+
+    for(unsigned int iint = 0; iint < nint; iint++) {
+
+       double xsec = 0; // cross section for this interaction
+
+       const Spline * spl = table->fSpline[iint];
+       if (spl) {
+             // probe energy in the lab or the hit nucleon rest frame
+             // (same as TLorentzVector::Boost() to the hit nucleon rest frame)
+             double E = (table->fLabFrame[iint]) ? Elab :
+                table->fGamma[iint] * (Elab - (table->fBx[iint] * px + 
+                             table->fBy[iint] * py + table->fBz[iint] * pz));
+             if(TMath::IsNaN(E)) {
+      		 BLOG("IntSel", pFATAL) << *ilst[iint];
+      		 BLOG("IntSel", pFATAL) << "E = " << E;
+  		 abort();
+  	     }
+             xsec = this->SplineXSec(spl, E);
+       } else {
+             Interaction * interaction = new Interaction(*ilst[iint]);
+             interaction->InitStatePtr()->SetProbeP4(p4);
+             xsec = table->fXSecAlg[iint]->Integral(interaction);
+             delete interaction;
+       }
+       xsec = TMath::Max(0., xsec);
+
+       xsec_sum       += xsec;
+       xseclist[iint]  = xsec_sum;
+
+    } // loop over interaction that can be generated
+
+    if(print) {
+      ostringstream xsec_table_printout;
+      xsec_table_printout 
+          << " |"  << setfill('-') << setw(112) << "|" << endl     
+          << " | " << setfill(' ') << setw(80) << "interaction"
+          << " | cross-section (1E-38*cm^2) |" << endl
+          << " |"  << setfill('-') << setw(112) << "|" << endl;
+      for(unsigned int iint = 0; iint < nint; iint++) {
+         double xsec = xseclist[iint] - ((iint > 0) ? xseclist[iint-1] : 0.);
+         xsec_table_printout 
+             << " | " << setfill(' ') << setw(80) << ilst[iint]->AsString()
+             << " | " << setfill(' ') << setw(26) << xsec/(1E-38*cm2)
+             << " | " << endl;
+      }
+      xsec_table_printout
+          << " |"  << setfill('-') << setw(112) << "|" << endl;
+
+      LOG("IntSel", pNOTICE)
+        << "\n" << xsec_table_printout.str();
+    }
+
+    // select an interaction
+
+    RandomGen * rnd = RandomGen::Instance();
+    double R = xsec_sum * rnd->RndISel().Rndm();
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("IntSel", pINFO)
+        << "Generating Rndm (0. -> max = " << xsec_sum << ") = " << R;
+#endif
+
+    // the selected interaction is the first one with Sum{xsec}(0->i) > R
+    vector<double>::const_iterator sel = 
+        std::upper_bound(xseclist.begin(), xseclist.begin() + nint, R);
+
+    if(sel == xseclist.begin() + nint) {
+       LOG("IntSel", pERROR) << "Could not select interaction";
+       return 0;
+    }
+    isel = sel - xseclist.begin();
+
+    // get the cross section for the selected interaction (just extract it
+    // from the array of summed xsecs rather than recomputing it)
+    double xsec_pedestal = (isel > 0) ? xseclist[isel-1] : 0.;
+    xsec_sel = xseclist[isel] - xsec_pedestal;
+  }
+  assert(xsec_sel>0);
+
+  Interaction * selected_interaction = new Interaction (*ilst[isel]);
+  selected_interaction->InitStatePtr()->SetProbeP4(p4);
 
   LOG("IntSel", pNOTICE)
-             << utils::print::PrintFramedMesg(msg.str(), 0, '=');
-  LOG("IntSel", pNOTICE)
-     << "Computing xsecs for all relevant modeled interactions:";
+     << "Selected interaction: " << selected_interaction->AsString();
+
+  // bootstrap the event record
+  EventRecord * evrec = new EventRecord;
+  evrec->AttachSummary(selected_interaction);
+  evrec->SetXSec(xsec_sel);
 
-  unsigned int i=0;
-  InteractionList::const_iterator intliter = ilst.begin(); 
+  return evrec;
+}
+//___________________________________________________________________________
+PhysInteractionSelector::SelTable * PhysInteractionSelector::GetSelTable(
+                                 const InteractionGeneratorMap * igmap) const
+{
+// Return the selection table for the input initial state, building it if
+// this is the first selection for it or if its interaction list has changed
 
-  ostringstream xsec_table_printout;
+  const InteractionList & ilst = igmap->GetInteractionList();
 
-  xsec_table_printout 
-      << " |"  << setfill('-') << setw(112) << "|" << endl     
-      << " | " << setfill(' ') << setw(80) << "interaction"
-      << " | cross-section (1E-38*cm^2) |" << endl
-      << " |"  << setfill('-') << setw(112) << "|" << endl;
+  SelTable * table = 0;
+  map<const InteractionGeneratorMap *, SelTable *>::iterator 
+                                             iter = fSelTables.find(igmap);
+  if(iter != fSelTables.end()) {
+    table = iter->second;
+    bool valid = 
+        (table->fIntList == &ilst) && 
+        (table->fXSecSum.size() == ilst.size()) && (table->fFirst == ilst[0]) &&
+        (table->fNSplResets == XSecSplineList::Instance()->NResets());
+    if(!valid) this->BuildSelTable(igmap, table);
+  } else {
+    table = new SelTable;
+    this->BuildSelTable(igmap, table);
+    fSelTables.insert(
+       map<const InteractionGeneratorMap *, SelTable *>::value_type(igmap,table));
+  }
+
+  // interactions whose xsec spline was not available when the table was 
+  // built: check whether it is available now
+  if(fUseSplines && !table->fBinned) {
+    bool all_splines = true;
+    XSecSplineList * xssl = XSecSplineList::Instance();
+    for(unsigned int iint = 0; iint < ilst.size(); iint++) {
+      if(table->fSpline[iint]) continue;
+      const XSecAlgorithmI * xsec_alg = table->fXSecAlg[iint];
+      if(xssl->SplineExists(xsec_alg, ilst[iint])) {
+        table->fSpline[iint] = xssl->GetSpline(xsec_alg, ilst[iint]);
+      } else {
+        all_splines = false;
+      }
+    }
+    // the energy-binned tables can be built once all splines are available
+    if(fUseBinnedTables && all_splines && !table->fBinnedTried) {
+      this->BuildBinnedTable(table);
+    }
+  }
+
+  return table;
+}
+//___________________________________________________________________________
+void PhysInteractionSelector::BuildSelTable(
+    const InteractionGeneratorMap * igmap, SelTable * table) const
+{
+  const InteractionList & ilst = igmap->GetInteractionList();
+  unsigned int nint = ilst.size();
 
-  for( ; intliter != ilst.end(); ++intliter) {
+  LOG("IntSel", pINFO)
+     << "Building the interaction selection table for initial state: "
+     << ilst[0]->InitState().AsString() << " (" << nint << " interactions)";
+
+  table->fIntList = &ilst;
+  table->fFirst   = ilst[0];
+  table->fXSecAlg .assign(nint, 0);
+  table->fSpline  .assign(nint, 0);
+  table->fLabFrame.assign(nint, true);
+  table->fBx      .assign(nint, 0.);
+  table->fBy      .assign(nint, 0.);
+  table->fBz      .assign(nint, 0.);
+  table->fGamma   .assign(nint, 1.);
+  table->fXSecSum .assign(nint, 0.);
+  table->fNSplResets = XSecSplineList::Instance()->NResets();
+
+  table->fBinned      = false;
+  table->fBinnedTried = false;
+  table->fLogEmin     = 0.;
+  table->fDLogE       = 0.;
+  table->fNNodes      = 0;
+  table->fMaxRelErr   = 0.;
+  table->fNodeXSec .clear();
+  table->fAliasProb.clear();
+  table->fAliasIdx .clear();
 
-     Interaction * interaction = new Interaction(**intliter);
-     interaction->InitStatePtr()->SetProbeP4(p4);
+  XSecSplineList * xssl = 0;
+  if (fUseSplines) xssl = XSecSplineList::Instance();
 
-     SLOG("IntSel", pDEBUG)
-           << "Computing xsec for: \n  " << interaction->AsString();
+  for(unsigned int iint = 0; iint < nint; iint++) {
+     const Interaction * interaction = ilst[iint];
 
-     // get the cross section for this interaction
+     // get the cross section algorithm for this interaction
      const XSecAlgorithmI * xsec_alg =
                igmap->FindGenerator(interaction)->CrossSectionAlg();
      assert(xsec_alg);
+     table->fXSecAlg[iint] = xsec_alg;
 
-     double xsec = 0; // cross section for this interaction
-
-     bool spline_computed = xssl->SplineExists(xsec_alg, interaction);
-     bool eval = fUseSplines && spline_computed;
-     if (eval) {
-           const InitialState & init = interaction->InitState();
-           const ProcessInfo & proc  = interaction->ProcInfo();
-           // choose ref frame ('Lab' or 'Hit nucleon rest frame')
-           RefFrame_t frame = 
-              (proc.IsCoherent() || proc.IsElectronScattering()) ? 
-              kRfLab : kRfHitNucRest;
-           double E = init.ProbeE(frame);
-           if(TMath::IsNaN(E)) {
-    		 BLOG("IntSel", pFATAL) << *interaction;
-    		 BLOG("IntSel", pFATAL) << "E = " << E;
-		 abort();
-	   }
-           const Spline * spl = xssl->GetSpline(xsec_alg,interaction);
-           if(spl->ClosestKnotValueIsZero(E,"-")) xsec = 0;
-           else xsec = spl->Evaluate(E);
-     } else {
-           xsec = xsec_alg->Integral(interaction);
+     // get the cross section spline (if any)
+     if(xssl && xssl->SplineExists(xsec_alg, interaction)) {
+        table->fSpline[iint] = xssl->GetSpline(xsec_alg, interaction);
      }
-     TMath::Max(0., xsec);
-/*
-     LOG("IntSel", pNOTICE)
-       << interaction->AsString() 
-       << " --> xsec " << (eval ? "[**interp**]" : "[**calc**]") 
-       << " = " << xsec/cm2 << " cm^2";
-*/
-     xsec_table_printout 
-           << " | " << setfill(' ') << setw(80) << interaction->AsString()
-           << " | " << setfill(' ') << setw(26) << xsec/(1E-38*cm2)
-           << " | " << endl;
 
-     xseclist[i++] = xsec;
-     delete interaction;
-
-  } // loop over interaction that can be generated
+     // choose ref frame ('Lab' or 'Hit nucleon rest frame') for the energy
+     // at which the spline gets evaluated
+     const InitialState & init = interaction->InitState();
+     const ProcessInfo &  proc = interaction->ProcInfo();
+     bool lab = proc.IsCoherent() || proc.IsElectronScattering();
+     table->fLabFrame[iint] = lab;
+     if(!lab) {
+        const TLorentzVector * pnuc4 = init.Tgt().HitNucP4Ptr();
+        assert(pnuc4);
+        double bx = pnuc4->Px() / pnuc4->Energy();
+        double by = pnuc4->Py() / pnuc4->Energy();
+        double bz = pnuc4->Pz() / pnuc4->Energy();
+        table->fBx   [iint] = bx;
+        table->fBy   [iint] = by;
+        table->fBz   [iint] = bz;
+        table->fGamma[iint] = 1.0 / TMath::Sqrt(1.0 - (bx*bx + by*by + bz*bz));
+     }
+  }
+}
+//___________________________________________________________________________
+void PhysInteractionSelector::BuildBinnedTable(SelTable * table) const
+{
+// Tabulate the cross section splines of all interactions in the table on a
+// log(E) grid and build an alias table of the interaction probabilities at
+// each grid node. The tables are indexed by the probe energy, so they are
+// only built if no interaction cross section depends on the probe direction
+// (i.e. the spline of each interaction is evaluated either at the lab energy
+// or in the rest frame of a hit nucleon at rest).
+
+  table->fBinnedTried = true;
+  table->fBinned      = false;
+
+  const InteractionList & ilst = *(table->fIntList);
+  unsigned int nint = ilst.size();
+  if(nint == 0) return;
+
+  double Emin = 0, Emax = 0;
+  for(unsigned int iint = 0; iint < nint; iint++) {
+    const Spline * spl = table->fSpline[iint];
+    if(!spl) return;
+    bool at_rest = (table->fBx[iint] == 0. && 
+                    table->fBy[iint] == 0. && table->fBz[iint] == 0.);
+    if(!table->fLabFrame[iint] && !at_rest) {
+      LOG("IntSel", pWARN)
+        << "Can not build energy-binned selection tables for initial state: "
+        << ilst[0]->InitState().AsString() 
+        << " (hit nucleon not at rest) - Using the exact selection";
+      return;
+    }
+    Emin = (iint == 0) ? spl->XMin() : TMath::Min(Emin, spl->XMin());
+    Emax = (iint == 0) ? spl->XMax() : TMath::Max(Emax, spl->XMax());
+  }
+  Emin = TMath::Max(Emin, 1E-3);
+  if(Emax <= Emin) return;
 
-  xsec_table_printout
-      << " |"  << setfill('-') << setw(112) << "|" << endl;
+  double logEmin = TMath::Log10(Emin);
+  double logEmax = TMath::Log10(Emax);
+  int    nbins   = TMath::Max(1, 
+       (int) TMath::Ceil((logEmax - logEmin) * TMath::Max(1,fNBinsPerDecade)));
+  int    nnodes  = nbins + 1;
+  double dlogE   = (logEmax - logEmin) / nbins;
 
   LOG("IntSel", pNOTICE)
-    << "\n" << xsec_table_printout.str();
-
-  // select an interaction
+     << "Building energy-binned selection tables for initial state: "
+     << ilst[0]->InitState().AsString() << " (" << nint << " interactions, " 
+     << nbins << " bins in E = [" << Emin << ", " << Emax << "] GeV)";
+
+  table->fLogEmin = logEmin;
+  table->fDLogE   = dlogE;
+  table->fNNodes  = nnodes;
+  table->fNodeXSec .assign(nnodes, 0.);
+  table->fAliasProb.assign(nnodes*nint, 1.);
+  table->fAliasIdx .assign(nnodes*nint, 0);
+
+  // cross sections at the grid nodes (kept for the error estimate below)
+  vector<double> xsec(nnodes*nint, 0.);
+
+  vector<double>       scaled(nint);
+  vector<unsigned int> small;
+  vector<unsigned int> large;
+
+  for(int inode = 0; inode < nnodes; inode++) {
+    double E = TMath::Power(10., logEmin + inode * dlogE);
+    double * x = &xsec[inode*nint];
+    double sum = 0;
+    for(unsigned int iint = 0; iint < nint; iint++) {
+      x[iint] = TMath::Max(0., this->SplineXSec(table->fSpline[iint], E));
+      sum += x[iint];
+    }
+    table->fNodeXSec[inode] = sum;
+
+    double *       prob  = &(table->fAliasProb[inode*nint]);
+    unsigned int * alias = &(table->fAliasIdx [inode*nint]);
+    for(unsigned int iint = 0; iint < nint; iint++) alias[iint] = iint;
+    if(sum <= 0) continue;
+
+    // Vose's alias method
+    small.clear();
+    large.clear();
+    for(unsigned int iint = 0; iint < nint; iint++) {
+      scaled[iint] = nint * x[iint] / sum;
+      if(scaled[iint] < 1.) small.push_back(iint);
+      else                  large.push_back(iint);
+    }
+    while(!small.empty() && !large.empty()) {
+      unsigned int is = small.back(); small.pop_back();
+      unsigned int il = large.back(); large.pop_back();
+      prob [is] = scaled[is];
+      alias[is] = il;
+      scaled[il] -= (1. - scaled[is]);
+      if(scaled[il] < 1.) small.push_back(il);
+      else                large.push_back(il);
+    }
+    // left-overs (round-off) are accepted with probability 1
+    while(!large.empty()) { prob[large.back()] = 1.; large.pop_back(); }
+    while(!small.empty()) { prob[small.back()] = 1.; small.pop_back(); }
+  }
 
-  LOG("IntSel", pINFO)
-            << "Selecting an entry from the Interaction List";
-  double xsec_sum  = 0;
-  for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
-     xsec_sum       += xseclist[iint];
-     xseclist[iint]  = xsec_sum;
-
-     SLOG("IntSel", pINFO)
-             << "Sum{xsec}(0->" << iint << ") = " << xsec_sum;
+  // Compare the interpolated interaction probabilities with the exact ones
+  // at the bin centres. The relative error is quoted for interactions with
+  // a probability above 1E-4, the absolute error for all of them.
+  double max_rel_err = 0, max_abs_err = 0, E_rel_err = 0;
+  int    iint_rel_err = -1;
+  vector<double> xmid(nint);
+  for(int ibin = 0; ibin < nbins; ibin++) {
+    double E = TMath::Power(10., logEmin + (ibin + 0.5) * dlogE);
+    double sum = 0;
+    for(unsigned int iint = 0; iint < nint; iint++) {
+      xmid[iint] = TMath::Max(0., this->SplineXSec(table->fSpline[iint], E));
+      sum += xmid[iint];
+    }
+    double sum_interp = 0.5 * (table->fNodeXSec[ibin] + table->fNodeXSec[ibin+1]);
+    if(sum <= 0 || sum_interp <= 0) continue;
+    for(unsigned int iint = 0; iint < nint; iint++) {
+      double P  = xmid[iint] / sum;
+      double Pi = 0.5 * (xsec[ibin*nint+iint] + xsec[(ibin+1)*nint+iint]) / sum_interp;
+      double abs_err = TMath::Abs(Pi - P);
+      max_abs_err = TMath::Max(max_abs_err, abs_err);
+      if(P > 1E-4 && abs_err/P > max_rel_err) {
+         max_rel_err  = abs_err/P;
+         E_rel_err    = E;
+         iint_rel_err = iint;
+      }
+    }
   }
-  RandomGen * rnd = RandomGen::Instance();
-  double R = xsec_sum * rnd->RndISel().Rndm();
+  table->fMaxRelErr = max_rel_err;
+  table->fBinned    = true;
 
-  LOG("IntSel", pINFO)
-      << "Generating Rndm (0. -> max = " << xsec_sum << ") = " << R;
+  LOG("IntSel", pNOTICE)
+     << "Energy-binned selection tables: max relative error of interaction "
+     << "probabilities (P > 1E-4) = " << max_rel_err 
+     << ((iint_rel_err >= 0) ? " for " + ilst[iint_rel_err]->AsString() : "")
+     << " at E = " << E_rel_err << " GeV; max absolute error = " << max_abs_err;
+}
+//___________________________________________________________________________
+int PhysInteractionSelector::SelectBinned(
+                                   const SelTable * table, double E) const
+{
+// Select an interaction from the energy-binned alias tables.
+// Returns -1 if the energy is outside the tabulated range.
 
-  for(unsigned int iint = 0; iint < xseclist.size(); iint++) {
+  if(E <= 0) return -1;
+  double t = (TMath::Log10(E) - table->fLogEmin) / table->fDLogE;
+  if(t < 0 || t > table->fNNodes - 1) return -1;
 
-     SLOG("IntSel", pDEBUG)
-               << "Sum{xsec}(0->" << iint <<") = " << xseclist[iint];
+  int    ibin = TMath::Min((int)t, table->fNNodes - 2);
+  double f    = t - ibin;
 
-     if( R < xseclist[iint] ) {
-       Interaction * selected_interaction = new Interaction (*ilst[iint]);
-       selected_interaction->InitStatePtr()->SetProbeP4(p4);
+  // pick one of the two bin nodes, with its weight in the linearly 
+  // interpolated cross sections
+  double w0 = (1-f) * table->fNodeXSec[ibin];
+  double w1 =    f  * table->fNodeXSec[ibin+1];
+  if(w0 + w1 <= 0) return -1;
 
-       // set the cross section for the selected interaction (just extract it
-       // from the array of summed xsecs rather than recomputing it)
-       double xsec_pedestal = (iint > 0) ? xseclist[iint-1] : 0.;
-       double xsec = xseclist[iint] - xsec_pedestal;
-       assert(xsec>0);
+  RandomGen * rnd = RandomGen::Instance();
+  int inode = (rnd->RndISel().Rndm() * (w0 + w1) < w0) ? ibin : ibin+1;
 
-       LOG("IntSel", pNOTICE)
-         << "Selected interaction: " << selected_interaction->AsString();
+  // alias draw
+  unsigned int nint = table->fXSecSum.size();
+  double       u    = nint * rnd->RndISel().Rndm();
+  unsigned int icol = TMath::Min((unsigned int)u, nint-1);
+  unsigned int k    = inode * nint + icol;
 
-       // bootstrap the event record
-       EventRecord * evrec = new EventRecord;
-       evrec->AttachSummary(selected_interaction);
-       evrec->SetXSec(xsec);
+  return (u - icol < table->fAliasProb[k]) ? icol : table->fAliasIdx[k];
+}
+//___________________________________________________________________________
+double PhysInteractionSelector::SplineXSec(const Spline * spl, double E) const
+{
+// The cross section is taken to be zero if the closest knot below E is zero
+// (a single knot look-up, see Spline::EvaluateNonZeroInterval())
 
-       return evrec;
-     }
-  }
-  LOG("IntSel", pERROR) << "Could not select interaction";
-  return 0;
+  return spl->EvaluateNonZeroInterval(E);
 }
 //___________________________________________________________________________
 void PhysInteractionSelector::Configure(const Registry & config)
@@ -235,5 +565,24 @@ void PhysInteractionSelector::LoadConfigData(void)
   //check whether the user prefers the cross sections to be calculated or
   //evaluated from a spline object constructed at the job initialization
   fUseSplines = fConfig->GetBoolDef("UseStoredXSecs", false);
+
+  // approximate selection from energy-binned alias tables? 
+  // (requires the cross section splines)
+  AlgConfigPool * confp = AlgConfigPool::Instance();
+  const Registry * gc = confp->GlobalParameterList();
+
+  fUseBinnedTables = fConfig->GetBoolDef(
+       "UseBinnedXSecTables", gc->GetBool("IntSel-UseBinnedXSecTables"));
+  fNBinsPerDecade  = fConfig->GetIntDef(
+       "NBinsPerDecade",      gc->GetInt ("IntSel-NBinsPerDecade"));
+  fUseBinnedTables = fUseBinnedTables && fUseSplines;
+
+  // the selection tables depend on the configuration - rebuild them
+  map<const InteractionGeneratorMap *, SelTable *>::iterator 
+                                             iter = fSelTables.begin();
+  for( ; iter != fSelTables.end(); ++iter) {
+    delete iter->second;
+  }
+  fSelTables.clear();
 }
 //___________________________________________________________________________
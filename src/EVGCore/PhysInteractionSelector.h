@@ -7,6 +7,24 @@
 
          Is a concrete implementation of the InteractionSelectorI interface.
 
+         The first time an interaction is selected for a given initial state
+         (InteractionGeneratorMap), a selection table is built with the
+         cross section algorithm, the cross section spline and the frame
+         boost of each interaction in the list. Each subsequent selection is
+         a single sweep over that table, filling the cumulative cross
+         section array, followed by a binary search for the selected entry.
+
+         Optionally (UserPhysicsOptions: IntSel-UseBinnedXSecTables), once
+         all interactions of an initial state have a cross section spline,
+         the splines are tabulated on a fine log(E) grid and an alias table
+         of the interaction probabilities is built at each grid node. The
+         selection is then O(1) in the number of interactions: pick the
+         energy bin, pick one of its two nodes with the weight of the linear
+         interpolation, and take one alias draw. The maximum relative error
+         of the interpolated interaction probabilities with respect to the
+         exact ones is reported when the tables are built. Only the cross
+         section of the selected interaction is evaluated (from its spline).
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
 
@@ -21,10 +39,20 @@
 #ifndef _PHYS_INTERACTION_SELECTOR_H_
 #define _PHYS_INTERACTION_SELECTOR_H_
 
+#include <map>
+#include <vector>
+
 #include "EVGCore/InteractionSelectorI.h"
 
+using std::map;
+using std::vector;
+
 namespace genie {
 
+class InteractionList;
+class XSecAlgorithmI;
+class Spline;
+
 class PhysInteractionSelector : public InteractionSelectorI {
 
 public :
@@ -42,9 +70,46 @@ public :
   void Configure (string param_set);
 
 private:
-  void LoadConfigData (void);
 
-  bool fUseSplines;
+  // Selection table for the interaction list of an initial state
+  class SelTable {
+  public:
+    const InteractionList *        fIntList;  ///< interaction list the table was built for
+    const Interaction *            fFirst;    ///< first entry of that list (to detect a re-built list)
+    vector<const XSecAlgorithmI *> fXSecAlg;  ///< cross section algorithm, per interaction
+    vector<const Spline *>         fSpline;   ///< cross section spline, per interaction (0: integrate)
+    vector<bool>                   fLabFrame; ///< evaluate spline at the lab (rather than hit nucleon rest frame) energy?
+    vector<double>                 fBx;       ///< hit nucleon velocity (x)
+    vector<double>                 fBy;       ///< hit nucleon velocity (y)
+    vector<double>                 fBz;       ///< hit nucleon velocity (z)
+    vector<double>                 fGamma;    ///< hit nucleon Lorentz factor
+    vector<double>                 fXSecSum;  ///< cumulative cross section (re-filled at each selection)
+    unsigned int                   fNSplResets; ///< XSecSplineList::NResets() when the splines were fetched
+
+    // energy-binned alias tables (approximate selection mode)
+    bool                 fBinned;     ///< binned tables built?
+    bool                 fBinnedTried; ///< binned tables build attempted?
+    double               fLogEmin;    ///< log10(E/GeV) at the first grid node
+    double               fDLogE;      ///< log10(E) grid step
+    int                  fNNodes;     ///< number of grid nodes
+    vector<double>       fNodeXSec;   ///< total cross section at each node
+    vector<double>       fAliasProb;  ///< alias table acceptance probabilities, [node*nint + column]
+    vector<unsigned int> fAliasIdx;   ///< alias table aliases, [node*nint + column]
+    double               fMaxRelErr;  ///< max relative error of the interpolated probabilities
+  };
+
+  void       LoadConfigData (void);
+  SelTable * GetSelTable    (const InteractionGeneratorMap * igmap) const;
+  void       BuildSelTable  (const InteractionGeneratorMap * igmap, SelTable * table) const;
+  void       BuildBinnedTable (SelTable * table) const;
+  int        SelectBinned     (const SelTable * table, double E) const;
+  double     SplineXSec       (const Spline * spl, double E) const;
+
+  bool   fUseSplines;
+  bool   fUseBinnedTables;   ///< use the energy-binned alias tables?
+  int    fNBinsPerDecade;    ///< number of log(E) bins per energy decade for the binned tables
+
+  mutable map<const InteractionGeneratorMap *, SelTable *> fSelTables; ///< selection table per initial state
 };
 
 }      // genie namespace
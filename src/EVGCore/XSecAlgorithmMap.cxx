@@ -10,7 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
-
+ @ Oct 17, 2026 - agent
+   FindXSecAlgorithm() looks-up the algorithm using Interaction::Key()
+   rather than Interaction::AsString().
 */
 //____________________________________________________________________________
 
@@ -72,6 +74,7 @@ void XSecAlgorithmMap::CleanUp(void)
   delete fInteractionList;
 
   this->clear();
+  fKeyMap.clear();
 }
 //___________________________________________________________________________
 void XSecAlgorithmMap::Copy(const XSecAlgorithmMap & xsmap)
@@ -91,6 +94,7 @@ void XSecAlgorithmMap::Copy(const XSecAlgorithmMap & xsmap)
 
     this->insert(map<string, const XSecAlgorithmI *>::value_type(code,alg));
   }
+  fKeyMap = xsmap.fKeyMap;
 }
 //___________________________________________________________________________
 void XSecAlgorithmMap::UseGeneratorList(const EventGeneratorList * list)
@@ -154,6 +158,8 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
               << "\n     --> with xsec algorithm: " << xsec_alg->Id().Key();
          this->insert(
             map<string, const XSecAlgorithmI *>::value_type(code,xsec_alg));
+         fKeyMap.insert(map<ULong64_t, const XSecAlgorithmI *>::value_type(
+            interaction->Key(),xsec_alg));
 
      } // loop over interactions
      delete ilst;
@@ -169,12 +175,12 @@ const XSecAlgorithmI * XSecAlgorithmMap::FindXSecAlgorithm(
     return 0;
   }
 
-  string code = interaction->AsString();
-
-  XSecAlgorithmMap::const_iterator xsec_alg_iter = this->find(code);
-  if(xsec_alg_iter == this->end()) {
+  map<ULong64_t, const XSecAlgorithmI *>::const_iterator xsec_alg_iter = 
+                                        fKeyMap.find(interaction->Key());
+  if(xsec_alg_iter == fKeyMap.end()) {
     LOG("XSecAlgMap", pWARN)
-         << "No XSecAlgorithmI was found for interaction: \n" << code;
+         << "No XSecAlgorithmI was found for interaction: \n" 
+         << interaction->AsString();
     return 0;
   }
 
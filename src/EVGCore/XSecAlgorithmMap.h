@@ -25,6 +25,8 @@
 #include <string>
 #include <ostream>
 
+#include <Rtypes.h>
+
 using std::map;
 using std::string;
 using std::ostream;
@@ -67,6 +69,8 @@ private:
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  map<ULong64_t, const XSecAlgorithmI *> fKeyMap; ///< interaction code (see Interaction::Key()) -> xsec algorithm
 };
 
 }      // genie namespace
@@ -41,6 +41,9 @@
  @ Feb 01, 2013 - CA
    The GUNPHYSMASK env. var is no longer used. Added SetUnphysEventMask(const 
    TBits &). Input is propagated accordingly.
+ @ Oct 17, 2026 - agent
+   Added QueueSplines(GSplineWorkerPool &,...) so that gmkspl can compute the
+   splines in parallel.
 */
 //____________________________________________________________________________
 
@@ -56,6 +59,7 @@
 #include "Conventions/Controls.h"
 #include "Conventions/Units.h"
 #include "EVGDrivers/GEVGDriver.h"
+#include "EVGDrivers/GSplineWorkerPool.h"
 #include "EVGCore/EventRecord.h"
 #include "EVGCore/EventGeneratorList.h"
 #include "EVGCore/EventGeneratorI.h"
@@ -619,6 +623,31 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
   LOG("GEVGDriver", pINFO)
        << "Creating (missing) splines with [UseLogE: "
                                              << ((useLogE) ? "ON]" : "OFF]");
+
+  this->BuildSplines(nknots, emax, useLogE, 0);
+
+  LOG("GEVGDriver", pINFO) << *XSecSplineList::Instance(); // print list of splines
+
+  fUseSplines = true;
+}
+//___________________________________________________________________________
+void GEVGDriver::QueueSplines(
+    GSplineWorkerPool & pool, int nknots, double emax, bool useLogE)
+{
+// Same as CreateSplines() but, rather than computing the missing splines
+// right away, it adds them to the input spline worker pool.
+// The splines are available once GSplineWorkerPool::Run() has been called.
+
+  LOG("GEVGDriver", pINFO)
+       << "Queueing (missing) splines with [UseLogE: "
+                                             << ((useLogE) ? "ON]" : "OFF]");
+
+  this->BuildSplines(nknots, emax, useLogE, &pool);
+}
+//___________________________________________________________________________
+void GEVGDriver::BuildSplines(
+    int nknots, double emax, bool useLogE, GSplineWorkerPool * pool)
+{
   // Get the list of spline objects
   XSecSplineList * xsl = XSecSplineList::Instance();
   xsl->SetLogE(useLogE);
@@ -685,7 +714,8 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
              SLOG("GEVGDriver", pNOTICE) 
                << "The spline wasn't loaded at initialization. "
                << "I can build it now but it might take a while..."; 
-             xsl->CreateSpline(alg, interaction, nknots, Emin, emax);
+             if(pool) pool->AddSpline  (alg, interaction, nknots, Emin, emax);
+             else     xsl->CreateSpline(alg, interaction, nknots, Emin, emax);
          } else {
              SLOG("GEVGDriver", pDEBUG) << "Spline was found";
          }
@@ -693,10 +723,6 @@ void GEVGDriver::CreateSplines(int nknots, double emax, bool useLogE)
      delete ilst;
      ilst = 0;
   } // loop over event generators
-
-  LOG("GEVGDriver", pINFO) << *xsl; // print list of splines
-
-  fUseSplines = true;
 }
 //___________________________________________________________________________
 Range1D_t GEVGDriver::ValidEnergyRange(void) const
@@ -48,6 +48,7 @@ class Interaction;
 class InitialState;
 class Target;
 class Spline;
+class GSplineWorkerPool;
 
 class GEVGDriver {
 
@@ -88,6 +89,11 @@ public :
   // Instruct the driver to create all the splines it needs
   void CreateSplines (int nknots=-1, double emax=-1, bool inLogE=true);
 
+  // Queue the splines that CreateSplines() would create at the input pool,
+  // so that they can be computed in parallel (see GSplineWorkerPool)
+  void QueueSplines  (GSplineWorkerPool & pool, 
+                      int nknots=-1, double emax=-1, bool inLogE=true);
+
   // Methods used for building the 'total' cross section spline
   double XSecSum             (const TLorentzVector & nup4);
   void   CreateXSecSumSpline (int nk, double Emin, double Emax, bool inlogE=true);
@@ -111,6 +117,8 @@ private:
   void BuildInteractionGeneratorMap (void);
   void BuildInteractionSelector     (void);
   void AssertIsValidInitState       (void) const;
+  void BuildSplines                 (int nknots, double emax, bool useLogE, 
+                                     GSplineWorkerPool * pool);
 
   // Private data members
   InitialState *            fInitState;       ///< initial state information for driver instance
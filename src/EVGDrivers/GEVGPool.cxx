@@ -10,7 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
-
+ @ Oct 17, 2026 - agent
+   FindDriver(const InitialState &) looks-up drivers using InitialState::Key().
+   The string key is only built the first time an initial state is requested.
 */
 //____________________________________________________________________________
 
@@ -49,9 +51,17 @@ GEVGPool::~GEVGPool()
 //___________________________________________________________________________
 GEVGDriver * GEVGPool::FindDriver(const InitialState & init) const
 {
+  ULong64_t key = init.Key();
+  map<ULong64_t, GEVGDriver *>::const_iterator kiter = fKeyMap.find(key);
+  if(kiter != fKeyMap.end()) return kiter->second;
+
   string str_init = init.AsString();
 
-  return this->FindDriver(str_init);
+  GEVGDriver * driver = this->FindDriver(str_init);
+  if(driver) {
+    fKeyMap.insert(map<ULong64_t, GEVGDriver *>::value_type(key, driver));
+  }
+  return driver;
 }
 //___________________________________________________________________________
 GEVGDriver * GEVGPool::FindDriver(string init) const
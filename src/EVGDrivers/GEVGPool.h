@@ -23,6 +23,8 @@
 #include <string>
 #include <ostream>
 
+#include <Rtypes.h>
+
 using std::map;
 using std::string;
 using std::ostream;
@@ -45,6 +47,10 @@ public :
   void Print (ostream & stream) const;
 
   friend ostream & operator << (ostream & stream, const GEVGPool & pool);
+
+private:
+
+  mutable map<ULong64_t, GEVGDriver *> fKeyMap; ///< init state code (see InitialState::Key()) -> driver, for fast look-ups
 };
 
 }      // genie namespace
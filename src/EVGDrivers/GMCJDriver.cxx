@@ -91,11 +91,18 @@
    Fix small problem introduced with recent changes. 
    In PopulateEventGenDriverPool() calls to GEVGDriver::SetEventGeneratorList()
    and GEVGDriver::Configure() were reversed. Problem reported by W.Huelsnitz.
+ @ Oct 17, 2026 - agent
+   Speed up the flux neutrino pre-selection: The event generation drivers,
+   total cross section splines and probability scales for each (neutrino,
+   target) are now resolved once at Configure() and stored in flat look-up
+   tables, rather than being looked-up (via string keys and TH1D::FindBin)
+   for each flux neutrino and each material.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <algorithm>
 
 #include <TVector3.h>
 #include <TSystem.h>
@@ -123,6 +130,9 @@
 #include "Utils/XSecSplineList.h"
 #include "Conventions/Constants.h"
 
+using std::lower_bound;
+using std::sort;
+
 using namespace genie;
 using namespace genie::constants;
 
@@ -475,6 +485,11 @@ void GMCJDriver::Configure(bool calc_prob_scales)
   // for each possible initial state)
   this->BootstrapXSecSplineSummation();
 
+  // Store the event generation drivers and total cross section splines for
+  // each (neutrino, target) in flat look-up tables so as not to have to look 
+  // them up in the GEVGPool for every single flux neutrino
+  this->BuildXSecLookupTables();
+
   if(calc_prob_scales){
     // Ask the input geometry driver to compute the max. path length for each
     // material in the list of target materials (or load a precomputed list)
@@ -508,6 +523,15 @@ void GMCJDriver::InitJob(void)
 
   fGlobPmax           = 0;     // <-- maximum interaction probability (global prob scale)
   fPmax.clear();               // <-- maximum interaction probability per neutrino & per energy bin
+  fPmaxTbl.clear();            // <-- same, as a flat look-up table
+  fPmaxNBins          = 0;
+  fPmaxEmin           = 0;
+  fPmaxEmax           = 0;
+
+  fTgtCodes.clear();           // <-- look-up tables of (neutrino, target) drivers & total xsec splines
+  fDriverTbl.clear();
+  fXSecSumTbl.clear();
+  fTgtA.clear();
 
   fGenerateUnweighted = false; // <-- default opt to generate weighted events
   fPreSelect          = true;  // <-- default to use pre-selection based on maximum path lengths 
@@ -808,6 +832,115 @@ void GMCJDriver::ComputeProbScales(void)
   }
 
   LOG("GMCJDriver", pNOTICE) << "*** Probability scale = " << fGlobPmax;
+
+  this->BuildPmaxLookupTables();
+}
+//___________________________________________________________________________
+void GMCJDriver::BuildXSecLookupTables(void)
+{
+// Resolve the GEVGDriver and the total cross section spline for every
+// (neutrino, target) pair. Targets are sorted by PDG code, which is the
+// order in which they appear when iterating over a PathLengthList.
+
+  LOG("GMCJDriver", pNOTICE) 
+    << "Building (neutrino, target) event generation driver look-up tables";
+
+  fTgtCodes.assign(fTgtList.begin(), fTgtList.end());
+  sort(fTgtCodes.begin(), fTgtCodes.end());
+
+  int nnu  = fNuList.size();
+  int ntgt = fTgtCodes.size();
+
+  fTgtA.resize(ntgt);
+  for(int itgt = 0; itgt < ntgt; itgt++) {
+    fTgtA[itgt] = pdg::IonPdgCodeToA(fTgtCodes[itgt]);
+  }
+
+  fDriverTbl .assign(nnu*ntgt, (GEVGDriver *)   0);
+  fXSecSumTbl.assign(nnu*ntgt, (const Spline *) 0);
+
+  for(int inu = 0; inu < nnu; inu++) {
+    for(int itgt = 0; itgt < ntgt; itgt++) {
+      InitialState init_state(fTgtCodes[itgt], fNuList[inu]);
+      GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+      if(!evgdriver) {
+        LOG("GMCJDriver", pFATAL)
+          << "\n * The MC Job driver isn't properly configured!"
+          << "\n * No event generation driver could be found for init state: " 
+          << init_state.AsString();
+        exit(1);
+      }
+      const Spline * totxsecspl = evgdriver->XSecSumSpline();
+      if(!totxsecspl) {
+        LOG("GMCJDriver", pFATAL)
+          << "\n * The MC Job driver isn't properly configured!"
+          << "\n * Couldn't retrieve total cross section spline for init state: " 
+          << init_state.AsString();
+        exit(1);
+      }
+      fDriverTbl [inu*ntgt+itgt] = evgdriver;
+      fXSecSumTbl[inu*ntgt+itgt] = totxsecspl;
+    }
+  }
+}
+//___________________________________________________________________________
+void GMCJDriver::BuildPmaxLookupTables(void)
+{
+// Copy the contents (including under/overflow bins) of the probability scale
+// histograms into a flat array. All histograms have the same binning.
+
+  fPmaxTbl.clear();
+  fPmaxNBins = 0;
+  fPmaxEmin  = 0;
+  fPmaxEmax  = 0;
+
+  int nnu = fNuList.size();
+  for(int inu = 0; inu < nnu; inu++) {
+    map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(fNuList[inu]);
+    assert(pmax_iter != fPmax.end());
+    TH1D * pmax_hst = pmax_iter->second;
+    assert(pmax_hst);
+    if(inu == 0) {
+      fPmaxNBins = pmax_hst->GetNbinsX();
+      fPmaxEmin  = pmax_hst->GetXaxis()->GetXmin();
+      fPmaxEmax  = pmax_hst->GetXaxis()->GetXmax();
+      fPmaxTbl.assign(nnu*(fPmaxNBins+2), 0.);
+    }
+    for(int ie = 0; ie <= fPmaxNBins+1; ie++) {
+      fPmaxTbl[inu*(fPmaxNBins+2)+ie] = pmax_hst->GetBinContent(ie);
+    }
+  }
+}
+//___________________________________________________________________________
+int GMCJDriver::NuIndex(int nupdg) const
+{
+  int nnu = fNuList.size();
+  for(int inu = 0; inu < nnu; inu++) {
+    if(fNuList[inu] == nupdg) return inu;
+  }
+  return -1;
+}
+//___________________________________________________________________________
+int GMCJDriver::TgtIndex(int tgtpdg) const
+{
+  vector<int>::const_iterator it = 
+      lower_bound(fTgtCodes.begin(), fTgtCodes.end(), tgtpdg);
+  if(it == fTgtCodes.end() || *it != tgtpdg) return -1;
+  return (int) (it - fTgtCodes.begin());
+}
+//___________________________________________________________________________
+double GMCJDriver::Pmax(int inu, double Ev) const
+{
+// Same as fPmax[nu]->GetBinContent(fPmax[nu]->FindBin(Ev)) 
+
+  if(fPmaxTbl.size() == 0) return 0.;
+
+  int ie = 0;
+  if      (Ev < fPmaxEmin)    ie = 0;
+  else if (!(Ev < fPmaxEmax)) ie = fPmaxNBins+1;
+  else ie = 1 + int(fPmaxNBins*(Ev-fPmaxEmin)/(fPmaxEmax-fPmaxEmin));
+
+  return fPmaxTbl[inu*(fPmaxNBins+2)+ie];
 }
 //___________________________________________________________________________
 void GMCJDriver::InitEventGeneration(void)
@@ -1095,61 +1228,56 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
   // current flux neutrino code & 4-p
   int                    nupdg = fFluxDriver->PdgCode();
   const TLorentzVector & nup4  = fFluxDriver->Momentum();
+  double                 Ev    = nup4.Energy();
 
   fCurCumulProbMap.clear();
 
   const PathLengthList & path_length_list = 
         (use_max_path_length) ? fMaxPathLengths : fCurPathLengths;
 
+  int inu  = this->NuIndex(nupdg);
+  int ntgt = fTgtCodes.size();
+  if(inu < 0) {
+     LOG("GMCJDriver", pFATAL)
+        << "\n * The MC Job driver isn't properly configured!"
+        << "\n * It can not handle flux neutrinos with pdg code = " << nupdg;
+     exit(1);
+  }
+
+  // scale the interaction probabilities to the maximum one so as not
+  // to have to throw few billions of flux neutrinos before getting
+  // an interaction...
+  double pmax = (fGenerateUnweighted) ? fGlobPmax : this->Pmax(inu,Ev);
+
   double probsum=0;
   PathLengthList::const_iterator pliter;
 
+  int itgt = 0;
   for(pliter = path_length_list.begin();
-                            pliter != path_length_list.end(); ++pliter) {
+                            pliter != path_length_list.end(); ++pliter, ++itgt) {
      int    mpdg  = pliter->first;            // material PDG code
      double pl    = pliter->second;           // density x path-length
-     int    A     = pdg::IonPdgCodeToA(mpdg);
      double xsec  = 0.;                       // sum of xsecs for all modelled processes for given init state
      double prob  = 0.;                       // interaction probability
      double probn = 0.;                       // normalized interaction probability
 
-     // find the GEVGDriver object that is handling the current init state
-     InitialState init_state(mpdg, nupdg);
-     GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-     if(!evgdriver) {
-       LOG("GMCJDriver", pFATAL)
-        << "\n * The MC Job driver isn't properly configured!"
-        << "\n * No event generation driver could be found for init state: " 
-        << init_state.AsString();
-       exit(1);
+     // find the look-up table entry for the current init state
+     // (path length lists normally hold all targets in the same order)
+     if(itgt >= ntgt || fTgtCodes[itgt] != mpdg) {
+       itgt = this->TgtIndex(mpdg);
+       if(itgt < 0) {
+         InitialState init_state(mpdg, nupdg);
+         LOG("GMCJDriver", pFATAL)
+          << "\n * The MC Job driver isn't properly configured!"
+          << "\n * No event generation driver could be found for init state: " 
+          << init_state.AsString();
+         exit(1);
+       }
      }
      // compute the interaction xsec and probability (if path-length>0)
      if(pl>0.) {
-        const Spline * totxsecspl = evgdriver->XSecSumSpline();
-        if(!totxsecspl) {
-            LOG("GMCJDriver", pFATAL)
-              << "\n * The MC Job driver isn't properly configured!"
-              << "\n * Couldn't retrieve total cross section spline for init state: " 
-              << init_state.AsString();
-            exit(1);
-        } else {
-            xsec = totxsecspl->Evaluate( nup4.Energy() );
-        }
-        prob = this->InteractionProbability(xsec,pl,A);
-
-        // scale the interaction probability to the maximum one so as not
-        // to have to throw few billions of flux neutrinos before getting
-        // an interaction...
-        double pmax = 0;
-        if(fGenerateUnweighted) pmax = fGlobPmax;
-        else {
-           map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nupdg);
-           assert(pmax_iter != fPmax.end());
-           TH1D * pmax_hst = pmax_iter->second;
-           assert(pmax_hst);
-           int    ie   = pmax_hst->FindBin(nup4.Energy());
-           pmax = pmax_hst->GetBinContent(ie);
-        }
+        xsec  = fXSecSumTbl[inu*ntgt+itgt]->Evaluate(Ev);
+        prob  = this->InteractionProbability(xsec,pl,fTgtA[itgt]);
         assert(pmax>0);        
         probn = prob/pmax;
      }
@@ -1194,9 +1322,14 @@ void GMCJDriver::GenerateEventKinematics(void)
 
   // Find the GEVGDriver object that generates interactions for the
   // given initial state (neutrino + target)
-  InitialState init_state(fSelTgtPdg, nupdg);
-  GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+  int inu  = this->NuIndex(nupdg);
+  int itgt = this->TgtIndex(fSelTgtPdg);
+  GEVGDriver * evgdriver = 0;
+  if(inu >= 0 && itgt >= 0) {
+     evgdriver = fDriverTbl[inu*fTgtCodes.size()+itgt];
+  }
   if(!evgdriver) {
+     InitialState init_state(fSelTgtPdg, nupdg);
      LOG("GMCJDriver", pFATAL)
        << "No GEVGDriver object for init state: " << init_state.AsString();
      exit(1);
@@ -1266,11 +1399,9 @@ void GMCJDriver::ComputeEventProbability(void)
  
   double weight = 1.0;
   if(!fGenerateUnweighted) {
-     map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nu_pdg);
-     assert(pmax_iter != fPmax.end());
-     TH1D * pmax_hst = pmax_iter->second;
-     assert(pmax_hst);
-     double pmax = pmax_hst->GetBinContent(pmax_hst->FindBin(Ev));
+     int inu = this->NuIndex(nu_pdg);
+     assert(inu >= 0);
+     double pmax = this->Pmax(inu,Ev);
      assert(pmax>0);
      weight = pmax/fGlobPmax;
   }
@@ -1280,7 +1411,7 @@ void GMCJDriver::ComputeEventProbability(void)
   fCurEvt->SetWeight(weight * fCurEvt->Weight());
 }
 //___________________________________________________________________________
-double GMCJDriver::InteractionProbability(double xsec, double pL, int A)
+double GMCJDriver::InteractionProbability(double xsec, double pL, int A) const
 {
 // P = Na   (Avogadro number,                 atoms/mole) *
 //     1/A  (1/mass number,                   mole/gr)    *
@@ -23,6 +23,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include <TH1D.h>
 #include <TLorentzVector.h>
@@ -35,6 +36,7 @@
 
 using std::string;
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -43,6 +45,8 @@ class GFluxI;
 class GeomAnalyzerI;
 class GENIE;
 class GEVGPool;
+class GEVGDriver;
+class Spline;
 
 class GMCJDriver {
 
@@ -91,6 +95,11 @@ private:
   void          BootstrapXSecSplines            (void);
   void          BootstrapXSecSplineSummation    (void);
   void          ComputeProbScales               (void);
+  void          BuildXSecLookupTables           (void);
+  void          BuildPmaxLookupTables           (void);
+  int           NuIndex                         (int nupdg)  const;
+  int           TgtIndex                        (int tgtpdg) const;
+  double        Pmax                            (int inu, double Ev) const;
   EventRecord * GenerateEvent1Try               (void);
   bool          GenerateFluxNeutrino            (void);
   bool          ComputePathLengths              (void);
@@ -99,7 +108,7 @@ private:
   void          GenerateEventKinematics         (void);
   void          GenerateVertexPosition          (void);
   void          ComputeEventProbability         (void);
-  double        InteractionProbability          (double xsec, double pl, int A);
+  double        InteractionProbability          (double xsec, double pl, int A) const;
   double        PreGenFluxInteractionProbability(void);
 
   // private data members:
@@ -118,6 +127,14 @@ private:
   double          fNFluxNeutrinos;     ///< [current] number of flux nuetrinos fired by the flux driver so far 
   map<int,TH1D*>  fPmax;               ///< [computed at init] interaction probability scale /neutrino /energy for given geometry
   double          fGlobPmax;           ///< [computed at init] global interaction probability scale for given flux & geometry
+  vector<int>     fTgtCodes;           ///< [computed at init] sorted target codes (same order as in a PathLengthList)
+  vector<GEVGDriver *>   fDriverTbl;   ///< [computed at init] event generation driver for each (neutrino, target); index = inu*ntgt+itgt
+  vector<const Spline *> fXSecSumTbl;  ///< [computed at init] total cross section spline for each (neutrino, target); index = inu*ntgt+itgt
+  vector<int>     fTgtA;               ///< [computed at init] mass number for each target
+  vector<double>  fPmaxTbl;            ///< [computed at init] contents of the fPmax histograms; index = inu*(nbins+2)+ibin
+  int             fPmaxNBins;          ///< [computed at init] number of bins in the fPmax histograms
+  double          fPmaxEmin;           ///< [computed at init] lower energy edge of the fPmax histograms
+  double          fPmaxEmax;           ///< [computed at init] upper energy edge of the fPmax histograms
   string          fEventGenList;       ///< [config] list of event generators loaded by this driver (what used to be the $GEVGL setting)
   TBits *         fUnphysEventMask;    ///< [config] controls whether unphysical events are returned (what used to be the $GUNPHYSMASK setting)
   string          fMaxPlXmlFilename;   ///< [config] input file with max density-weighted path lengths for all materials
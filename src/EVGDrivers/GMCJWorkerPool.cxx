@@ -0,0 +1,206 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TSystem.h>
+#include <TMath.h>
+#include <TRandom.h>
+#include <TPythia6.h>
+
+#include "EVGDrivers/GMCJWorkerPool.h"
+#include "Messenger/Messenger.h"
+#include "Ntuple/NtpWriter.h"
+#include "Numerical/RandomGen.h"
+
+using std::ostringstream;
+using std::cout;
+using std::cerr;
+
+using namespace genie;
+
+//____________________________________________________________________________
+GMCJWorkerPool::GMCJWorkerPool(int nworkers) :
+fNWorkers(TMath::Max(1,nworkers))
+{
+  fSeed = RandomGen::Instance()->GetSeed();
+
+  // name the worker files after the parent pid so that several parallel
+  // jobs running from the same directory do not interfere
+  int ppid = gSystem->GetPid();
+  for(int iw = 0; iw < fNWorkers; iw++) {
+    ostringstream filename;
+    filename << "genie-mcjob-" << ppid << ".worker" << iw << ".root";
+    fWorkerFiles.push_back(filename.str());
+  }
+}
+//____________________________________________________________________________
+GMCJWorkerPool::~GMCJWorkerPool()
+{
+
+}
+//____________________________________________________________________________
+string GMCJWorkerPool::WorkerFilename(int iworker) const
+{
+  if(iworker < 0 || iworker >= fNWorkers) return "";
+  return fWorkerFiles[iworker];
+}
+//____________________________________________________________________________
+bool GMCJWorkerPool::Run(GMCJWorkerFunc_t func)
+{
+  if(!func) {
+    LOG("GMCJWorkerPool", pERROR) << "No worker function was specified!";
+    return false;
+  }
+
+  LOG("GMCJWorkerPool", pNOTICE)
+     << "Starting " << fNWorkers << " event generation worker processes";
+
+  // flush all output before forking so that it is not duplicated
+  cout.flush();
+  cerr.flush();
+  fflush(0);
+
+  vector<pid_t> pids;
+  for(int iw = 0; iw < fNWorkers; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("GMCJWorkerPool", pFATAL)
+        << "Failed to fork event generation worker: " << iw;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(pid == 0) {
+      // worker process:
+      // The GENIE random number streams keep the job seed: they are
+      // positioned by (run, event number) so that each event is identical
+      // to the one generated by a single process. Only the stateful
+      // generators (ROOT's gRandom & PYTHIA6) get an independent seed.
+      long int wseed = GMCJWorkerPool::Seed(fSeed,iw);
+      gRandom->SetSeed(wseed);
+      TPythia6::Instance()->SetMRPY(1, wseed);
+      LOG("GMCJWorkerPool", pINFO)
+        << "Worker " << iw << ": gRandom / PYTHIA6 seed = " << wseed;
+      func(iw, fNWorkers, fWorkerFiles[iw]);
+      cout.flush();
+      cerr.flush();
+      fflush(0);
+      // skip static destructors: singletons are owned by the parent
+      // (eg the Cache must not be written out by every worker)
+      _exit(0);
+    }
+    LOG("GMCJWorkerPool", pINFO)
+      << "Started worker " << iw << " (pid: " << pid << ")";
+    pids.push_back(pid);
+  }
+
+  // parent process: wait for all workers
+  bool ok = true;
+  for(int iw = 0; iw < fNWorkers; iw++) {
+    int status = 0;
+    waitpid(pids[iw], &status, 0);
+    bool worker_ok = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+    if(!worker_ok) {
+      LOG("GMCJWorkerPool", pERROR)
+        << "Worker " << iw << " (pid: " << pids[iw] << ") failed!";
+    }
+    ok = ok && worker_ok;
+  }
+
+  LOG("GMCJWorkerPool", pNOTICE) << "All workers have finished";
+
+  return ok;
+}
+//____________________________________________________________________________
+bool GMCJWorkerPool::MergeOutputs(NtpWriter & ntpw)
+{
+  TTree * out_tree = ntpw.EventTree();
+  if(!out_tree) {
+    LOG("GMCJWorkerPool", pERROR)
+      << "The output ntuple writer has not been initialized!";
+    return false;
+  }
+
+  bool ok = true;
+  for(int iw = 0; iw < fNWorkers; iw++) {
+    const char * filename = fWorkerFiles[iw].c_str();
+    TFile inp_file(filename, "READ");
+    TTree * inp_tree = 0;
+    if(inp_file.IsOpen()) {
+      inp_tree = dynamic_cast<TTree *> (inp_file.Get("gtree"));
+    }
+    if(!inp_tree) {
+      LOG("GMCJWorkerPool", pERROR)
+        << "Couldn't read the event tree written by worker " << iw
+        << " in file: " << filename;
+      ok = false;
+      continue;
+    }
+    Long64_t nev = out_tree->CopyEntries(inp_tree, -1, "fast");
+
+    LOG("GMCJWorkerPool", pNOTICE)
+      << "Merged " << nev << " events from worker " << iw;
+
+    inp_file.Close();
+    gSystem->Unlink(filename);
+  }
+  return ok;
+}
+//____________________________________________________________________________
+int GMCJWorkerPool::NEvents(int nev, int iworker, int nworkers)
+{
+  int n = nev / nworkers;
+  if(iworker < nev % nworkers) n++;
+  return n;
+}
+//____________________________________________________________________________
+int GMCJWorkerPool::FirstEvent(int nev, int iworker, int nworkers)
+{
+  int first = 0;
+  for(int iw = 0; iw < iworker; iw++) {
+    first += GMCJWorkerPool::NEvents(nev, iw, nworkers);
+  }
+  return first;
+}
+//____________________________________________________________________________
+long int GMCJWorkerPool::Seed(long int seed, int iworker)
+{
+// Seed for the stateful generators (gRandom, PYTHIA6) of a worker process.
+// Worker seeds are obtained by scrambling (seed, worker id) rather than by
+// simply offsetting the job seed, so that jobs run with consecutive seeds do
+// not end up sharing random number sequences.
+//
+  ULong64_t z = (ULong64_t) seed + 
+                0x9E3779B97F4A7C15ULL * (ULong64_t) (iworker + 1);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z =  z ^ (z >> 31);
+
+  // gRandom is a TRandom3, which interprets a 0 seed as a request for a
+  // time-based (non-reproducible) seed
+  long int wseed = (long int) (z & 0x7FFFFFFFULL);
+  if(wseed == 0) wseed = seed + iworker + 1;
+  return wseed;
+}
+//____________________________________________________________________________
@@ -0,0 +1,86 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GMCJWorkerPool
+
+\brief    Runs a GENIE MC job on several worker processes.
+          The worker processes are forked once the parent has been fully
+          configured (splines loaded or bootstrapped, GEVGDriver pool created,
+          geometry loaded and probability scales computed). All that read-only
+          state is therefore shared by the workers (copy-on-write pages) and
+          is not re-loaded / re-computed by each of them.
+          Each worker gets its own event number range and writes its own
+          event file, while keeping its own copy of all the (mutable) event
+          generation state: event record, path-length lists, algorithm
+          caches etc.
+          The GENIE random number streams (see RandomGen) keep the job seed
+          and are positioned by the event number, so the events do not depend
+          on the number of workers. Only the stateful generators (ROOT's
+          gRandom and PYTHIA6) are given a different seed in each worker.
+          The worker event files are merged in a single GHEP event tree once
+          all workers have finished.
+
+          Separate processes rather than threads are used on purpose: The
+          GENIE event generation code relies on singletons (RandomGen, Cache,
+          XSecSplineList, AlgFactory, ...) and on mutable state held by the
+          physics algorithms which can not be safely shared between threads.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_MC_JOB_WORKER_POOL_H_
+#define _G_MC_JOB_WORKER_POOL_H_
+
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class NtpWriter;
+
+//! Function executed by each worker process.
+//! It is passed the worker id (0...nworkers-1), the number of workers and
+//! the name of the event file the worker is expected to write-out.
+typedef void (*GMCJWorkerFunc_t) (int iworker, int nworkers, string filename);
+
+class GMCJWorkerPool {
+
+public :
+  GMCJWorkerPool(int nworkers = 1);
+ ~GMCJWorkerPool();
+
+  // run the input function on all workers and wait till they have all finished
+  bool Run (GMCJWorkerFunc_t func);
+
+  // merge the worker event files into the tree of the input (initialized)
+  // ntuple writer & remove the worker files
+  bool MergeOutputs (NtpWriter & ntpw);
+
+  int    NWorkers       (void)        const { return fNWorkers; }
+  string WorkerFilename (int iworker) const;
+
+  // split of work between workers
+  static int      NEvents    (int nev, int iworker, int nworkers);
+  static int      FirstEvent (int nev, int iworker, int nworkers);
+  static long int Seed       (long int seed, int iworker);
+
+private:
+
+  int            fNWorkers;     ///< number of worker processes
+  long int       fSeed;         ///< job random number seed (workers derive their gRandom / PYTHIA6 seeds from that)
+  vector<string> fWorkerFiles;  ///< names of event files written by the workers
+};
+
+}      // genie namespace
+
+#endif // _G_MC_JOB_WORKER_POOL_H_
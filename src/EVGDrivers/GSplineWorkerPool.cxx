@@ -0,0 +1,314 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <utility>
+
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
+
+#include <TLorentzVector.h>
+#include <TStopwatch.h>
+#include <TMath.h>
+
+#include "Base/XSecAlgorithmI.h"
+#include "Conventions/Units.h"
+#include "EVGDrivers/GSplineWorkerPool.h"
+#include "Interaction/Interaction.h"
+#include "Messenger/Messenger.h"
+#include "Utils/XSecSplineList.h"
+
+using std::cout;
+using std::cerr;
+using std::endl;
+using std::setw;
+using std::setprecision;
+using std::pair;
+using std::sort;
+
+using namespace genie;
+
+//____________________________________________________________________________
+GSplineWorkerPool::GSplineWorkerPool(int nworkers) :
+fNWorkers   (TMath::Max(1,nworkers)),
+fNItems     (0),
+fShared     (0),
+fSharedSize (0),
+fXSec       (0),
+fCpuTime    (0),
+fCounters   (0)
+{
+
+}
+//____________________________________________________________________________
+GSplineWorkerPool::~GSplineWorkerPool()
+{
+  for(unsigned int ispl = 0; ispl < fInteractions.size(); ispl++) {
+    delete fInteractions[ispl];
+  }
+  if(fShared) munmap(fShared, fSharedSize);
+}
+//____________________________________________________________________________
+void GSplineWorkerPool::AddSpline(const XSecAlgorithmI * alg,
+        const Interaction * interaction, int nknots, double Emin, double Emax)
+{
+  XSecSplineList * xsl = XSecSplineList::Instance();
+
+  string key = xsl->BuildSplineKey(alg, interaction);
+  if(xsl->SplineExists(key) ||
+     std::find(fKeys.begin(), fKeys.end(), key) != fKeys.end())
+  {
+    LOG("GSplineWorkerPool", pDEBUG) << "Spline was already queued: " << key;
+    return;
+  }
+
+  // start a new initial state?
+  int ispl = fKeys.size();
+  bool new_init_state = (ispl == 0);
+  if(!new_init_state) {
+    const InitialState & prev = fInteractions[ispl-1]->InitState();
+    const InitialState & curr = interaction->InitState();
+    new_init_state = (prev.ProbePdg() != curr.ProbePdg()) ||
+                     (prev.TgtPdg()   != curr.TgtPdg()  );
+  }
+  if(new_init_state) fFirstSpline.push_back(ispl);
+
+  vector<double> E;
+  xsl->SplineKnots(interaction, nknots, Emin, Emax, E);
+
+  fAlgs        .push_back(alg);
+  fInteractions.push_back(new Interaction(*interaction));
+  fKeys        .push_back(key);
+  fKnots       .push_back(E);
+  fFirstItem   .push_back(fNItems);
+
+  fNItems += E.size();
+
+  LOG("GSplineWorkerPool", pINFO)
+    << "Queued spline: " << key << " (" << E.size() << " knots)";
+}
+//____________________________________________________________________________
+bool GSplineWorkerPool::Run(void)
+{
+  int nspl  = this->NSplines();
+  int nstat = fFirstSpline.size();
+  if(nspl == 0) return true;
+
+  LOG("GSplineWorkerPool", pNOTICE)
+     << "Computing " << nspl << " splines (" << fNItems << " knots, "
+     << nstat << " initial states) using " << fNWorkers << " worker(s)";
+
+  // shared results & work queue
+  if(fShared) munmap(fShared, fSharedSize);
+  fSharedSize = 2 * fNItems * sizeof(double) + 2 * nstat * sizeof(long int);
+  fShared = mmap(0, fSharedSize,
+                 PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if(fShared == MAP_FAILED) {
+    LOG("GSplineWorkerPool", pERROR) << "Couldn't allocate shared memory!";
+    fShared = 0;
+    return false;
+  }
+  fXSec     = (double *)   fShared;
+  fCpuTime  = fXSec    + fNItems;
+  fCounters = (long int *) (fCpuTime + fNItems);
+  for(int i = 0; i < 2*nstat; i++) fCounters[i] = 0;
+
+  bool ok = true;
+
+  if(fNWorkers == 1) {
+    this->Work();
+  }
+  else {
+    // flush all output before forking so that it is not duplicated
+    cout.flush();
+    cerr.flush();
+    fflush(0);
+
+    vector<pid_t> pids;
+    for(int iw = 0; iw < fNWorkers; iw++) {
+      pid_t pid = fork();
+      if(pid < 0) {
+        LOG("GSplineWorkerPool", pFATAL)
+          << "Failed to fork spline worker: " << iw;
+        gAbortingInErr = true;
+        exit(1);
+      }
+      if(pid == 0) {
+        this->Work();
+        cout.flush();
+        cerr.flush();
+        fflush(0);
+        // skip static destructors: singletons are owned by the parent
+        _exit(0);
+      }
+      LOG("GSplineWorkerPool", pINFO)
+        << "Started worker " << iw << " (pid: " << pid << ")";
+      pids.push_back(pid);
+    }
+
+    // wait for all workers - if one fails, the others would wait forever
+    // for its knots so stop them all
+    vector<bool> running(fNWorkers, true);
+    for(int nrunning = fNWorkers; nrunning > 0; nrunning--) {
+      int status = 0;
+      pid_t pid = waitpid(-1, &status, 0);
+      if(pid < 0) break;
+      int iw = std::find(pids.begin(), pids.end(), pid) - pids.begin();
+      if(iw < fNWorkers) running[iw] = false;
+      bool worker_ok = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+      if(!worker_ok && ok) {
+        LOG("GSplineWorkerPool", pERROR)
+          << "Worker " << iw << " (pid: " << pid << ") failed! Stopping all workers";
+        for(int jw = 0; jw < fNWorkers; jw++) {
+          if(running[jw]) kill(pids[jw], SIGKILL);
+        }
+      }
+      ok = ok && worker_ok;
+    }
+  }
+
+  if(!ok) return false;
+
+  // add splines to the list in the order they were queued
+  for(int ispl = 0; ispl < nspl; ispl++) {
+    this->BuildSpline(ispl);
+  }
+
+  LOG("GSplineWorkerPool", pNOTICE) << "All splines have been computed";
+
+  return true;
+}
+//____________________________________________________________________________
+void GSplineWorkerPool::Work(void)
+{
+  int nspl  = this->NSplines();
+  int nstat = fFirstSpline.size();
+
+  for(int istat = 0; istat < nstat; istat++) {
+    int      spl_begin  = fFirstSpline[istat];
+    int      spl_end    = (istat+1 < nstat) ? fFirstSpline[istat+1] : nspl;
+    long int item_begin = fFirstItem[spl_begin];
+    long int item_end   = (spl_end < nspl) ? fFirstItem[spl_end] : fNItems;
+    long int nitems     = item_end - item_begin;
+
+    long int * next = &fCounters[2*istat  ];
+    long int * done = &fCounters[2*istat+1];
+
+    while(1) {
+      long int i = __sync_fetch_and_add(next, 1);
+      if(i >= nitems) break;
+      this->Compute(item_begin + i);
+      __sync_fetch_and_add(done, 1);
+    }
+
+    // last initial state? - the parent builds the splines
+    if(istat == nstat-1) break;
+
+    // wait for the other workers & build the splines of this initial state,
+    // which may be used when computing the cross sections of the next ones
+    while(__sync_fetch_and_add(done, 0) < nitems) usleep(1000);
+    for(int ispl = spl_begin; ispl < spl_end; ispl++) {
+      this->BuildSpline(ispl);
+    }
+  }
+}
+//____________________________________________________________________________
+void GSplineWorkerPool::Compute(long int item)
+{
+  int ispl  = this->SplineOf(item);
+  int iknot = item - fFirstItem[ispl];
+
+  Interaction * interaction = fInteractions[ispl];
+  double        E           = fKnots[ispl][iknot];
+
+  TStopwatch timer;
+  timer.Start();
+
+  TLorentzVector p4(0,0,E,E);
+  interaction->InitStatePtr()->SetProbeP4(p4);
+  double xsec = fAlgs[ispl]->Integral(interaction);
+
+  timer.Stop();
+
+  fXSec   [item] = xsec;
+  fCpuTime[item] = timer.CpuTime();
+
+  SLOG("GSplineWorkerPool", pNOTICE)
+     << fKeys[ispl] << ": xsec(E = " << E << ") = "
+     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2 ["
+     << fCpuTime[item] << " s]";
+}
+//____________________________________________________________________________
+void GSplineWorkerPool::BuildSpline(int ispl)
+{
+  XSecSplineList * xsl = XSecSplineList::Instance();
+  if(xsl->SplineExists(fKeys[ispl])) return;
+
+  long int first = fFirstItem[ispl];
+  long int n     = fKnots[ispl].size();
+  vector<double> xsec(fXSec + first, fXSec + first + n);
+
+  xsl->CreateSpline(fAlgs[ispl], fInteractions[ispl], fKnots[ispl], xsec);
+}
+//____________________________________________________________________________
+int GSplineWorkerPool::SplineOf(long int item) const
+{
+  vector<long int>::const_iterator it =
+     std::upper_bound(fFirstItem.begin(), fFirstItem.end(), item);
+  return (it - fFirstItem.begin()) - 1;
+}
+//____________________________________________________________________________
+void GSplineWorkerPool::PrintTiming(ostream & stream) const
+{
+  if(!fCpuTime) return;
+
+  int nspl = this->NSplines();
+
+  // splines sorted by CPU time
+  vector< pair<double,int> > cpu(nspl);
+  double cpu_total = 0;
+  for(int ispl = 0; ispl < nspl; ispl++) {
+    double t = 0;
+    for(unsigned int iknot = 0; iknot < fKnots[ispl].size(); iknot++) {
+      t += fCpuTime[fFirstItem[ispl] + iknot];
+    }
+    cpu[ispl] = pair<double,int>(-t, ispl);
+    cpu_total += t;
+  }
+  sort(cpu.begin(), cpu.end());
+
+  stream << "\n CPU time per spline (total: " << cpu_total << " s):";
+  stream << "\n  " << setw(12) << "CPU [s]" << setw(15) << "slowest knot"
+         << setw(12) << "at E [GeV]" << "  spline";
+  for(int i = 0; i < nspl; i++) {
+    int ispl = cpu[i].second;
+    long int first = fFirstItem[ispl];
+    long int n     = fKnots[ispl].size();
+    long int islow = std::max_element(fCpuTime + first, fCpuTime + first + n) - fCpuTime;
+    stream << "\n  " << setw(12) << setprecision(4) << -cpu[i].first
+           << setw(15) << setprecision(4) << fCpuTime[islow]
+           << setw(12) << setprecision(4) << fKnots[ispl][islow-first]
+           << "  " << fKeys[ispl];
+  }
+  stream << "\n";
+}
+//____________________________________________________________________________
@@ -0,0 +1,99 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GSplineWorkerPool
+
+\brief    Computes cross section splines on several worker processes.
+          Splines are queued with AddSpline() (see GEVGDriver::QueueSplines())
+          and computed with Run(). The unit of work is a single knot of a
+          single spline, so that the load is balanced even if only a few
+          (expensive) splines are needed. Workers pick knots dynamically from
+          a queue kept in shared memory and write the computed cross sections
+          in a shared array. Once all workers have finished, the splines are
+          added to the XSecSplineList in the order they were queued.
+
+          Every spline is computed at exactly the same knots, and using the
+          same cross section algorithm calls, as in XSecSplineList::
+          CreateSpline(), so the output is identical to the serial one.
+          Some cross section algorithms use, if available, the free-nucleon
+          splines in the XSecSplineList when computing nuclear cross sections.
+          In order to see the same splines as a serial job would, splines are
+          computed one initial state at a time: The workers build all the
+          splines of an initial state locally before moving to the next one.
+
+          Separate processes rather than threads are used because the cross
+          section algorithms are not thread-safe (see GMCJWorkerPool).
+          For each spline, the CPU time spent in each knot is recorded and
+          reported once all splines are computed.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_SPLINE_WORKER_POOL_H_
+#define _G_SPLINE_WORKER_POOL_H_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+using std::ostream;
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class XSecAlgorithmI;
+class Interaction;
+
+class GSplineWorkerPool {
+
+public :
+  GSplineWorkerPool(int nworkers = 1);
+ ~GSplineWorkerPool();
+
+  // queue a spline (see XSecSplineList::CreateSpline() for the arguments)
+  void AddSpline (const XSecAlgorithmI * alg, const Interaction * interaction,
+                  int nknots = -1, double Emin = -1, double Emax = -1);
+
+  // compute all queued splines & add them to the XSecSplineList
+  bool Run (void);
+
+  // CPU time spent per spline (after Run())
+  void PrintTiming (ostream & stream) const;
+
+  int NWorkers (void) const { return fNWorkers; }
+  int NSplines (void) const { return fKeys.size(); }
+  int NKnots   (void) const { return fNItems; }
+
+private:
+
+  void Work        (void);
+  void Compute     (long int item);
+  void BuildSpline (int ispl);
+  int  SplineOf    (long int item) const;
+
+  int                            fNWorkers;      ///< number of worker processes
+  vector<const XSecAlgorithmI *> fAlgs;          ///< cross section algorithm, per spline
+  vector<Interaction *>          fInteractions;  ///< interaction (owned copy), per spline
+  vector<string>                 fKeys;          ///< spline key, per spline
+  vector< vector<double> >       fKnots;         ///< knot energies, per spline
+  vector<long int>               fFirstItem;     ///< index of first knot in the work queue, per spline
+  vector<int>                    fFirstSpline;   ///< first spline of each initial state
+  long int                       fNItems;        ///< total number of knots
+  void *                         fShared;        ///< shared memory: xsec, cpu time & queue counters
+  long int                       fSharedSize;    ///< size of shared memory
+  double *                       fXSec;          ///< computed xsec, per knot (in shared memory)
+  double *                       fCpuTime;       ///< CPU time, per knot (in shared memory)
+  long int *                     fCounters;      ///< (next knot, knots done), per initial state (in shared memory)
+};
+
+}      // genie namespace
+
+#endif // _G_SPLINE_WORKER_POOL_H_
@@ -13,5 +13,7 @@
 #pragma link C++ class genie::GFluxI;
 #pragma link C++ class genie::GeomAnalyzerI;
 #pragma link C++ class genie::GMCJMonitor;
+#pragma link C++ class genie::GMCJWorkerPool;
+#pragma link C++ class genie::GSplineWorkerPool;
 
 #endif
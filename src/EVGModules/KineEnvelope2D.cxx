@@ -0,0 +1,101 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+#include <cassert>
+
+#include <TMath.h>
+
+#include "EVGModules/KineEnvelope2D.h"
+#include "Numerical/RandomGen.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+KineEnvelope2D::KineEnvelope2D(unsigned int nu, unsigned int nv) :
+fNu(TMath::Max(nu,1u)),
+fNv(TMath::Max(nv,1u))
+{
+  fCellMax.assign(fNu*fNv, 0.);
+  fCellSum.assign(fNu*fNv, 0.);
+}
+//____________________________________________________________________________
+KineEnvelope2D::~KineEnvelope2D()
+{
+
+}
+//____________________________________________________________________________
+double KineEnvelope2D::Integral(void) const
+{
+  return fCellSum.back() / fCellSum.size();
+}
+//____________________________________________________________________________
+bool KineEnvelope2D::IsValid(void) const
+{
+  return (fCellSum.back() > 0);
+}
+//____________________________________________________________________________
+void KineEnvelope2D::SetCellMax(unsigned int icell, double max)
+{
+  assert(icell < fCellMax.size());
+  fCellMax[icell] = TMath::Max(0., max);
+}
+//____________________________________________________________________________
+void KineEnvelope2D::Finalize(double min_fraction)
+{
+  double max = *std::max_element(fCellMax.begin(), fCellMax.end());
+  double floor = TMath::Max(0., min_fraction) * max;
+  for(unsigned int icell = 0; icell < fCellMax.size(); icell++) {
+    fCellMax[icell] = TMath::Max(fCellMax[icell], floor);
+  }
+  this->BuildCumulative();
+}
+//____________________________________________________________________________
+unsigned int KineEnvelope2D::Generate(double & u, double & v) const
+{
+  RandomGen * rnd = RandomGen::Instance();
+
+  // select a cell
+  double R = fCellSum.back() * rnd->RndKine().Rndm();
+  unsigned int icell = 
+     std::upper_bound(fCellSum.begin(), fCellSum.end(), R) - fCellSum.begin();
+  icell = TMath::Min(icell, (unsigned int)fCellSum.size()-1);
+
+  // and a point within the cell
+  unsigned int iu = icell / fNv;
+  unsigned int iv = icell % fNv;
+  u = (iu + rnd->RndKine().Rndm()) / fNu;
+  v = (iv + rnd->RndKine().Rndm()) / fNv;
+
+  return icell;
+}
+//____________________________________________________________________________
+void KineEnvelope2D::Raise(unsigned int icell, double max)
+{
+  assert(icell < fCellMax.size());
+  if(max <= fCellMax[icell]) return;
+  fCellMax[icell] = max;
+  this->BuildCumulative();
+}
+//____________________________________________________________________________
+void KineEnvelope2D::BuildCumulative(void)
+{
+  double sum = 0;
+  for(unsigned int icell = 0; icell < fCellMax.size(); icell++) {
+    sum += fCellMax[icell];
+    fCellSum[icell] = sum;
+  }
+}
+//____________________________________________________________________________
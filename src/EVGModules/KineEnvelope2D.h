@@ -0,0 +1,76 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::KineEnvelope2D
+
+\brief    A piecewise-constant, adaptive envelope of a 2-D differential cross
+          section, used for importance sampling in the rejection method.
+          The envelope is defined on the unit square (the kinematic
+          generators map it onto the allowed phase space of the event at
+          hand) which is divided into Nu x Nv cells of equal area. Each cell
+          holds an upper bound of the differential cross section in that
+          cell. Candidates are generated by selecting a cell with probability
+          proportional to its bound and then a point uniformly within the
+          cell, and they are accepted with probability xsec / (cell bound).
+          If a cell bound is found to be exceeded, it is raised (the envelope
+          adapts to the cross section as events get generated).
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _KINE_ENVELOPE_2D_H_
+#define _KINE_ENVELOPE_2D_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class KineEnvelope2D {
+
+public:
+  KineEnvelope2D(unsigned int nu, unsigned int nv);
+ ~KineEnvelope2D();
+
+  unsigned int NCellsU  (void) const { return fNu; }
+  unsigned int NCellsV  (void) const { return fNv; }
+  unsigned int NCells   (void) const { return fNu*fNv; }
+  unsigned int Cell     (unsigned int iu, unsigned int iv) const { return iu*fNv + iv; }
+  double       CellMax  (unsigned int icell) const { return fCellMax[icell]; }
+  double       Integral (void) const; ///< sum of the cell bounds over the number of cells
+  bool         IsValid  (void) const; ///< has a non-zero bound?
+
+  //! set the bound of a cell (before calling Finalize())
+  void SetCellMax (unsigned int icell, double max);
+
+  //! set the bound of each cell to at least the input fraction of the largest
+  //! bound (so that no part of the phase space is excluded) and build the
+  //! cumulative table used for cell selection
+  void Finalize (double min_fraction);
+
+  //! generate a point (u,v) in the unit square. The selected cell is returned.
+  unsigned int Generate (double & u, double & v) const;
+
+  //! raise the bound of the input cell to the input value
+  void Raise (unsigned int icell, double max);
+
+private:
+  void BuildCumulative (void);
+
+  unsigned int   fNu;       ///< number of cells along u
+  unsigned int   fNv;       ///< number of cells along v
+  vector<double> fCellMax;  ///< cross section bound, per cell
+  vector<double> fCellSum;  ///< cumulative sum of the cell bounds
+};
+
+}      // genie namespace
+
+#endif // _KINE_ENVELOPE_2D_H_
@@ -15,7 +15,18 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
-
+ @ Oct 17, 2026 - agent
+   Look-up the max differential cross-section in the precomputed MaxXSecTable
+   (if loaded) before looking at the cache. Added TabulateMaxXSec() for
+   building the tables offline.
+   The cache branch is accessed through an integer handle, found once per
+   interaction (using Interaction::Key()). The cache branch key includes a
+   digest of the configuration, and the cross section model and a digest of
+   its configuration.
+ @ Oct 17, 2026 - agent
+   Added the rejection method statistics (number of events and xsec
+   evaluations) kept by the concrete kinematic generators, and the
+   PrintSamplingStats() method. The statistics are printed at destruction.
 */
 //____________________________________________________________________________
 
@@ -26,6 +37,7 @@
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "EVGCore/EVGThreadException.h"
 #include "EVGModules/KineGeneratorWithCache.h"
@@ -34,6 +46,7 @@
 #include "Messenger/Messenger.h"
 #include "Utils/Cache.h"
 #include "Utils/CacheBranchFx.h"
+#include "Utils/MaxXSecTable.h"
 #include "Utils/MathUtils.h"
 
 using std::ostringstream;
@@ -45,24 +58,37 @@ using namespace genie;
 KineGeneratorWithCache::KineGeneratorWithCache() :
 EventRecordVisitorI()
 {
-
+  fNKineEvents = 0;
+  fNKineTrials = 0;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) :
 EventRecordVisitorI(name)
 {
-
+  fNKineEvents = 0;
+  fNKineTrials = 0;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) :
 EventRecordVisitorI(name, config)
 {
-
+  fNKineEvents = 0;
+  fNKineTrials = 0;
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::~KineGeneratorWithCache()
 {
-
+  if(fNKineEvents > 0) this->PrintSamplingStats();
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::PrintSamplingStats(void) const
+{
+  LOG("Kinematics", pNOTICE)
+     << "Rejection method statistics for " << this->Id().Key() << ": "
+     << fNKineEvents << " events, " 
+     << ((fNKineEvents > 0) ? fNKineTrials/fNKineEvents : 0.)
+     << " xsec evaluations / event, acceptance rate = "
+     << ((fNKineTrials > 0) ? fNKineEvents/fNKineTrials : 0.);
 }
 //___________________________________________________________________________
 double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
@@ -121,6 +147,19 @@ double KineGeneratorWithCache::FindMaxXSec(
      return -1.;
   }
 
+  // look-up the precomputed tables first
+  MaxXSecTable * mxt = MaxXSecTable::Instance();
+  if(!mxt->IsEmpty()) {
+     int handle = this->CacheBranchHandle(interaction);
+     double tbl_max_xsec = 
+         mxt->Evaluate(Cache::Instance()->CacheBranchKey(handle), E);
+     if(tbl_max_xsec > 0) {
+       LOG("Kinematics", pINFO)
+          << "\nTabulated: max xsec (E=" << E << ") = " << tbl_max_xsec;
+       return tbl_max_xsec;
+     }
+  }
+
   // access the the cache branch
   CacheBranchFx * cb = this->AccessCacheBranch(interaction);
 
@@ -229,27 +268,93 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
 // branch is found then one is created.
 
   Cache * cache = Cache::Instance();
-
-  // build the cache branch key as: namespace::algorithm/config/interaction
-  string algkey = this->Id().Key();
-  string intkey = interaction->AsString();
-  string key    = cache->CacheBranchKey(algkey, intkey);
+  int handle = this->CacheBranchHandle(interaction);
 
   CacheBranchFx * cache_branch =
-              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
   if(!cache_branch) {
     //-- create the cache branch at the first pass
     LOG("Kinematics", pINFO) << "No Max d^nXSec/d{K}^n cache branch found";
-    LOG("Kinematics", pINFO) << "Creating cache branch - key = " << key;
+    LOG("Kinematics", pINFO) 
+       << "Creating cache branch - key = " << cache->CacheBranchKey(handle);
 
     cache_branch = new CacheBranchFx("max[d^nXSec/d^n{K}] over phase space");
-    cache->AddCacheBranch(key, cache_branch);
+    cache->AddCacheBranch(handle, cache_branch);
   }
   assert(cache_branch);
 
   return cache_branch;
 }
 //___________________________________________________________________________
+string KineGeneratorWithCache::CacheBranchKey(
+                                      const Interaction * interaction) const
+{
+// Build the cache branch key as:
+//   namespace::algorithm/config#digest/xsec_algorithm/config#digest/interaction
+// The same key is used for the precomputed max xsec tables, so the tables
+// are only used with the cross section model (and configuration) they were
+// computed for.
+
+  Cache * cache = Cache::Instance();
+
+  string xseckey = "none";
+  if(fXSecModel) {
+    xseckey = fXSecModel->Id().Key() + "#" + Cache::ConfigDigest(fXSecModel);
+  }
+  string intkey = interaction->AsString();
+  return cache->CacheBranchKey(this, xseckey, intkey);
+}
+//___________________________________________________________________________
+int KineGeneratorWithCache::CacheBranchHandle(
+                                      const Interaction * interaction) const
+{
+// Returns the cache branch handle for this algorithm, the current cross
+// section model and this interaction. The cache branch key is only built the
+// first time the model / interaction pair is seen.
+
+  pair<const XSecAlgorithmI *, ULong64_t> hkey(fXSecModel, interaction->Key());
+
+  map<pair<const XSecAlgorithmI *, ULong64_t>, int>::const_iterator 
+                                        iter = fCacheHandles.find(hkey);
+  if(iter != fCacheHandles.end()) return iter->second;
+
+  int handle = Cache::Instance()->CacheBranchHandle(
+                                        this->CacheBranchKey(interaction));
+  fCacheHandles[hkey] = handle;
+  return handle;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::TabulateMaxXSec(
+    const XSecAlgorithmI * xsec_model, 
+    const Interaction * interaction, const vector<double> & Ev) const
+{
+// Computes the max differential cross section exactly as it would be done
+// during event generation (ComputeMaxXSec()) for the input probe energies
+// and stores the table at the MaxXSecTable. 
+
+  fXSecModel = xsec_model;
+
+  Interaction * in = new Interaction(*interaction);
+  in->SetBit(kISkipProcessChk);
+
+  vector<double> E;
+  vector<double> max_xsec;
+  for(unsigned int i = 0; i < Ev.size(); i++) {
+    TLorentzVector p4(0, 0, Ev[i], Ev[i]);
+    in->InitStatePtr()->SetProbeP4(p4);
+    double Ei = this->Energy(in);
+    // energies must be increasing 
+    if(E.size() > 0 && Ei <= E.back()) continue;
+    double xsec = this->ComputeMaxXSec(in);
+    LOG("Kinematics", pINFO) << "max{dxsec/dK} (E = " << Ei << ") = " << xsec;
+    E       .push_back(Ei);
+    max_xsec.push_back(TMath::Max(0., xsec));
+  }
+  delete in;
+
+  MaxXSecTable::Instance()->AddTable(this->CacheBranchKey(interaction), E, max_xsec);
+}
+//___________________________________________________________________________
 void KineGeneratorWithCache::AssertXSecLimits(
          const Interaction * interaction, double xsec, double xsec_max) const
 {
@@ -12,6 +12,9 @@
           The various super-classes should implement the ComputeMaxXSec(...)
           method for computing the maximum xsec in case it has not already
           being pushed into the cache at a previous iteration.
+          It also keeps the rejection method statistics (acceptance rate
+          and number of cross section evaluations per event) of the concrete
+          kinematic generators.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
@@ -28,12 +31,17 @@
 #define _KINE_GENERATOR_WITH_CACHE_H_
 
 #include <string>
+#include <vector>
+#include <map>
 
 #include "Base/XSecAlgorithmI.h"
 #include "EVGCore/EventRecordVisitorI.h"
 #include "Utils/Range1.h"
 
 using std::string;
+using std::vector;
+using std::map;
+using std::pair;
 
 namespace genie {
 
@@ -42,6 +50,16 @@ class XSecAlgorithmI;
 
 class KineGeneratorWithCache : public EventRecordVisitorI {
 
+public:
+  // Compute the max differential xsec for the input interaction at the input
+  // probe energies and add the table to the MaxXSecTable (see gmkmaxxsec)
+  void TabulateMaxXSec (const XSecAlgorithmI * xsec_model,
+                        const Interaction * in, const vector<double> & Ev) const;
+
+  // Print the rejection method statistics (number of events, cross section
+  // evaluations per event and acceptance rate). Also printed at destruction.
+  void PrintSamplingStats (void) const;
+
 protected:
   KineGeneratorWithCache();
   KineGeneratorWithCache(string name);
@@ -55,6 +73,8 @@ protected:
   virtual double Energy         (const Interaction * in) const;
 
   virtual CacheBranchFx * AccessCacheBranch (const Interaction * in) const;
+  virtual string          CacheBranchKey    (const Interaction * in) const;
+  virtual int             CacheBranchHandle (const Interaction * in) const;
 
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
@@ -64,6 +84,11 @@ protected:
   double fMaxXSecDiffTolerance; ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                 ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;    ///< uniform over allowed phase space + event weight?
+
+  mutable map<pair<const XSecAlgorithmI *, ULong64_t>, int> fCacheHandles; ///< (xsec model, interaction code) -> cache branch handle
+
+  mutable double fNKineEvents;   ///< number of events for which kinematics were selected
+  mutable double fNKineTrials;   ///< number of xsec evaluations in the rejection loops
 };
 
 }      // genie namespace
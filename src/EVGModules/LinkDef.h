@@ -17,5 +17,6 @@
 #pragma link C++ class genie::PrimaryLeptonGenerator;
 #pragma link C++ class genie::HadronicSystemGenerator;
 #pragma link C++ class genie::KineGeneratorWithCache;
+#pragma link C++ class genie::KineEnvelope2D;
 
 #endif
@@ -160,6 +160,10 @@
    Implemented dummy versions of the new GFluxI::Clear, GFluxI::Index and 
    GFluxI::GenerateWeighted methods needed for pre-generation of flux
    interaction probabilities in GMCJDriver. 
+ @ Oct 17, 2026 - agent
+   A TTreeCache (see SetTreeCacheSize(), on by default) is attached to the
+   flux chain so that ROOT fetches the baskets in bulk rather than entry by
+   entry.
 
 */
 //____________________________________________________________________________
@@ -177,6 +181,7 @@
 #include "Utils/XmlParserUtils.h"
 #include "Utils/StringUtils.h"
 
+#include <RVersion.h>
 #include <TFile.h>
 #include <TChain.h>
 #include <TChainElement.h>
@@ -753,6 +758,9 @@ void GNuMIFlux::LoadBeamSimData(std::vector<string> patterns, string config )
   // this will open all files and read header!!
   fNEntries = fNuFluxTree->GetEntries();
 
+  // attach the TTreeCache to the new chain
+  this->SetTreeCacheSize(fTreeCacheSize);
+
   if ( fNEntries == 0 ) {
     LOG("Flux", pERROR)
       << "!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!";
@@ -938,6 +946,23 @@ void GNuMIFlux::SetEntryReuse(long int nuse)
   fNUse    = TMath::Max(1L, nuse);
 }
 //___________________________________________________________________________
+void GNuMIFlux::SetTreeCacheSize(Long64_t nbytes)
+{
+// A TTreeCache of nbytes is attached to the flux chain so that ROOT reads
+// the baskets of all branches in bulk rather than one entry at a time.
+// nbytes = 0 switches the cache off.
+
+  fTreeCacheSize = TMath::Max((Long64_t)0, nbytes);
+
+  if ( ! fNuFluxTree ) return;
+
+  fNuFluxTree->SetCacheSize(fTreeCacheSize);
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
+  if ( fTreeCacheSize > 0 ) fNuFluxTree->AddBranchToCache("*",kTRUE);
+#endif
+  LOG("Flux", pINFO) << "Flux chain TTreeCache size: " << fTreeCacheSize << " bytes";
+}
+//___________________________________________________________________________
 void GNuMIFlux::SetTreeName(string name)
 {
   fNuFluxTreeName = name;
@@ -1217,6 +1242,8 @@ void GNuMIFlux::Initialize(void)
   fNUse            =  1;
   fIUse            =  999999;
 
+  fTreeCacheSize   =  0;
+
   fNuTot           = 0;
   fFilePOTs        = 0;
 
@@ -1267,6 +1294,7 @@ void GNuMIFlux::SetDefaults(void)
   this->SetUpstreamZ     (-3.4e38); // way upstream ==> use flux window
   this->SetNumOfCycles   (0);
   this->SetEntryReuse    (1);
+  this->SetTreeCacheSize (10000000);
 
   this->SetXMLFile();
 }
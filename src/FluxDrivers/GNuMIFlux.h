@@ -240,6 +240,8 @@ public :
 
   void      SetNumOfCycles(long int ncycle);                      ///< set how many times to cycle through the ntuple (default: 1 / n=0 means 'infinite')
   void      SetEntryReuse(long int nuse=1);                       ///<  # of times to use entry before moving to next
+  void      SetTreeCacheSize(Long64_t nbytes=10000000);           ///< size of the TTreeCache on the flux chain (default: 10 MB / 0 means no cache)
+  Long64_t  TreeCacheSize(void) const { return fTreeCacheSize; }  ///< size of the TTreeCache on the flux chain
 
   void      SetTreeName(string name);                             ///< set input tree name (default: "h10")
   void      ScanForMaxWeight(void);                               ///< scan for max flux weight (before generating unweighted flux neutrinos)
@@ -391,6 +393,8 @@ private:
 
   GNuMIFluxPassThroughInfo* fCurEntry;  ///< copy of current ntuple entry info (owned structure)
 
+  Long64_t  fTreeCacheSize;       ///< size of the TTreeCache on the flux chain (bytes)
+
 };
 
 //#define GNUMI_TEST_XY_WGT
@@ -13,6 +13,12 @@
    Implemented dummy versions of the new GFluxI::Clear, GFluxI::Index and 
    GFluxI::GenerateWeighted methods needed for pre-generation of flux
    interaction probabilities in GMCJDriver.
+ @ Oct 17, 2026 - agent
+   A TTreeCache (see SetTreeCacheSize(), on by default) is attached to the
+   flux chain so that ROOT fetches the baskets in bulk rather than entry by
+   entry. The meta data entry for each metakey is
+   located once in ProcessMeta() rather than by a linear search through the
+   meta chain each time the file changes.
 
 */
 //____________________________________________________________________________
@@ -24,6 +30,7 @@
 #include <limits.h>
 #include <algorithm>
 
+#include <RVersion.h>
 #include <TFile.h>
 #include <TChain.h>
 #include <TChainElement.h>
@@ -194,14 +201,21 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
 #else
       // unordered indices makes ROOT call Error() which might,
       // if not DefaultErrorHandler, be fatal.
-      // so find the right one by a simple linear search.
-      // not a large burden since it only happens infrequently and
-      // the list is normally quite short.
+      // so use the metakey -> entry map filled by ProcessMeta(), falling
+      // back to a simple linear search for keys not (yet) in the map.
       int nmeta = fNuMetaTree->GetEntries();
       int nbmeta = 0;
-      for (int imeta = 0; imeta < nmeta; ++imeta ) {
-        nbmeta = fNuMetaTree->GetEntry(imeta);
-        if ( fCurMeta->metakey == metakey ) break;
+      std::map<UInt_t,Long64_t>::const_iterator mitr = fMetaEntry.find(metakey);
+      if ( mitr != fMetaEntry.end() ) {
+        nbmeta = fNuMetaTree->GetEntry(mitr->second);
+      } else {
+        for (int imeta = 0; imeta < nmeta; ++imeta ) {
+          nbmeta = fNuMetaTree->GetEntry(imeta);
+          if ( fCurMeta->metakey == metakey ) {
+            fMetaEntry[metakey] = imeta;
+            break;
+          }
+        }
       }
       // next condition should never happen
       if ( fCurMeta->metakey != metakey ) {
@@ -516,6 +530,9 @@ void GSimpleNtpFlux::LoadBeamSimData(std::vector<string> patterns, string config
     << " \"numi\"=" << sba_status[1]
     << " \"aux\"=" << sba_status[2];
 
+  // attach the TTreeCache to the new chain
+  this->SetTreeCacheSize(fTreeCacheSize);
+
   // attach requested branches
 
   if (fMaxWeight<=0) {
@@ -564,9 +581,13 @@ void GSimpleNtpFlux::ProcessMeta(void)
     int nindices = fNuMetaTree->BuildIndex("metakey"); // key used to tie entries to meta data
     LOG("Flux", pDEBUG) << "ProcessMeta() BuildIndex nindices " << nindices;
 #endif
+    fMetaEntry.clear();
     int nmeta = fNuMetaTree->GetEntries();
     for (int imeta = 0; imeta < nmeta; ++imeta ) {
       fNuMetaTree->GetEntry(imeta);
+      // remember where to find the meta data for this key (first one wins)
+      if ( fMetaEntry.find(fCurMeta->metakey) == fMetaEntry.end() )
+        fMetaEntry[fCurMeta->metakey] = imeta;
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("Flux", pNOTICE) << "ProcessMeta() ifile " << imeta
                            << " (of " << fNFiles
@@ -650,6 +671,26 @@ void GSimpleNtpFlux::SetEntryReuse(long int nuse)
   fNUse    = TMath::Max(1L, nuse);
 }
 //___________________________________________________________________________
+void GSimpleNtpFlux::SetTreeCacheSize(Long64_t nbytes)
+{
+// Flux neutrinos are mostly rejected, so event generation can easily end up
+// limited by reading the flux ntuple one entry at a time. A TTreeCache of
+// nbytes is attached to the flux chain so that ROOT reads the baskets of
+// all branches in bulk. The entries (and any extra branches attached by the
+// user via GetFluxTChain()) are still read one by one with GetEntry().
+// nbytes = 0 switches the cache off.
+
+  fTreeCacheSize = TMath::Max((Long64_t)0, nbytes);
+
+  if ( ! fNuFluxTree || fNEntries <= 0 ) return;
+
+  fNuFluxTree->SetCacheSize(fTreeCacheSize);
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,26,0)
+  if ( fTreeCacheSize > 0 ) fNuFluxTree->AddBranchToCache("*",kTRUE);
+#endif
+  LOG("Flux", pINFO) << "Flux chain TTreeCache size: " << fTreeCacheSize << " bytes";
+}
+//___________________________________________________________________________
 void GSimpleNtpFlux::GetFluxWindow(TVector3& p0, TVector3& p1, TVector3& p2) const
 {
   // return flux window points
@@ -736,6 +777,8 @@ void GSimpleNtpFlux::Initialize(void)
   fAllFilesMeta    = true;
   fAlreadyUnwgt    = false;
 
+  fTreeCacheSize   = 0;
+
   this->SetDefaults();
   this->ResetCurrent();
 }
@@ -751,6 +794,7 @@ void GSimpleNtpFlux::SetDefaults(void)
   this->SetUpstreamZ     (-3.4e38); // way upstream ==> use flux window
   this->SetNumOfCycles   (0);
   this->SetEntryReuse    (1);
+  this->SetTreeCacheSize (10000000);
 }
 //___________________________________________________________________________
 void GSimpleNtpFlux::ResetCurrent(void)
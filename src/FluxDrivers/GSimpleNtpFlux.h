@@ -23,6 +23,7 @@
 #include <iostream>
 #include <vector>
 #include <set>
+#include <map>
 
 #include <TVector3.h>
 #include <TLorentzVector.h>
@@ -255,6 +256,8 @@ public :
 
   void      SetNumOfCycles(long int ncycle);                      ///< set how many times to cycle through the ntuple (default: 1 / n=0 means 'infinite')
   void      SetEntryReuse(long int nuse=1);                       ///<  # of times to use entry before moving to next
+  void      SetTreeCacheSize(Long64_t nbytes=10000000);           ///< size of the TTreeCache on the flux chain (default: 10 MB / 0 means no cache)
+  Long64_t  TreeCacheSize(void) const { return fTreeCacheSize; }  ///< size of the TTreeCache on the flux chain
 
   void      ProcessMeta(void);  ///< scan for max flux energy, weight
 
@@ -321,6 +324,10 @@ private:
   TLorentzVector   fP4;        ///< reconstituted p4 vector
   TLorentzVector   fX4;        ///< reconstituted position vector
   GSimpleNtpMeta*  fCurMeta;   ///< current meta data 
+
+  std::map<UInt_t,Long64_t> fMetaEntry; ///< metakey -> entry in the "meta" chain
+
+  Long64_t         fTreeCacheSize; ///< size of the TTreeCache on the flux chain (bytes)
 };
 
 } // flux namespace
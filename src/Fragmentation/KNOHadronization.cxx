@@ -32,11 +32,18 @@
  @ Mar 28, 2012 - CA
    Commented-out option to use 'legacy KNO data' (used in neugrn and in 
    GENIE/neugen comparisons circa 2007) instead of the Levy parameterization.
+ @ Oct 17, 2026 - agent
+   Added FastPhaseSpaceDecay(), using the NBodyPhaseSpace generator and 
+   tabulated phase space weights rather than generating 200 trial decays for
+   each decay. Off by default (see the PhaseSpDec-Fast config option).
 
 */
 //____________________________________________________________________________
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
 
 #include <RVersion.h>
 #if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
@@ -60,6 +67,7 @@
 #include "Interaction/Interaction.h"
 #include "Messenger/Messenger.h"
 #include "Numerical/RandomGen.h"
+#include "Numerical/RandomStream.h"
 //#include "Numerical/Spline.h"
 #include "PDG/PDGLibrary.h"
 #include "PDG/PDGCodeList.h"
@@ -73,21 +81,32 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils::print;
 
+// Phase space weight tables used by FastPhaseSpaceDecay()
+static const int          kNPhSpTrials       = 200;  // trial decays emulated to get the max weight
+static const int          kNPhSpTabDecays    = 1000; // decays generated per table
+static const int          kNPhSpTabWeights   = 64;   // largest weights kept per table
+static const double       kNPhSpKnotsPerDec  = 10.;  // kinetic energy knots per decade
+static const unsigned int kPhSpTabRndStream  = 15;   // random number stream id (unused by RandomGen)
+
 //____________________________________________________________________________
 KNOHadronization::KNOHadronization() :
 HadronizationModelBase("genie::KNOHadronization")
 {
-  fBaryonXFpdf  = 0;
-  fBaryonPT2pdf = 0;
-//fKNO          = 0;
+  fBaryonXFpdf   = 0;
+  fBaryonPT2pdf  = 0;
+//fKNO           = 0;
+  fPhaseSpaceRnd = new RandomStream(kPhSpTabRndStream);
+  fPhaseSpaceTab.SetRandom(fPhaseSpaceRnd);
 }
 //____________________________________________________________________________
 KNOHadronization::KNOHadronization(string config) :
 HadronizationModelBase("genie::KNOHadronization", config)
 {
-  fBaryonXFpdf  = 0;
-  fBaryonPT2pdf = 0;
-//fKNO          = 0;
+  fBaryonXFpdf   = 0;
+  fBaryonPT2pdf  = 0;
+//fKNO           = 0;
+  fPhaseSpaceRnd = new RandomStream(kPhSpTabRndStream);
+  fPhaseSpaceTab.SetRandom(fPhaseSpaceRnd);
 }
 //____________________________________________________________________________
 KNOHadronization::~KNOHadronization()
@@ -95,6 +114,7 @@ KNOHadronization::~KNOHadronization()
   if (fBaryonXFpdf ) delete fBaryonXFpdf;
   if (fBaryonPT2pdf) delete fBaryonPT2pdf;
 //if (fKNO         ) delete fKNO;
+  delete fPhaseSpaceRnd;
 }
 //____________________________________________________________________________
 // HadronizationModelI interface implementation:
@@ -467,6 +487,14 @@ void KNOHadronization::LoadConfig(void)
   fPhSpRwA = fConfig->GetDoubleDef(
       "PhaseSpDec-ReweightParm", gc->GetDouble("KNO-PhaseSpDec-ReweightParm")); 
 
+  // Use the fast phase space generator and tabulated phase space weights?
+  // See FastPhaseSpaceDecay()
+  fFastPhaseSpDec = fConfig->GetBoolDef(
+             "PhaseSpDec-Fast", gc->GetBool("KNO-PhaseSpDec-Fast"));
+
+  // The weight tables depend on the reweighting parameter
+  fPhaseSpaceWeights.clear();
+
   // use isotropic non-reweighted 2-body phase space decays for consistency
   // with neugen/daikon
   fUseIsotropic2BDecays =fConfig->GetBoolDef(
@@ -898,6 +926,10 @@ bool KNOHadronization::PhaseSpaceDecay(
 // given by 'pd'. The decayed system is used to populate the input TMCParticle 
 // array starting from the slot 'offset'.
 //
+  if(fFastPhaseSpDec) {
+    return this->FastPhaseSpaceDecay(plist, pd, pdgv, offset, reweight);
+  }
+
   LOG("KNOHad", pINFO) << "*** Performing a Phase Space Decay";
   LOG("KNOHad", pINFO) << "pT reweighting is " << (reweight ? "on" : "off");
 
@@ -1063,6 +1095,253 @@ double KNOHadronization::ReWeightPt2(const PDGCodeList & pdgcv) const
   return w;
 }
 //____________________________________________________________________________
+bool KNOHadronization::FastPhaseSpaceDecay(
+         TClonesArray & plist, TLorentzVector & pd, 
+                   const PDGCodeList & pdgv, int offset, bool reweight) const
+{
+// Same as PhaseSpaceDecay() but using the NBodyPhaseSpace generator. 
+// PhaseSpaceDecay() estimates the max decay weight, needed for generating 
+// unweighted decays, as the max weight among 200 trial decays generated at 
+// each call. Here the estimate is drawn from its distribution, using tables
+// of the largest weights among many decays of the same decay products (see
+// PhaseSpaceMaxWeight()), so that the generated decays are distributed as in
+// PhaseSpaceDecay() without the trial decays.
+// Unweighted decays are rejected on their phase space weight alone, before
+// building their momenta, whenever possible.
+//
+  LOG("KNOHad", pINFO) << "*** Performing a (fast) Phase Space Decay";
+  LOG("KNOHad", pINFO) << "pT reweighting is " << (reweight ? "on" : "off");
+
+  assert ( offset      >= 0);
+  assert ( pdgv.size() >  1);
+
+  // Get the decay product masses
+
+  int n = pdgv.size();
+  fDecayMass.resize(n);
+  double sum = 0;
+  for(int i = 0; i < n; i++) {
+    fDecayMass[i] = PDGLibrary::Instance()->Find(pdgv[i])->Mass();
+    sum += fDecayMass[i];
+  }
+
+  LOG("KNOHad", pINFO)  
+    << "Decaying N = " << n << " particles / total mass = " << sum;
+  LOG("KNOHad", pINFO) 
+    << "Decaying system p4 = " << utils::print::P4AsString(&pd);
+
+  // Set the decay
+  bool permitted = fPhaseSpace.SetDecay(pd, n, &fDecayMass[0]);
+  if(!permitted) {
+     LOG("KNOHad", pERROR) 
+       << " *** Phase space decay is not permitted \n"
+       << " Total particle mass = " << sum << "\n"
+       << " Decaying system p4 = " << utils::print::P4AsString(&pd);
+     return false;
+  }
+
+  // All (not reweighted) 2-body decays have the same weight
+  bool flat = (n == 2 && !reweight);
+
+  // The phase space weights are normalized so as not to exceed 1, and so is
+  // the reweighting factor for a non-negative reweighting parameter
+  bool wmax_is_1 = (!reweight || fPhSpRwA >= 0);
+
+  // Get the maximum weight
+  double wmax = (flat) ? 1. : this->PhaseSpaceMaxWeight(reweight);
+
+  LOG("KNOHad", pNOTICE) 
+     << "Max phase space gen. weight @ current hadronic system: " << wmax;
+
+  // Generate a weighted or unweighted decay
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  if(fGenerateWeighted) 
+  {
+    // *** generating weighted decays ***
+    double w = fPhaseSpace.Generate();
+    if(reweight) { w *= this->ReWeightPt2(fPhaseSpace); }
+    fWeight *= TMath::Max(w/wmax, 1.);
+  }
+  else if(flat)
+  {
+    // *** generating un-weighted decays (nothing to reject) ***
+    fPhaseSpace.Generate();
+  }
+  else 
+  {
+    // *** generating un-weighted decays ***
+     wmax *= 2.3;
+     if(wmax_is_1) { wmax = TMath::Min(wmax, 1.); }
+
+     bool accept_decay=false;
+     unsigned int itry=0;
+
+     while(!accept_decay) 
+     {
+       itry++;
+
+       if(itry>kMaxUnweightDecayIterations) {
+         // report and return
+         LOG("KNOHad", pWARN) 
+             << "Couldn't generate an unweighted phase space decay after " 
+             << itry << " attempts";
+         return false;
+       }
+
+       double w  = fPhaseSpace.GenerateWeight();
+       double gw = wmax * rnd->RndHadro().Rndm();
+
+       // reject without building the momenta if the decay can't be accepted
+       if(gw > w && wmax_is_1) continue;
+
+       fPhaseSpace.GenerateMomenta();
+       if(reweight) { w *= this->ReWeightPt2(fPhaseSpace); }
+       if(w > wmax) {
+          LOG("KNOHad", pWARN) 
+           << "Decay weight = " << w << " > max decay weight = " << wmax;
+       }
+       accept_decay = (gw<=w);
+     }
+
+     LOG("KNOHad", pINFO) << "Decay accepted after " << itry << " attempts";
+  }
+
+  // Insert final state products into a TClonesArray of TMCParticles
+
+  for(int i = 0; i < n; i++) {
+     const TLorentzVector & p4fin = fPhaseSpace.Decay(i);
+     new ( plist[offset+i] ) TMCParticle(
+           1, pdgv[i], -1, -1, -1, 
+           p4fin.Px(), p4fin.Py(), p4fin.Pz(), p4fin.Energy(), fDecayMass[i], 
+           0, 0, 0, 0, 0);
+  }
+
+  return true;
+}
+//____________________________________________________________________________
+double KNOHadronization::PhaseSpaceMaxWeight(bool reweight) const
+{
+// Returns the max weight among kNPhSpTrials (200) trial decays of the current
+// hadronic system (see FastPhaseSpaceDecay()).
+// If the weights of the trial decays are drawn from the set of the largest
+// weights among kNPhSpTabDecays decays (sorted in decreasing order), the 
+// index k of their max is distributed as P(>=k) = (1-k/kNPhSpTabDecays)^200.
+// The weight tables are built at kinetic energy knots and the weight at
+// index k is interpolated (log-linearly) in log(kinetic energy).
+// Note: The tables are built for a decaying system at rest. For a moving
+// system (see DecayMethod2()) reweighted decays have somewhat smaller weights 
+// and the estimate is somewhat conservative.
+
+  double lt   = kNPhSpKnotsPerDec * TMath::Log10(fPhaseSpace.KinEnergy());
+  int    knot = TMath::FloorNint(lt);
+  double f    = lt - knot;
+
+  const vector<double> & wlo = this->PhaseSpaceWeights(knot,   reweight);
+  const vector<double> & whi = this->PhaseSpaceWeights(knot+1, reweight);
+
+  double u = RandomGen::Instance()->RndHadro().Rndm();
+  int k = (int) (kNPhSpTabDecays * (1 - TMath::Power(u, 1./kNPhSpTrials)));
+  k = TMath::Min(k, kNPhSpTabWeights-1);
+
+  double wmax = 0;
+  if(wlo[k] > 0 && whi[k] > 0) {
+    wmax = TMath::Exp((1-f)*TMath::Log(wlo[k]) + f*TMath::Log(whi[k]));
+  } else {
+    wmax = (1-f)*wlo[k] + f*whi[k];
+  }
+  if(wmax > 0) return wmax;
+
+  // should never get here: generate the trial decays
+  LOG("KNOHad", pWARN) 
+     << "Null tabulated phase space weights! Generating trial decays";
+  for(int i = 0; i < kNPhSpTrials; i++) {
+    double w = fPhaseSpace.Generate();
+    if(reweight) { w *= this->ReWeightPt2(fPhaseSpace); }
+    wmax = TMath::Max(wmax, w);
+  }
+  assert(wmax>0);
+  return wmax;
+}
+//____________________________________________________________________________
+const vector<double> & KNOHadronization::PhaseSpaceWeights(
+                                            int knot, bool reweight) const
+{
+// Returns the kNPhSpTabWeights largest weights (in decreasing order) among
+// kNPhSpTabDecays decays of the current decay products, at rest, with a 
+// kinetic energy of 10^(knot/kNPhSpKnotsPerDec) GeV. The tables are built on 
+// demand and kept for the lifetime of the configuration.
+
+  const vector<double> & mass = fPhaseSpace.SortedMass();
+
+  vector<double> key(mass);
+  key.push_back(knot);
+  key.push_back(reweight ? 1. : 0.);
+
+  map<vector<double>, vector<double> >::const_iterator it =
+                                               fPhaseSpaceWeights.find(key);
+  if(it != fPhaseSpaceWeights.end()) return it->second;
+
+  // Position the random number stream used for the tables by the table key
+  // (FNV-1a hash), so that tables (and thus generated events) don't depend 
+  // on the order in which the tables happen to be built
+  ULong64_t hash = 14695981039346656037ULL;
+  for(unsigned int i = 0; i < key.size(); i++) {
+    unsigned char bytes[sizeof(double)];
+    memcpy(bytes, &key[i], sizeof(double));
+    for(unsigned int j = 0; j < sizeof(double); j++) {
+      hash ^= bytes[j];
+      hash *= 1099511628211ULL;
+    }
+  }
+  fPhaseSpaceRnd->SetEvent(0, (Long64_t) (hash >> 1));
+
+  double sum = 0;
+  for(unsigned int i = 0; i < mass.size(); i++) sum += mass[i];
+  double T = TMath::Power(10., knot/kNPhSpKnotsPerDec);
+
+  TLorentzVector p4(0, 0, 0, sum+T);
+  fPhaseSpaceTab.SetDecay(p4, mass.size(), &mass[0]);
+
+  vector<double> weights(kNPhSpTabDecays);
+  for(int i = 0; i < kNPhSpTabDecays; i++) {
+    double w = fPhaseSpaceTab.GenerateWeight();
+    if(reweight) {
+      fPhaseSpaceTab.GenerateMomenta();
+      w *= this->ReWeightPt2(fPhaseSpaceTab);
+    }
+    weights[i] = w;
+  }
+  std::partial_sort(weights.begin(), weights.begin()+kNPhSpTabWeights,
+                    weights.end(), std::greater<double>());
+  weights.resize(kNPhSpTabWeights);
+
+  LOG("KNOHad", pINFO) 
+    << "Built phase space weight table for N = " << mass.size() 
+    << " particles, T = " << T << " GeV" 
+    << (reweight ? " (reweighted)" : "") << ": max weight = " << weights[0];
+
+  return fPhaseSpaceWeights.insert(
+     map<vector<double>, vector<double> >::value_type(key, weights)).first->second;
+}
+//____________________________________________________________________________
+double KNOHadronization::ReWeightPt2(const NBodyPhaseSpace & phsp) const
+{
+// Same as ReWeightPt2(const PDGCodeList &) for decays generated with the
+// NBodyPhaseSpace generator
+
+  double w = 1;
+
+  for(int i = 0; i < phsp.NDecay(); i++) {
+     const TLorentzVector & p4 = phsp.Decay(i); 
+     double pt2 = TMath::Power(p4.Px(),2) + TMath::Power(p4.Py(),2);
+     double wi  = TMath::Exp(-fPhSpRwA*TMath::Sqrt(pt2));
+     w *= wi;
+  }
+  return w;
+}
+//____________________________________________________________________________
 PDGCodeList * KNOHadronization::GenerateHadronCodes(
                                    int multiplicity, int maxQ, double W) const
 {
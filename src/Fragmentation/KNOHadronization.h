@@ -11,6 +11,12 @@
           Both the 'historical' version and the new versions are supported.
           See the algorithms configuration for details.
 
+          The phase space decays of the hadronic system can optionally use
+          the NBodyPhaseSpace generator and tabulated phase space weights (see
+          FastPhaseSpaceDecay()) rather than TGenPhaseSpace. This is off by
+          default, pending its validation against TGenPhaseSpace for moving
+          hadronic systems.
+
           Is a concrete implementation of the HadronizationModelI interface.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
@@ -33,15 +39,23 @@
 #ifndef _KNO_HADRONIZATION_H_
 #define _KNO_HADRONIZATION_H_
 
+#include <map>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 
 #include "Fragmentation/HadronizationModelBase.h"
+#include "Fragmentation/NBodyPhaseSpace.h"
+
+using std::map;
+using std::vector;
 
 class TF1;
 
 namespace genie {
 
 class DecayModelI;
+class RandomStream;
 //class Spline;
 
 class KNOHadronization : public HadronizationModelBase {
@@ -76,6 +90,7 @@ private:
   double        AverageChMult         (int nu, int nuc, double W)    const;
   void          HandleDecays          (TClonesArray * particle_list) const;
   double        ReWeightPt2           (const PDGCodeList & pdgcv)    const;
+  double        ReWeightPt2           (const NBodyPhaseSpace & phsp) const;
 
   TClonesArray* DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
   TClonesArray* DecayMethod2    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
@@ -84,9 +99,20 @@ private:
   bool PhaseSpaceDecay(
          TClonesArray & pl, TLorentzVector & pd, 
 	   const PDGCodeList & pdgv, int offset=0, bool reweight=false) const;
+  bool FastPhaseSpaceDecay(
+         TClonesArray & pl, TLorentzVector & pd, 
+	   const PDGCodeList & pdgv, int offset=0, bool reweight=false) const;
+
+  double                 PhaseSpaceMaxWeight (bool reweight)           const;
+  const vector<double> & PhaseSpaceWeights   (int knot, bool reweight) const;
 
-  mutable TGenPhaseSpace fPhaseSpaceGenerator; ///< a phase space generator
-  mutable double         fWeight;              ///< weight for generated event
+  mutable TGenPhaseSpace  fPhaseSpaceGenerator; ///< a phase space generator
+  mutable NBodyPhaseSpace fPhaseSpace;          ///< fast phase space generator
+  mutable NBodyPhaseSpace fPhaseSpaceTab;       ///< phase space generator filling the weight tables
+  RandomStream *          fPhaseSpaceRnd;       ///< random number stream used for the weight tables
+  mutable vector<double>  fDecayMass;           ///< masses of the decay products (buffer)
+  mutable map<vector<double>, vector<double> > fPhaseSpaceWeights; ///< largest phase space weights per {decay masses, kinetic energy knot, reweighting}
+  mutable double          fWeight;              ///< weight for generated event
 
   // Configuration parameters
   // Note: additional configuration parameters common to all hadronizers
@@ -98,6 +124,7 @@ private:
   bool     fUseIsotropic2BDecays;///< force isotropic, non-reweighted 2-body decays for consistency with neugen/daikon
   bool     fUseBaryonXfPt2Param; ///< Generate baryon xF,pT2 from experimental parameterization?
   bool     fReWeightDecays;      ///< Reweight phase space decays?
+  bool     fFastPhaseSpDec;      ///< Use the fast phase space generator & tabulated weights?
   bool     fForceDecays;         ///< force decays of unstable hadrons produced?
   bool     fForceMinMult;        ///< force minimum multiplicity if (at low W) generated less?
   bool     fGenerateWeighted;    ///< generate weighted events?
@@ -0,0 +1,198 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include <TMath.h>
+#include <TRandom.h>
+
+#include "Conventions/Constants.h"
+#include "Fragmentation/NBodyPhaseSpace.h"
+#include "Numerical/RandomGen.h"
+
+using namespace genie;
+using namespace genie::constants;
+
+// momentum of the decay products in the 2-body decay a -> b + c
+static inline double PDK(double a, double b, double c)
+{
+  double x = (a-b-c)*(a+b+c)*(a-b+c)*(a+b-c);
+  return TMath::Sqrt(x)/(2*a);
+}
+//____________________________________________________________________________
+NBodyPhaseSpace::NBodyPhaseSpace() :
+fRandom(&RandomGen::Instance()->RndHadro()),
+fN(0),
+fTeCmTm(0),
+fWtMax(0)
+{
+  fBeta[0] = fBeta[1] = fBeta[2] = 0;
+}
+//____________________________________________________________________________
+NBodyPhaseSpace::NBodyPhaseSpace(TRandom * rnd) :
+fRandom(rnd),
+fN(0),
+fTeCmTm(0),
+fWtMax(0)
+{
+  fBeta[0] = fBeta[1] = fBeta[2] = 0;
+}
+//____________________________________________________________________________
+NBodyPhaseSpace::~NBodyPhaseSpace()
+{
+
+}
+//____________________________________________________________________________
+bool NBodyPhaseSpace::SetDecay(
+   const TLorentzVector & p4, int n, const double * mass)
+{
+  if(n < 2) return false;
+
+  // no reallocation unless more decay products than ever before
+  fN = n;
+  fOrder .resize(n);
+  fMass  .resize(n);
+  fRno   .resize(n);
+  fInvMas.resize(n);
+  fPd    .resize(n);
+  fPx    .resize(n);
+  fPy    .resize(n);
+  fPz    .resize(n);
+  fE     .resize(n);
+  fDecay .resize(n);
+
+  // order the decay products by decreasing mass (stable insertion sort)
+  for(int i = 0; i < n; i++) {
+    int j = i;
+    while(j > 0 && mass[fOrder[j-1]] < mass[i]) {
+      fOrder[j] = fOrder[j-1];
+      j--;
+    }
+    fOrder[j] = i;
+  }
+  fTeCmTm = p4.Mag();
+  for(int i = 0; i < n; i++) {
+    fMass[i] = mass[fOrder[i]];
+    fTeCmTm -= fMass[i];
+  }
+  if(fTeCmTm <= 0) return false;
+
+  // weight normalization, as in TGenPhaseSpace
+  double emmax = fTeCmTm + fMass[0];
+  double emmin = 0;
+  double wtmax = 1;
+  for(int i = 1; i < n; i++) {
+    emmin += fMass[i-1];
+    emmax += fMass[i];
+    wtmax *= PDK(emmax, emmin, fMass[i]);
+  }
+  fWtMax = 1/wtmax;
+
+  // velocity of the decaying system
+  double E = p4.Energy();
+  fBeta[0] = p4.Px()/E;
+  fBeta[1] = p4.Py()/E;
+  fBeta[2] = p4.Pz()/E;
+
+  return true;
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::GenerateWeight(void)
+{
+// Sample the intermediate invariant masses and return the decay weight
+
+  int n = fN;
+
+  fRno[0] = 0;
+  for(int i = 1; i < n-1; i++) fRno[i] = fRandom->Rndm();
+  if(n > 3) std::sort(fRno.begin()+1, fRno.begin()+n-1);
+  fRno[n-1] = 1;
+
+  double sum = 0;
+  for(int i = 0; i < n; i++) {
+    sum += fMass[i];
+    fInvMas[i] = fRno[i]*fTeCmTm + sum;
+  }
+
+  double wt = fWtMax;
+  for(int i = 0; i < n-1; i++) {
+    fPd[i] = PDK(fInvMas[i+1], fInvMas[i], fMass[i+1]);
+    wt *= fPd[i];
+  }
+  return wt;
+}
+//____________________________________________________________________________
+void NBodyPhaseSpace::GenerateMomenta(void)
+{
+// Build the decay product momenta for the last sampled invariant masses
+// (Raubold-Lynch method, as in TGenPhaseSpace)
+
+  int n = fN;
+
+  fPx[0] = 0;
+  fPy[0] = fPd[0];
+  fPz[0] = 0;
+  fE [0] = TMath::Sqrt(fPd[0]*fPd[0] + fMass[0]*fMass[0]);
+
+  for(int i = 1; ; i++) {
+    fPx[i] = 0;
+    fPy[i] = -fPd[i-1];
+    fPz[i] = 0;
+    fE [i] = TMath::Sqrt(fPd[i-1]*fPd[i-1] + fMass[i]*fMass[i]);
+
+    // random rotation around z and then around y
+    double cZ   = 2*fRandom->Rndm() - 1;
+    double sZ   = TMath::Sqrt(1-cZ*cZ);
+    double angY = 2*kPi * fRandom->Rndm();
+    double cY   = TMath::Cos(angY);
+    double sY   = TMath::Sin(angY);
+    for(int j = 0; j <= i; j++) {
+      double x  = fPx[j];
+      double y  = fPy[j];
+      double z  = fPz[j];
+      double xr = cZ*x - sZ*y;
+      fPy[j] = sZ*x + cZ*y;
+      fPx[j] = cY*xr - sY*z;
+      fPz[j] = sY*xr + cY*z;
+    }
+    if(i == n-1) break;
+
+    // boost along y to the rest frame of the next intermediate system
+    double beta  = fPd[i] / TMath::Sqrt(fPd[i]*fPd[i] + fInvMas[i]*fInvMas[i]);
+    double gamma = 1. / TMath::Sqrt(1 - beta*beta);
+    for(int j = 0; j <= i; j++) {
+      double y = fPy[j];
+      double e = fE [j];
+      fPy[j] = gamma*(y + beta*e);
+      fE [j] = gamma*(e + beta*y);
+    }
+  }
+
+  // final boost to the frame of the decaying system, in the input order
+  bool boost = (fBeta[0] != 0 || fBeta[1] != 0 || fBeta[2] != 0);
+  for(int i = 0; i < n; i++) {
+    TLorentzVector & p4 = fDecay[fOrder[i]];
+    p4.SetPxPyPzE(fPx[i], fPy[i], fPz[i], fE[i]);
+    if(boost) p4.Boost(fBeta[0], fBeta[1], fBeta[2]);
+  }
+}
+//____________________________________________________________________________
+double NBodyPhaseSpace::Generate(void)
+{
+  double wt = this->GenerateWeight();
+  this->GenerateMomenta();
+  return wt;
+}
+//____________________________________________________________________________
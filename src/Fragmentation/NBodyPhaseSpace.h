@@ -0,0 +1,90 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::NBodyPhaseSpace
+
+\brief    N-body phase space generator, using the same algorithm (GENBOD,
+          F.James, CERN 68-15) and the same weight normalization as ROOT's
+          TGenPhaseSpace, as a faster replacement for it in the hadronization
+          models.
+
+          The generation is split in two steps: GenerateWeight() samples the
+          intermediate invariant masses and returns the event weight (which
+          depends only on them) while GenerateMomenta() builds the momenta of
+          the decay products for the last sampled invariant masses.
+          When generating unweighted decays, configurations rejected on their
+          weight alone thus cost O(N logN) operations rather than the O(N^2)
+          boosts and rotations needed to build the momenta.
+          Other differences with TGenPhaseSpace:
+          - The random numbers are drawn from the input stream (by default the
+            RandomGen hadronization stream) rather than from gRandom.
+          - There is no limit on the number of decay products.
+          - All buffers are reused between decays.
+          - The decay products are internally ordered by decreasing mass, so
+            that the weight distribution depends only on the set of masses
+            (see KNOHadronization, which tabulates maximum weights per mass
+            set). Decay products are returned in the input order.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NBODY_PHASE_SPACE_H_
+#define _NBODY_PHASE_SPACE_H_
+
+#include <vector>
+
+#include <TLorentzVector.h>
+
+class TRandom;
+
+using std::vector;
+
+namespace genie {
+
+class NBodyPhaseSpace {
+
+public:
+  NBodyPhaseSpace();
+  NBodyPhaseSpace(TRandom * rnd);
+ ~NBodyPhaseSpace();
+
+  void   SetRandom       (TRandom * rnd) { fRandom = rnd; }
+  bool   SetDecay        (const TLorentzVector & p4, int n, const double * mass);
+
+  double GenerateWeight  (void);
+  void   GenerateMomenta (void);
+  double Generate        (void);
+
+  int                    NDecay      (void)  const { return fN;      }
+  double                 KinEnergy   (void)  const { return fTeCmTm; }
+  const vector<double> & SortedMass  (void)  const { return fMass;   }
+  const TLorentzVector & Decay       (int i) const { return fDecay[i]; }
+
+private:
+
+  TRandom *              fRandom;  ///< random number generator
+  int                    fN;       ///< number of decay products
+  double                 fTeCmTm;  ///< kinetic energy available in the decay (CM frame)
+  double                 fWtMax;   ///< weight normalization (as in TGenPhaseSpace)
+  double                 fBeta[3]; ///< velocity of the decaying system
+  vector<int>            fOrder;   ///< input index of the i-th decay product (by decreasing mass)
+  vector<double>         fMass;    ///< decay product masses (by decreasing mass)
+  vector<double>         fRno;     ///< sorted random numbers
+  vector<double>         fInvMas;  ///< intermediate invariant masses
+  vector<double>         fPd;      ///< 2-body decay momenta
+  vector<double>         fPx;      ///< decay product momenta & energies being built
+  vector<double>         fPy;
+  vector<double>         fPz;
+  vector<double>         fE;
+  vector<TLorentzVector> fDecay;   ///< decay product 4-momenta (input order)
+};
+
+}      // genie namespace
+#endif // _NBODY_PHASE_SPACE_H_
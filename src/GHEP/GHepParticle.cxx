@@ -22,6 +22,10 @@
    Adding special ctor for ROOT I/O purposes so as to avoid memory leak due to
    memory allocated in the default ctor when objects of this class are read by 
    the ROOT Streamer. 
+ @ Oct 17, 2026 - agent
+   Reset() and Clear() keep the momentum & position 4-vectors already
+   allocated, so that GHepRecord can re-use the GHepParticle objects kept in
+   its TClonesArray slots without any re-allocation. Added Swap().
 
 */
 //____________________________________________________________________________
@@ -29,6 +33,7 @@
 #include <cstdlib>
 #include <cassert>
 #include <iomanip>
+#include <algorithm>
 
 #include <TMath.h>
 #include <TRootIOCtor.h>
@@ -405,19 +410,10 @@ void GHepParticle::SetRemovalEnergy(double Erm)
 //___________________________________________________________________________
 void GHepParticle::Init(void)
 {
-  fPdgCode       = 0;
-  fStatus        = kIStUndefined;
-  fRescatterCode = -1;
-  fFirstMother   = -1;
-  fLastMother    = -1;
-  fFirstDaughter = -1;
-  fLastDaughter  = -1;
-  fPolzTheta     = -999; 
-  fPolzPhi       = -999;    
-  fIsBound       = false;
-  fRemovalEnergy = 0.;
-  fP4            = new TLorentzVector(0,0,0,0);
-  fX4            = new TLorentzVector(0,0,0,0);
+  fP4 = 0;
+  fX4 = 0;
+
+  this->Reset();
 }
 //___________________________________________________________________________
 void GHepParticle::CleanUp(void)
@@ -432,19 +428,41 @@ void GHepParticle::CleanUp(void)
 //___________________________________________________________________________
 void GHepParticle::Reset(void)
 {
-// deallocate memory + initialize
+// initialize / the momentum & position 4-vectors are re-used if allocated
 
-  this->CleanUp();
-  this->Init();
+  fPdgCode       = 0;
+  fStatus        = kIStUndefined;
+  fRescatterCode = -1;
+  fFirstMother   = -1;
+  fLastMother    = -1;
+  fFirstDaughter = -1;
+  fLastDaughter  = -1;
+  fPolzTheta     = -999; 
+  fPolzPhi       = -999;    
+  fIsBound       = false;
+  fRemovalEnergy = 0.;
+
+  if(fP4) fP4->SetXYZT(0,0,0,0);
+  else    fP4 = new TLorentzVector(0,0,0,0);
+  if(fX4) fX4->SetXYZT(0,0,0,0);
+  else    fX4 = new TLorentzVector(0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::Clear(Option_t * /*option*/)
 {
 // implement the Clear(Option_t *) method so that the GHepParticle when is a
 // member of a GHepRecord, gets deleted properly when calling TClonesArray's
-// Clear("C")
-
+// Clear("C").
+// If GHepRecord re-uses the objects kept in its TClonesArray slots, the 
+// 4-vectors are kept for the next particle stored at the same slot (they
+// get deleted along with the GHepParticle)
+
+#ifdef __GENIE_GHEP_RECYCLE_PARTICLES__
+  if(fP4) fP4->SetXYZT(0,0,0,0);
+  if(fX4) fX4->SetXYZT(0,0,0,0);
+#else
   this->CleanUp();
+#endif
 }
 //___________________________________________________________________________
 void GHepParticle::Print(ostream & stream) const
@@ -550,6 +568,39 @@ void GHepParticle::Copy(const GHepParticle & particle)
   this->fRemovalEnergy = particle.fRemovalEnergy;
 }
 //___________________________________________________________________________
+void GHepParticle::Swap(GHepParticle & particle)
+{
+// Swap the contents of two particles, without creating a temporary one
+// (the 4-vectors are swapped by value and stay with their GHepParticle)
+
+  std::swap(fPdgCode,       particle.fPdgCode      );
+  std::swap(fStatus,        particle.fStatus       );
+  std::swap(fRescatterCode, particle.fRescatterCode);
+  std::swap(fFirstMother,   particle.fFirstMother  );
+  std::swap(fLastMother,    particle.fLastMother   );
+  std::swap(fFirstDaughter, particle.fFirstDaughter);
+  std::swap(fLastDaughter,  particle.fLastDaughter );
+  std::swap(fPolzTheta,     particle.fPolzTheta    );
+  std::swap(fPolzPhi,       particle.fPolzPhi      );
+  std::swap(fRemovalEnergy, particle.fRemovalEnergy);
+  std::swap(fIsBound,       particle.fIsBound      );
+
+  if(fP4 && particle.fP4) {
+    TLorentzVector p4(*fP4);
+    *fP4 = *particle.fP4;
+    *particle.fP4 = p4;
+  } else {
+    std::swap(fP4, particle.fP4);
+  }
+  if(fX4 && particle.fX4) {
+    TLorentzVector x4(*fX4);
+    *fX4 = *particle.fX4;
+    *particle.fX4 = x4;
+  } else {
+    std::swap(fX4, particle.fX4);
+  }
+}
+//___________________________________________________________________________
 void GHepParticle::AssertIsKnownParticle(void) const
 {
   TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
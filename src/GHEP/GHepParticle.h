@@ -5,6 +5,13 @@
 
 \brief   STDHEP-like event record entry that can fit a particle or a nucleus.
 
+         GHepParticle objects are stored in GHepRecord's TClonesArray slots.
+         Where supported by ROOT (TClonesArray::ConstructedAt(), v5.32 and
+         later), the objects left in those slots by a previous event (and
+         their momentum & position 4-vectors) are re-used when new entries
+         are added, so that filling, copying and resetting a GHEP record in
+         the steady-state does no heap allocation.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
 
@@ -22,11 +29,17 @@
 #include <string>
 #include <iostream>
 
+#include <RVersion.h>
 #include <TObject.h>
 #include <TLorentzVector.h>
 
 #include "GHEP/GHepStatus.h"
 
+// Re-use the GHepParticle objects kept in GHepRecord's TClonesArray slots
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,32,0)
+#define __GENIE_GHEP_RECYCLE_PARTICLES__
+#endif
+
 class TRootIOCtor;
 
 using std::string;
@@ -146,11 +159,12 @@ public :
   void SetBound         (bool bound);
   void SetRemovalEnergy (double Erm);
 
-  // Clean-up, reset, copy, print,...
+  // Clean-up, reset, copy, swap, print,...
   void CleanUp (void);
   void Reset   (void);
   void Clear   (Option_t * option);
   void Copy    (const GHepParticle & particle);
+  void Swap    (GHepParticle & particle);
   void Print   (ostream & stream) const;
   void Print   (Option_t * opt)   const;
 
@@ -46,6 +46,14 @@
    Added KinePhaseSpace_t fDiffXSecPhSp prov data members to specify which
    differential cross-section value is stored in fDiffXSec. Added method to 
    set it and tweaked Print() accordingly.
+ @ Oct 17, 2026 - agent
+   The record can be re-used without any heap allocation: Added ParticleSlot()
+   which returns the GHepParticle object kept at a TClonesArray slot (when 
+   supported by ROOT) rather than constructing a new one. AddParticle() and
+   Copy() use it. ResetRecord() re-uses the vertex and flag containers and
+   Copy() copies the flags bit by bit. SwapParticles() swaps the particle
+   contents in place. No TIter (which allocates an iterator) is used in the
+   daughter-list compactifier. Copy() no longer assumes an attached summary.
 */
 //____________________________________________________________________________
 
@@ -530,7 +538,7 @@ void GHepRecord::AddParticle(const GHepParticle & p)
   LOG("GHEP", pINFO)
     << "Adding particle with pdgc = " << p.Pdg() << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(p);
+  this->ParticleSlot(pos)->Copy(p);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -549,7 +557,16 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(pdg,status, mom1,mom2,dau1,dau2, p, v);
+  GHepParticle * particle = this->ParticleSlot(pos);
+  particle->Reset();
+  particle->SetPdgCode       (pdg);
+  particle->SetStatus        (status);
+  particle->SetFirstMother   (mom1);
+  particle->SetLastMother    (mom2);
+  particle->SetFirstDaughter (dau1);
+  particle->SetLastDaughter  (dau2);
+  particle->SetMomentum      (p);
+  particle->SetPosition      (v);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -569,8 +586,16 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ( (*this)[pos] ) GHepParticle (
-            pdg, status, mom1, mom2, dau1, dau2, px, py, pz, E, x, y, z, t);
+  GHepParticle * particle = this->ParticleSlot(pos);
+  particle->Reset();
+  particle->SetPdgCode       (pdg);
+  particle->SetStatus        (status);
+  particle->SetFirstMother   (mom1);
+  particle->SetLastMother    (mom2);
+  particle->SetFirstDaughter (dau1);
+  particle->SetLastDaughter  (dau2);
+  particle->SetMomentum      (px, py, pz, E);
+  particle->SetPosition      (x,  y,  z,  t);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -726,32 +751,27 @@ bool GHepRecord::HasCompactDaughterList(int pos)
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pDEBUG) << "Examining daughter-list of particle at: " << pos;
 #endif
-  vector<int> daughters;
-  GHepParticle * p = 0;
-  TIter iter(this);
-  int i=0;
-  while( (p = (GHepParticle *)iter.Next()) ) {
+  // the daughter list is compact if the (distinct) daughter positions fill
+  // the range between the first and last daughter
+  int ndau = 0;
+  int dau1 = -1;
+  int dau2 = -1;
+  int n = this->GetEntriesFast();
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
+    if(!p) continue;
     if(p->FirstMother() == pos) {
     
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
        LOG("GHEP", pDEBUG) << "Particle at: " << i << " is a daughter";
 #endif
-       daughters.push_back(i);
+       if(ndau == 0) dau1 = i;
+       dau2 = i;
+       ndau++;
     }
-    i++;
   }
 
-  bool is_compact = true;
-  if(daughters.size()>1) {
-    sort(daughters.begin(), daughters.end());
-    vector<int>::iterator diter = daughters.begin();
-    int prev = *diter;
-    for(; diter != daughters.end(); ++diter) {
-       int curr = *diter;
-       is_compact = is_compact && (TMath::Abs(prev-curr)<=1);
-       prev = curr;
-    }
-  }
+  bool is_compact = (ndau < 2 || dau2-dau1+1 == ndau);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pINFO)
       << "Daughter-list of particle at: " << pos << " is "
@@ -762,10 +782,11 @@ bool GHepRecord::HasCompactDaughterList(int pos)
 //___________________________________________________________________________
 int GHepRecord::FirstNonInitStateEntry(void)
 {
-  GHepParticle * p = 0;
-  TIter iter(this);
+  int n = this->GetEntriesFast();
   int pos = 0;
-  while( (p = (GHepParticle *)iter.Next()) ) {
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = (GHepParticle *) this->UncheckedAt(i);
+    if(!p) continue;
     int ist = p->Status();
     if(ist != kIStInitialState && ist != kIStNucleonTarget) return pos;
     pos++;
@@ -785,12 +806,8 @@ void GHepRecord::SwapParticles(int i, int j)
 
   GHepParticle * pi  = this->Particle(i);
   GHepParticle * pj  = this->Particle(j);
-  GHepParticle * tmp = new GHepParticle(*pi);
 
-  pi->Copy(*pj);
-  pj->Copy(*tmp);
-
-  delete tmp;
+  pi->Swap(*pj);
 
   // tell their daughters
   if(pi->HasDaughters()) {
@@ -825,16 +842,17 @@ void GHepRecord::FinalizeDaughterLists(void)
 // Update all daughter-lists based on particle 'first mother' field.
 // To work correctly, the daughter-lists must have been compactified first.
 
-  GHepParticle * p1 = 0;
-  TIter iter1(this);
+  int n = this->GetEntriesFast();
   int i1=0;
-  while( (p1 = (GHepParticle *)iter1.Next()) ) {
+  for(int k1 = 0; k1 < n; k1++) {
+    GHepParticle * p1 = (GHepParticle *) this->UncheckedAt(k1);
+    if(!p1) continue;
     int dau1 = -1;
     int dau2 = -1;
-    GHepParticle * p2 = 0;
-    TIter iter2(this);
     int i2=0;
-    while( (p2 = (GHepParticle *)iter2.Next()) ) {
+    for(int k2 = 0; k2 < n; k2++) {
+       GHepParticle * p2 = (GHepParticle *) this->UncheckedAt(k2);
+       if(!p2) continue;
 
        if(p2->FirstMother() == i1) {
           dau1 = (dau1<0) ? i2 : TMath::Min(dau1,i2);
@@ -897,11 +915,53 @@ void GHepRecord::CleanRecord(void)
 //___________________________________________________________________________
 void GHepRecord::ResetRecord(void)
 {
+// Reset the record so that it can be re-used (eg for the next event).
+// The vertex 4-vector and the event flag / mask bit-fields are re-used and 
+// the GHepParticle objects stay in the TClonesArray slots, so that no heap
+// allocation takes place (see ParticleSlot()).
+
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pDEBUG) << "Reseting GHepRecord";
 #endif
-  this->CleanRecord();
-  this->InitRecord();
+  if(!fVtx || !fEventFlags || !fEventMask) {
+    this->CleanRecord();
+    this->InitRecord();
+    return;
+  }
+
+  if (fInteraction) delete fInteraction;
+  fInteraction=0;
+
+  TClonesArray::Clear("C");
+
+  fWeight       = 1.;
+  fProb         = 1.;
+  fXSec         = 0.;
+  fDiffXSec     = 0.;
+  fDiffXSecPhSp = kPSNull;
+  fVtx->SetXYZT(0,0,0,0);
+
+  fEventFlags -> ResetAllBits(false);
+  for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
+   fEventMask->SetBitNumber(i, true);
+  }
+
+  this->SetOwner(true);
+}
+//___________________________________________________________________________
+GHepParticle * GHepRecord::ParticleSlot(int position)
+{
+// Returns a constructed GHepParticle at the input position of the underlying
+// TClonesArray, to be filled by the caller.
+// If supported by ROOT, the GHepParticle left at that slot by a previous 
+// use of the record is returned, so that neither the GHepParticle nor its
+// 4-vectors are re-allocated. Otherwise a new one is constructed in place.
+
+#ifdef __GENIE_GHEP_RECYCLE_PARTICLES__
+  return (GHepParticle *) this->ConstructedAt(position);
+#else
+  return new ((*this)[position]) GHepParticle();
+#endif
 }
 //___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
@@ -934,18 +994,37 @@ void GHepRecord::Copy(const GHepRecord & record)
   this->ResetRecord();
 
   // copy event record entries
-  unsigned int ientry = 0;
-  GHepParticle * p = 0;
-  TIter ghepiter(&record);
-  while ( (p = (GHepParticle *) ghepiter.Next()) )
-                              new ( (*this)[ientry++] ) GHepParticle(*p);
+  int ientry = 0;
+  int n = record.GetEntriesFast();
+  for(int i = 0; i < n; i++) {
+    GHepParticle * p = (GHepParticle *) record.UncheckedAt(i);
+    if(!p) continue;
+    this->ParticleSlot(ientry++)->Copy(*p);
+  }
 
   // copy summary
-  fInteraction = new Interaction( *record.fInteraction );
+  if(record.fInteraction) {
+    fInteraction = new Interaction( *record.fInteraction );
+  }
 
   // copy flags & mask
-  *fEventFlags = *(record.EventFlags());
-  *fEventMask  = *(record.EventMask());
+  // (bit by bit, as TBits' assignment operator re-allocates the bit-field)
+  TBits * flags = record.EventFlags();
+  TBits * mask  = record.EventMask();
+  if(flags->GetNbits() == fEventFlags->GetNbits()) {
+    for(unsigned int i = 0; i < flags->GetNbits(); i++) {
+      fEventFlags->SetBitNumber(i, flags->TestBitNumber(i));
+    }
+  } else {
+    *fEventFlags = *flags;
+  }
+  if(mask->GetNbits() == fEventMask->GetNbits()) {
+    for(unsigned int i = 0; i < mask->GetNbits(); i++) {
+      fEventMask->SetBitNumber(i, mask->TestBitNumber(i));
+    }
+  } else {
+    *fEventMask = *mask;
+  }
 
   // copy vtx position
   TLorentzVector * v = record.Vertex();
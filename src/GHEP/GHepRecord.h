@@ -174,8 +174,9 @@ protected:
   KinePhaseSpace_t fDiffXSecPhSp;   ///< specifies which differential cross-section (dsig/dQ2, dsig/dQ2dW, dsig/dxdy,...)
 
   // Utility methods
-  void InitRecord  (void);
-  void CleanRecord (void);
+  void           InitRecord   (void);
+  void           CleanRecord  (void);
+  GHepParticle * ParticleSlot (int position);
 
   // Methods used by the daughter list compactifier
   virtual void UpdateDaughterLists    (void);
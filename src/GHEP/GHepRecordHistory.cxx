@@ -10,6 +10,10 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - agent
+   Purged snapshots are kept and re-used for new snapshots rather than being
+   deleted and re-allocated. Fixed PurgeRecentHistory() which erased map 
+   entries while iterating and leaked the corresponding snapshots.
 
 */
 //____________________________________________________________________________
@@ -51,6 +55,12 @@ map<int, GHepRecord*>()
 GHepRecordHistory::~GHepRecordHistory()
 {
   this->PurgeHistory();
+
+  vector<GHepRecord *>::iterator spare_iter = fSpareRecords.begin();
+  for( ; spare_iter != fSpareRecords.end(); ++spare_iter) {
+    delete (*spare_iter);
+  }
+  fSpareRecords.clear();
 }
 //___________________________________________________________________________
 void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
@@ -71,7 +81,15 @@ void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
      LOG("GHEP", pNOTICE)
                      << "Adding GHEP snapshot for processing step: " << step;
 
-     GHepRecord * snapshot = new GHepRecord(*record);
+     // re-use a previously purged snapshot, if any
+     GHepRecord * snapshot = 0;
+     if(fSpareRecords.size() > 0) {
+       snapshot = fSpareRecords.back();
+       fSpareRecords.pop_back();
+       snapshot->Copy(*record);
+     } else {
+       snapshot = new GHepRecord(*record);
+     }
      this->insert( map<int, GHepRecord*>::value_type(step,snapshot));
 
   } else {
@@ -97,8 +115,7 @@ void GHepRecordHistory::PurgeHistory(void)
 
     GHepRecord * record = history_iter->second;
     if(record) {
-      delete record;
-      record = 0;
+      fSpareRecords.push_back(record);
     }
   }
   this->clear();
@@ -127,15 +144,20 @@ void GHepRecordHistory::PurgeRecentHistory(int start_step)
     return;
   }
 
-  GHepRecordHistory::iterator history_iter;
-  for(history_iter = this->begin();
-                              history_iter != this->end(); ++history_iter) {
+  GHepRecordHistory::iterator history_iter = this->begin();
+  while(history_iter != this->end()) {
 
     if(history_iter->first >= start_step) { 
        int step = history_iter->first;
        LOG("GHEP", pINFO) 
                   << "Deleting GHEP snapshot for processing step: " << step;
-       this->erase(history_iter); 
+       GHepRecord * record = history_iter->second;
+       if(record) {
+         fSpareRecords.push_back(record);
+       }
+       this->erase(history_iter++); 
+    } else {
+       ++history_iter;
     }
   }
 }
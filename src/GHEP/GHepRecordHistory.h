@@ -8,6 +8,9 @@
           The event record history can be used to step back in the generation
           sequence if a processing step is to be re-run (this the GENIE event
           generation framework equivalent of an 'Undo')
+          Purged snapshots are kept aside and re-used (see GHepRecord::Copy())
+          for the snapshots of the next event, rather than being deleted and
+          re-allocated for every event.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
@@ -24,10 +27,12 @@
 #define _GHEP_RECORD_HISTORY_H_
 
 #include <map>
+#include <vector>
 #include <string>
 #include <ostream>
 
 using std::map;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -57,6 +62,8 @@ private:
 
   bool fEnabledFull;          ///< keep the full GHEP record history
   bool fEnabledBootstrapStep; ///< keep only the record that bootsrapped the generation cycle
+
+  vector<GHepRecord *> fSpareRecords; ///< purged snapshots, to be re-used
 };
 
 }      // genie namespace
@@ -0,0 +1,342 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+#include <Rtypes.h>
+#include <TMath.h>
+
+#include "Geo/GeomVoxelMap.h"
+#include "Messenger/Messenger.h"
+
+using std::ifstream;
+using std::ofstream;
+using std::ios;
+
+using namespace genie;
+using namespace genie::geometry;
+
+//____________________________________________________________________________
+// Binary voxel map file layout (all numbers in the native byte order):
+// - header (see GeomVoxelMapHeader)
+// - material names: for each material, the name length (UInt_t) followed
+//   by the name (not null-terminated)
+// - voxels: nx*ny*nz material indices (UShort_t), x running fastest
+//
+namespace {
+  const char   kGeomVoxelMapMagic[8] = {'G','E','N','I','E','V','O','X'};
+  const UInt_t kGeomVoxelMapVersion  = 1;
+  const UInt_t kGeomVoxelMapBOM      = 0x01020304;
+
+  struct GeomVoxelMapHeader {
+    char     magic[8];     // kGeomVoxelMapMagic
+    UInt_t   version;      // kGeomVoxelMapVersion
+    UInt_t   bom;          // kGeomVoxelMapBOM, to catch byte order mismatches
+    UInt_t   nx, ny, nz;   // number of voxels
+    UInt_t   nmaterials;   // number of materials
+    Double_t min[3];       // bounding box
+    Double_t max[3];
+  };
+}
+
+//____________________________________________________________________________
+namespace genie {
+ namespace geometry {
+   ostream & operator << (ostream & stream, const GeomVoxelMap & vmap)
+   {
+     vmap.Print(stream);
+     return stream;
+   }
+ }
+}
+//____________________________________________________________________________
+GeomVoxelMap::GeomVoxelMap() :
+fMin (0,0,0),
+fMax (0,0,0),
+fNX  (0),
+fNY  (0),
+fNZ  (0)
+{
+  fMaterials.push_back("");
+}
+//____________________________________________________________________________
+GeomVoxelMap::GeomVoxelMap(
+   const TVector3 & min, const TVector3 & max, int nx, int ny, int nz) :
+fMin (min),
+fMax (max),
+fNX  (nx),
+fNY  (ny),
+fNZ  (nz)
+{
+  assert(nx > 0 && ny > 0 && nz > 0);
+
+  fMaterials.push_back("");
+  fVoxels.assign(nx*ny*nz, 0);
+}
+//____________________________________________________________________________
+GeomVoxelMap::~GeomVoxelMap()
+{
+
+}
+//____________________________________________________________________________
+int GeomVoxelMap::AddMaterial(string name)
+{
+  vector<string>::const_iterator iter =
+        std::find(fMaterials.begin()+1, fMaterials.end(), name);
+  if(iter != fMaterials.end()) return (iter - fMaterials.begin());
+
+  if(fMaterials.size() > 0xffff) {
+     LOG("GeomVoxelMap", pFATAL)
+       << "Too many materials (> " << 0xffff << ") for a voxel map";
+     exit(1);
+  }
+  fMaterials.push_back(name);
+  return fMaterials.size() - 1;
+}
+//____________________________________________________________________________
+TVector3 GeomVoxelMap::VoxelSize(void) const
+{
+  TVector3 size = fMax - fMin;
+  return TVector3(size.X()/fNX, size.Y()/fNY, size.Z()/fNZ);
+}
+//____________________________________________________________________________
+TVector3 GeomVoxelMap::VoxelCentre(int ix, int iy, int iz) const
+{
+  TVector3 size = this->VoxelSize();
+  return TVector3(fMin.X() + (ix+0.5)*size.X(),
+                  fMin.Y() + (iy+0.5)*size.Y(),
+                  fMin.Z() + (iz+0.5)*size.Z());
+}
+//____________________________________________________________________________
+void GeomVoxelMap::SetMaterial(int ix, int iy, int iz, int imat)
+{
+  assert(imat >= 0 && imat < this->NMaterials());
+  fVoxels[this->Index(ix,iy,iz)] = imat;
+}
+//____________________________________________________________________________
+void GeomVoxelMap::Traverse(
+  const TVector3 & r0, const TVector3 & udir, vector<GeomVoxelStep> & steps) const
+{
+// 3D-DDA traversal of the voxel grid (J.Amanatides & A.Woo, Eurographics'87).
+// The ray is first clipped to the bounding box, then followed from voxel to
+// voxel by always crossing the closest of the x, y and z voxel boundaries.
+// Distances along the ray are in the units of the map (top vol units).
+
+  steps.clear();
+  if(fVoxels.size() == 0) return;
+
+  const double kHuge = 1E30;
+
+  double r   [3] = { r0.X(),   r0.Y(),   r0.Z()   };
+  double u   [3] = { udir.X(), udir.Y(), udir.Z() };
+  double lo  [3] = { fMin.X(), fMin.Y(), fMin.Z() };
+  double hi  [3] = { fMax.X(), fMax.Y(), fMax.Z() };
+  int    n   [3] = { fNX,      fNY,      fNZ      };
+  double size[3];
+
+  // clip the ray to the bounding box
+  double tmin = 0;
+  double tmax = kHuge;
+  for(int a = 0; a < 3; a++) {
+    size[a] = (hi[a]-lo[a])/n[a];
+    if(u[a] == 0) {
+      if(r[a] < lo[a] || r[a] > hi[a]) return;
+      continue;
+    }
+    double t1 = (lo[a]-r[a])/u[a];
+    double t2 = (hi[a]-r[a])/u[a];
+    if(t1 > t2) std::swap(t1,t2);
+    tmin = TMath::Max(tmin,t1);
+    tmax = TMath::Min(tmax,t2);
+  }
+  if(tmin >= tmax) return;
+
+  // voxel where the ray enters the grid & distances to the next boundaries
+  int    i     [3];
+  int    istep [3];
+  double tnext [3];
+  double tdelta[3];
+  for(int a = 0; a < 3; a++) {
+    double x = r[a] + tmin*u[a];
+    i[a] = TMath::Min(TMath::Max(int((x-lo[a])/size[a]), 0), n[a]-1);
+    if(u[a] > 0) {
+      istep [a] = 1;
+      tnext [a] = (lo[a] + (i[a]+1)*size[a] - r[a])/u[a];
+      tdelta[a] = size[a]/u[a];
+    } else if(u[a] < 0) {
+      istep [a] = -1;
+      tnext [a] = (lo[a] + i[a]*size[a] - r[a])/u[a];
+      tdelta[a] = -size[a]/u[a];
+    } else {
+      istep [a] = 0;
+      tnext [a] = kHuge;
+      tdelta[a] = kHuge;
+    }
+  }
+
+  double t = tmin;
+  while(t < tmax) {
+    int a = (tnext[0] < tnext[1]) ?
+               ((tnext[0] < tnext[2]) ? 0 : 2) :
+               ((tnext[1] < tnext[2]) ? 1 : 2);
+    double texit = TMath::Min(tnext[a], tmax);
+
+    int imat = fVoxels[this->Index(i[0],i[1],i[2])];
+    if(imat != 0 && texit > t) {
+      if(steps.size() > 0 &&
+         steps.back().fMaterial == imat && steps.back().fTMax == t) {
+        steps.back().fTMax = texit;
+      } else {
+        GeomVoxelStep step;
+        step.fMaterial = imat;
+        step.fTMin     = t;
+        step.fTMax     = texit;
+        steps.push_back(step);
+      }
+    }
+    t = TMath::Max(t,texit);
+
+    i[a] += istep[a];
+    if(i[a] < 0 || i[a] >= n[a]) break;
+    tnext[a] += tdelta[a];
+  }
+}
+//____________________________________________________________________________
+bool GeomVoxelMap::SaveAsBinary(string filename) const
+{
+  LOG("GeomVoxelMap", pNOTICE) << "Saving voxel map in file: " << filename;
+
+  ofstream out(filename.c_str(), ios::out | ios::binary);
+  if(!out.is_open()) {
+    LOG("GeomVoxelMap", pERROR) << "Couldn't create file = " << filename;
+    return false;
+  }
+
+  GeomVoxelMapHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kGeomVoxelMapMagic, sizeof(header.magic));
+  header.version    = kGeomVoxelMapVersion;
+  header.bom        = kGeomVoxelMapBOM;
+  header.nx         = fNX;
+  header.ny         = fNY;
+  header.nz         = fNZ;
+  header.nmaterials = fMaterials.size();
+  fMin.GetXYZ(header.min);
+  fMax.GetXYZ(header.max);
+
+  out.write((const char *) &header, sizeof(header));
+  for(unsigned int imat = 0; imat < fMaterials.size(); imat++) {
+    UInt_t len = fMaterials[imat].size();
+    out.write((const char *) &len, sizeof(len));
+    out.write(fMaterials[imat].data(), len);
+  }
+  if(fVoxels.size() > 0) {
+    out.write((const char *) &fVoxels[0], fVoxels.size() * sizeof(unsigned short));
+  }
+  bool ok = out.good();
+  out.close();
+
+  if(!ok) {
+    LOG("GeomVoxelMap", pERROR) << "Error writing file = " << filename;
+  }
+  return ok;
+}
+//____________________________________________________________________________
+bool GeomVoxelMap::LoadFromBinary(string filename)
+{
+  LOG("GeomVoxelMap", pNOTICE) << "Loading voxel map from file: " << filename;
+
+  ifstream inp(filename.c_str(), ios::in | ios::binary);
+  if(!inp.is_open()) {
+    LOG("GeomVoxelMap", pERROR)
+       << "Voxel map file could not be opened! [filename: " << filename << "]";
+    return false;
+  }
+
+  GeomVoxelMapHeader header;
+  inp.read((char *) &header, sizeof(header));
+  bool ok = inp.good() &&
+     memcmp(header.magic, kGeomVoxelMapMagic, sizeof(header.magic)) == 0 &&
+     header.version == kGeomVoxelMapVersion &&
+     header.bom     == kGeomVoxelMapBOM &&
+     header.nx > 0 && header.ny > 0 && header.nz > 0 &&
+     header.nmaterials > 0 && header.nmaterials <= 0x10000;
+  if(!ok) {
+    LOG("GeomVoxelMap", pERROR)
+       << "Not a voxel map file or unsupported version / byte order! [filename: "
+       << filename << "]";
+    return false;
+  }
+
+  vector<string> materials(header.nmaterials);
+  for(unsigned int imat = 0; imat < header.nmaterials && inp.good(); imat++) {
+    UInt_t len = 0;
+    inp.read((char *) &len, sizeof(len));
+    if(!inp.good() || len > 4096) { ok = false; break; }
+    vector<char> name(len+1, 0);
+    inp.read(&name[0], len);
+    materials[imat] = string(&name[0], len);
+  }
+  vector<unsigned short> voxels(header.nx * header.ny * header.nz);
+  if(ok) {
+    inp.read((char *) &voxels[0], voxels.size() * sizeof(unsigned short));
+    ok = inp.good();
+  }
+  for(unsigned int iv = 0; ok && iv < voxels.size(); iv++) {
+    ok = (voxels[iv] < header.nmaterials);
+  }
+  inp.close();
+
+  if(!ok) {
+    LOG("GeomVoxelMap", pERROR)
+       << "Voxel map file is truncated or corrupted! [filename: " << filename << "]";
+    return false;
+  }
+
+  fNX = header.nx;
+  fNY = header.ny;
+  fNZ = header.nz;
+  fMin.SetXYZ(header.min[0], header.min[1], header.min[2]);
+  fMax.SetXYZ(header.max[0], header.max[1], header.max[2]);
+  fMaterials.swap(materials);
+  fVoxels.swap(voxels);
+
+  LOG("GeomVoxelMap", pNOTICE) << *this;
+
+  return true;
+}
+//____________________________________________________________________________
+void GeomVoxelMap::Print(ostream & stream) const
+{
+  TVector3 size = this->VoxelSize();
+
+  stream << "\n Voxel map: "
+         << fNX << " x " << fNY << " x " << fNZ << " voxels";
+  stream << "\n  |-- bounding box : ("
+         << fMin.X() << ", " << fMin.Y() << ", " << fMin.Z() << ") -> ("
+         << fMax.X() << ", " << fMax.Y() << ", " << fMax.Z() << ")";
+  stream << "\n  |-- voxel size   : "
+         << size.X() << " x " << size.Y() << " x " << size.Z();
+  stream << "\n  |-- materials    : " << this->NMaterials() - 1;
+  for(int imat = 1; imat < this->NMaterials(); imat++) {
+    stream << "\n  |     [" << imat << "] " << fMaterials[imat];
+  }
+  stream << "\n";
+}
+//____________________________________________________________________________
@@ -0,0 +1,105 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::geometry::GeomVoxelMap
+
+\brief    A voxelized map of the materials found in a ROOT geometry.
+          The bounding box of the top volume is divided in nx x ny x nz
+          voxels and each voxel is assigned the material found at its centre
+          (or the most frequent material found at a grid of points within
+          the voxel). The map is built once per geometry (see
+          ROOTGeomAnalyzer::BuildVoxelMap()) and can be saved in a binary
+          file so that subsequent jobs only have to load it.
+          Rays are followed through the voxel grid with a 3D-DDA (Amanatides
+          & Woo) traversal, which is much faster than swimming through the
+          ROOT geometry volume by volume. The price is that material
+          boundaries are only known to within a voxel size.
+
+          Materials are referenced by name, so that the map doesn't depend
+          on the length / density units or on the weighting options of the
+          geometry driver. Material 0 marks voxels outside the top volume.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _GEOM_VOXEL_MAP_H_
+#define _GEOM_VOXEL_MAP_H_
+
+#include <vector>
+#include <string>
+#include <ostream>
+
+#include <TVector3.h>
+
+using std::vector;
+using std::string;
+using std::ostream;
+
+namespace genie {
+namespace geometry {
+
+/// a part of a ray crossing voxels of the same material
+struct GeomVoxelStep {
+  int    fMaterial; ///< material index
+  double fTMin;     ///< distance along the ray at which the material is entered
+  double fTMax;     ///< distance along the ray at which the material is left
+};
+
+class GeomVoxelMap {
+
+public :
+  GeomVoxelMap();
+  GeomVoxelMap(const TVector3 & min, const TVector3 & max, int nx, int ny, int nz);
+ ~GeomVoxelMap();
+
+  /// materials
+  int            AddMaterial  (string name); ///< returns the material index
+  int            NMaterials   (void)     const { return fMaterials.size(); }
+  const string & MaterialName (int imat) const { return fMaterials[imat]; }
+
+  /// voxels
+  int              NX          (void) const { return fNX;  }
+  int              NY          (void) const { return fNY;  }
+  int              NZ          (void) const { return fNZ;  }
+  const TVector3 & Min         (void) const { return fMin; }
+  const TVector3 & Max         (void) const { return fMax; }
+  TVector3         VoxelSize   (void) const;
+  TVector3         VoxelCentre (int ix, int iy, int iz) const;
+  int              Material    (int ix, int iy, int iz) const { return fVoxels[this->Index(ix,iy,iz)]; }
+  void             SetMaterial (int ix, int iy, int iz, int imat);
+
+  /// follow the ray starting at r0 along the unit vector udir through the
+  /// voxel grid; consecutive voxels of the same material are merged
+  void Traverse (const TVector3 & r0, const TVector3 & udir, vector<GeomVoxelStep> & steps) const;
+
+  /// save / load the map to / from a binary file
+  bool SaveAsBinary   (string filename) const;
+  bool LoadFromBinary (string filename);
+
+  void Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const GeomVoxelMap & vmap);
+
+private:
+
+  int Index (int ix, int iy, int iz) const { return (iz*fNY + iy)*fNX + ix; }
+
+  TVector3               fMin;       ///< bounding box corner (top vol coord & units)
+  TVector3               fMax;       ///< opposite bounding box corner
+  int                    fNX;        ///< number of voxels along x
+  int                    fNY;        ///< number of voxels along y
+  int                    fNZ;        ///< number of voxels along z
+  vector<string>         fMaterials; ///< material names (0: outside the top volume)
+  vector<unsigned short> fVoxels;    ///< material index for each voxel
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+#endif // _GEOM_VOXEL_MAP_H_
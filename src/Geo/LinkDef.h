@@ -24,6 +24,7 @@
 #pragma link C++ class genie::geometry::FidCylinder;
 #pragma link C++ class genie::geometry::FidPolyhedron;
 #pragma link C++ class genie::geometry::GeomVolSelectorFiducial;
+#pragma link C++ class genie::geometry::GeomVoxelMap;
 
 #pragma link C++ function genie::geometry::operator<<(ostream&, const genie::geometry::RayIntercept&);
 #pragma link C++ function genie::geometry::operator<<(ostream&, const genie::geometry::PlaneParam&);
@@ -82,14 +82,33 @@
    Previously used TString::Contains("vol2match") which did not require the string
    length to be the same and sometime lead to degeneracies and selection of 
    incorrect top volume. Bug and fix were found by Kevin Connolly.   
+ @ Oct 17, 2026 - agent
+   Added an optional voxelized material map (see GeomVoxelMap) which, if set,
+   is used in ComputePathLengths() instead of swimming through the geometry.
+   The map can be built with BuildVoxelMap() and saved / loaded to / from a
+   binary file. In validation mode (SetValidateVoxelMap()) the path-lengths
+   from the map are compared with the ones obtained by swimming, which are
+   then used.
+   The max path length scanners (box & flux methods) can be run by several
+   worker processes (SetScannerNWorkers()), each one following its share of
+   the rays through its own copy of the geometry. Results are max-merged.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
 #include <cstdlib>
+#include <cstdio>
+#include <iostream>
 #include <iomanip>
 #include <set>
+#include <map>
+
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
 
 #include <TGeoVolume.h>
 #include <TGeoManager.h>
@@ -110,6 +129,7 @@
 #include "Conventions/Units.h"
 #include "Conventions/Controls.h"
 #include "Geo/PathSegmentList.h"
+#include "Geo/GeomVoxelMap.h"
 #include "EVGDrivers/PathLengthList.h"
 #include "EVGDrivers/GFluxI.h"
 #include "Geo/ROOTGeomAnalyzer.h"
@@ -175,6 +195,13 @@ ROOTGeomAnalyzer::~ROOTGeomAnalyzer()
       << "ROOTGeomAnalyzer " 
       << " mxddist " << fmxddist
       << " mxdstep " << fmxdstep; 
+
+  if ( fVoxelNRays > 0 )
+    LOG("GROOTGeom",pNOTICE)
+      << "Voxel map validation: " << fVoxelNRays << " rays, "
+      << "path-length difference wrt swimming: average = "
+      << ((fVoxelSumPl > 0) ? 100*fVoxelSumDiff/fVoxelSumPl : 0.) << "%, "
+      << "max = " << 100*fVoxelMaxRelDiff << "%";
 }
 
 //===========================================================================
@@ -205,13 +232,17 @@ const PathLengthList & ROOTGeomAnalyzer::ComputeMaxPathLengths(void)
   fCurrMaxPathLengthList->SetAllToZero();
 
   //-- select maximum path length calculation method
-  if ( fFlux ) {
+  if ( fNWorkers > 1 ) {
+    this->MaxPathLengthsInParallel();
+  } else if ( fFlux ) {
     this->MaxPathLengthsFluxMethod();
+  } else {
+    this->MaxPathLengthsBoxMethod();
+  }
+  if ( fFlux ) {
     // clear any accumulated exposure accounted generated 
     // while exploring the geometry
     fFlux->Clear("CycleHistory");
-  } else {
-    this->MaxPathLengthsBoxMethod();
   }
 
   return *fCurrMaxPathLengthList;
@@ -254,6 +285,15 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
   // reset current list of path-lengths
   fCurrPathLengthList->SetAllToZero();
 
+  // use the voxelized material map, if any
+  // (the path segments can't be trimmed using the voxel map)
+  if ( fVoxelMap && !fGeomVolSelector ) {
+    this->VoxelPathLengths(pos,udir);
+    if ( fValidateVoxelMap ) this->CompareVoxelPathLengths(pos,udir);
+    this->Local2SI(*fCurrPathLengthList); // curr geom units -> SI
+    return *fCurrPathLengthList;
+  }
+
   //loop over materials & compute the path-length
   vector<int>::iterator itr;
   for (itr=fCurrPDGCodeList->begin();itr!=fCurrPDGCodeList->end();itr++) {
@@ -317,6 +357,22 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
   }
 
   double maxwgt_dist = this->ComputePathLengthPDG(pos,udir,tgtpdg);
+  if ( maxwgt_dist <= 0 && fVoxelMap && !fGeomVolSelector ) {
+    // The material was selected using the path-lengths from the voxel map
+    // but it is only met within a voxel size from the ray. Place the vertex
+    // in the voxel where the voxel map sees that material.
+    LOG("GROOTGeom", pWARN)
+     << "The current trajectory crosses the selected material only in the "
+     << "voxel map - Generating the vertex using the voxel map";
+    if ( this->GenerateVoxelVertex(pos,udir,tgtpdg,pos) ) {
+      if (!fMasterToTopIsIdentity) {
+        this->Top2Master(pos); // transform position (top -> master)
+      }
+      this->Local2SI(pos);     // curr geom units -> SI
+      fCurrVertex->SetXYZ(pos[0],pos[1],pos[2]);
+      return *fCurrVertex;
+    }
+  }
   if ( maxwgt_dist <= 0 ) {
     LOG("GROOTGeom", pERROR)
      << "The current trajectory does not cross the selected material!!";
@@ -510,6 +566,21 @@ void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
   fMixtWghtSum = sum;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SetScannerNWorkers(int nw)
+{
+/// Set the number of worker processes used by the max path length scanners.
+/// Each worker follows its share of the scanning rays (or flux neutrinos)
+/// through its own copy of the geometry and the results are merged at the
+/// end of the scan.
+
+  fNWorkers = TMath::Max(1,nw);
+  fWorker   = 0;
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Max path length scanner worker processes: " << fNWorkers;
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::SetTopVolName(string name)
 {
@@ -557,6 +628,162 @@ void ROOTGeomAnalyzer::SetTopVolName(string name)
   // set volume name
   fTopVolume = gvol;
   fGeometry->SetTopVolume(fTopVolume);
+
+  // a voxel map built for another top volume can't be used
+  if ( fVoxelMap ) {
+    LOG("GROOTGeom",pWARN)
+      << "The top volume has changed - Dropping the current voxel map";
+    this->AdoptVoxelMap(0);
+  }
+}
+
+//===========================================================================
+// Voxelized material map:
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::BuildVoxelMap(int nx, int ny, int nz, int nsub)
+{
+/// Build a voxelized map of the materials within the bounding box of the
+/// top volume, using nx x ny x nz voxels. Each voxel is assigned the most
+/// frequent material found at a grid of nsub x nsub x nsub points within
+/// the voxel (for nsub = 1, the material at the voxel centre).
+/// Once built, the map is used by ComputePathLengths(). The map has to be
+/// rebuilt whenever the geometry or the top volume is changed.
+
+  if (!fGeometry || !fTopVolume) {
+      LOG("GROOTGeom", pFATAL) << "No ROOT geometry is loaded!!";
+      exit(1);
+  }
+  nsub = TMath::Max(1,nsub);
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Building a " << nx << " x " << ny << " x " << nz << " voxel map of "
+    << "the top volume materials (" << nsub*nsub*nsub << " point(s)/voxel)";
+
+  TGeoBBox * box = (TGeoBBox *) fTopVolume->GetShape();
+  const Double_t * origin = box->GetOrigin();
+  TVector3 min(origin[0]-box->GetDX(), origin[1]-box->GetDY(), origin[2]-box->GetDZ());
+  TVector3 max(origin[0]+box->GetDX(), origin[1]+box->GetDY(), origin[2]+box->GetDZ());
+
+  GeomVoxelMap * vmap = new GeomVoxelMap(min,max,nx,ny,nz);
+  TVector3 size = vmap->VoxelSize();
+
+  std::map<const TGeoMaterial *, int> matidx;
+  std::map<const TGeoMaterial *, int>::const_iterator matiter;
+  std::map<int, int> nfound;
+  std::map<int, int>::const_iterator founditer;
+
+  const int npoints = nsub*nsub*nsub;
+
+  for (int iz = 0; iz < nz; iz++) {
+    for (int iy = 0; iy < ny; iy++) {
+      for (int ix = 0; ix < nx; ix++) {
+        nfound.clear();
+        for (int ip = 0; ip < npoints; ip++) {
+          double x = min.X() + (ix + ( ip              %nsub + 0.5)/nsub) * size.X();
+          double y = min.Y() + (iy + ((ip/nsub)        %nsub + 0.5)/nsub) * size.Y();
+          double z = min.Z() + (iz + ( ip/(nsub*nsub)        + 0.5)/nsub) * size.Z();
+          int imat = 0;
+          TGeoNode * node = fGeometry->FindNode(x,y,z);
+          if ( node && !fGeometry->IsOutside() ) {
+            const TGeoMaterial * mat = node->GetVolume()->GetMedium()->GetMaterial();
+            matiter = matidx.find(mat);
+            if ( matiter != matidx.end() ) {
+              imat = matiter->second;
+            } else {
+              imat = vmap->AddMaterial(mat->GetName());
+              matidx[mat] = imat;
+            }
+          }
+          nfound[imat]++;
+        }
+        int imat = 0, nmax = 0;
+        for (founditer = nfound.begin(); founditer != nfound.end(); ++founditer) {
+          if ( founditer->second > nmax ) {
+            imat = founditer->first;
+            nmax = founditer->second;
+          }
+        }
+        vmap->SetMaterial(ix,iy,iz,imat);
+      }
+    }
+    LOG("GROOTGeom", pINFO)
+      << "Voxel map: Done z-slice " << iz+1 << " / " << nz;
+  }
+
+  LOG("GROOTGeom", pNOTICE) << *vmap;
+
+  this->AdoptVoxelMap(vmap);
+}
+
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::LoadVoxelMap(string filename)
+{
+/// Load a voxel map (see BuildVoxelMap()) from the input binary file.
+/// The map must have been built for the current geometry & top volume.
+
+  GeomVoxelMap * vmap = new GeomVoxelMap;
+  if ( ! vmap->LoadFromBinary(filename) ) {
+    delete vmap;
+    return false;
+  }
+
+  // check that the map covers the bounding box of the current top volume
+  TGeoBBox * box = (TGeoBBox *) fTopVolume->GetShape();
+  const Double_t * origin = box->GetOrigin();
+  double half[3] = { box->GetDX(), box->GetDY(), box->GetDZ() };
+  double vmin[3] = { vmap->Min().X(), vmap->Min().Y(), vmap->Min().Z() };
+  double vmax[3] = { vmap->Max().X(), vmap->Max().Y(), vmap->Max().Z() };
+  bool ok = true;
+  for (int i = 0; i < 3; i++) {
+    double tol = 1E-6 * half[i];
+    ok = ok && TMath::Abs(vmin[i] - (origin[i]-half[i])) <= tol
+            && TMath::Abs(vmax[i] - (origin[i]+half[i])) <= tol;
+  }
+  if (!ok) {
+    LOG("GROOTGeom", pERROR)
+      << "The voxel map in " << filename 
+      << " doesn't match the bounding box of the current top volume";
+  }
+
+  // check that all the materials can be found
+  for (int imat = 1; ok && imat < vmap->NMaterials(); imat++) {
+    if ( ! fGeometry->GetMaterial(vmap->MaterialName(imat).c_str()) ) {
+      LOG("GROOTGeom", pERROR)
+        << "The voxel map in " << filename << " refers to material "
+        << vmap->MaterialName(imat) << " which is not in the current geometry";
+      ok = false;
+    }
+  }
+
+  if (!ok) {
+    delete vmap;
+    return false;
+  }
+
+  this->AdoptVoxelMap(vmap);
+  return true;
+}
+
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::SaveVoxelMap(string filename) const
+{
+  if (!fVoxelMap) {
+    LOG("GROOTGeom", pERROR) << "No voxel map to save!";
+    return false;
+  }
+  return fVoxelMap->SaveAsBinary(filename);
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::AdoptVoxelMap(GeomVoxelMap * vmap)
+{
+/// Take ownership of the input voxel map (replacing the current one, if any).
+/// Use 0 to go back to swimming through the geometry.
+
+  if ( fVoxelMap && fVoxelMap != vmap ) delete fVoxelMap;
+  fVoxelMap = vmap;
+  fVoxelWeights.clear();
 }
 
 //===========================================================================
@@ -731,11 +958,20 @@ void ROOTGeomAnalyzer::Initialize(void)
   fTopVolume             = 0;
   fTopVolumeName         = "";
   fKeepSegPath           = false;
+  fVoxelMap              = 0;
+  fValidateVoxelMap      = false;
+  fVoxelWeightsDensWeight  = false;
+  fVoxelWeightsMixtWghtSum = 0;
+  fVoxelNRays            = 0;
+  fVoxelSumDiff          = 0;
+  fVoxelSumPl            = 0;
+  fVoxelMaxRelDiff       = 0;
 
   // some defaults:
   this -> SetScannerNPoints    (200);
   this -> SetScannerNRays      (200);
   this -> SetScannerNParticles (10000);
+  this -> SetScannerNWorkers   (1);
   this -> SetScannerFlux       (0);
   this -> SetMaxPlSafetyFactor (1.1);
   this -> SetLengthUnits       (genie::units::meter);
@@ -760,6 +996,7 @@ void ROOTGeomAnalyzer::CleanUp(void)
   if ( fCurrMaxPathLengthList ) delete fCurrMaxPathLengthList;
   if ( fCurrPDGCodeList       ) delete fCurrPDGCodeList;
   if ( fMasterToTop           ) delete fMasterToTop;
+  if ( fVoxelMap              ) delete fVoxelMap;
 }
 
 //___________________________________________________________________________
@@ -1066,13 +1303,20 @@ void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
       << "max path lengths with FLUX method forcing Enu=" << emax;
   }
 
-  while (iparticle < nparticles ) {
+  // if the scan is run by several workers, each worker follows its own share
+  // of the flux neutrinos
+  const int nworker_particles = (nparticles + fNWorkers - 1 - fWorker) / fNWorkers;
+  long int iflux = -1;
+
+  while (iparticle < nworker_particles ) {
 
     bool ok = fFlux->GenerateNext();
     if (!ok) {
        LOG("GROOTGeom", pWARN) << "Couldn't generate a flux neutrino";
        continue;
     }
+    iflux++;
+    if ( iflux % fNWorkers != fWorker ) continue;
 
     TLorentzVector   nup4  = fFlux->Momentum();
     if ( rescale_e ) {
@@ -1128,6 +1372,10 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 
   while ( (ok = this->GenBoxRay(iparticle++,nux4,nup4)) ) {
 
+    // if the scan is run by several workers, each worker follows its own
+    // share of the rays (all workers generate the same rays)
+    if ( (iparticle-1) % fNWorkers != fWorker ) continue;
+
     //LOG("GMCJDriver", pNOTICE)
     //  << "\n [-] Generated flux neutrino: "
     //  << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
@@ -1178,6 +1426,116 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::MaxPathLengthsInParallel(void)
+{
+/// Run the max path length scanner (flux method if a flux driver was set,
+/// box method otherwise) using fNWorkers worker processes. Every worker 
+/// generates the same sequence of rays (or flux neutrinos) but only follows
+/// its own share of them through its own copy of the geometry. The max path
+/// lengths found by each worker are then merged.
+/// For the box method, the scanned rays are identical to those of a single
+/// process scan, so the results are identical as well.
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Scanning the geometry using " << fNWorkers << " worker processes";
+
+  // shared results: for each worker, the max path lengths followed by the
+  // voxel map validation sums
+  int    ntgt  = fCurrMaxPathLengthList->size();
+  int    nslot = ntgt + 4;
+  size_t size  = fNWorkers * nslot * sizeof(double);
+  void * shared = mmap(0, size, 
+                   PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if ( shared == MAP_FAILED ) {
+    LOG("GROOTGeom", pERROR) 
+      << "Couldn't allocate shared memory - Scanning in a single process";
+    int nworkers = fNWorkers;
+    fNWorkers = 1;
+    if ( fFlux ) this->MaxPathLengthsFluxMethod();
+    else         this->MaxPathLengthsBoxMethod();
+    fNWorkers = nworkers;
+    return;
+  }
+  double * result = (double *) shared;
+  for (int i = 0; i < fNWorkers*nslot; i++) result[i] = 0;
+
+  // flush all output before forking so that it is not duplicated
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(0);
+
+  vector<pid_t> pids;
+  for (int iw = 0; iw < fNWorkers; iw++) {
+    pid_t pid = fork();
+    if ( pid < 0 ) {
+      LOG("GROOTGeom", pFATAL) << "Failed to fork scanner worker: " << iw;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if ( pid == 0 ) {
+      fWorker = iw;
+      if ( fFlux ) this->MaxPathLengthsFluxMethod();
+      else         this->MaxPathLengthsBoxMethod();
+
+      double * wresult = result + iw*nslot;
+      int itgt = 0;
+      PathLengthList::const_iterator pliter;
+      for (pliter = fCurrMaxPathLengthList->begin(); 
+           pliter != fCurrMaxPathLengthList->end(); ++pliter) {
+        wresult[itgt++] = pliter->second;
+      }
+      wresult[ntgt  ] = fVoxelNRays;
+      wresult[ntgt+1] = fVoxelSumDiff;
+      wresult[ntgt+2] = fVoxelSumPl;
+      wresult[ntgt+3] = fVoxelMaxRelDiff;
+
+      std::cout.flush();
+      std::cerr.flush();
+      fflush(0);
+      // skip static destructors: singletons are owned by the parent
+      _exit(0);
+    }
+    LOG("GROOTGeom", pINFO)
+      << "Started scanner worker " << iw << " (pid: " << pid << ")";
+    pids.push_back(pid);
+  }
+
+  bool ok = true;
+  for (int nrunning = fNWorkers; nrunning > 0; nrunning--) {
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    if ( pid < 0 ) { ok = false; break; }
+    ok = ok && WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+  }
+  if ( !ok ) {
+    LOG("GROOTGeom", pFATAL) << "A max path length scanner worker failed!";
+    for (int iw = 0; iw < fNWorkers; iw++) kill(pids[iw], SIGKILL);
+    munmap(shared, size);
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // merge
+  for (int iw = 0; iw < fNWorkers; iw++) {
+    const double * wresult = result + iw*nslot;
+    int itgt = 0;
+    PathLengthList::iterator pliter;
+    for (pliter = fCurrMaxPathLengthList->begin(); 
+         pliter != fCurrMaxPathLengthList->end(); ++pliter) {
+      pliter->second = TMath::Max(pliter->second, wresult[itgt++]);
+    }
+    fVoxelNRays     += (long int) wresult[ntgt];
+    fVoxelSumDiff   += wresult[ntgt+1];
+    fVoxelSumPl     += wresult[ntgt+2];
+    fVoxelMaxRelDiff = TMath::Max(fVoxelMaxRelDiff, wresult[ntgt+3]);
+  }
+  munmap(shared, size);
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Merged the max path lengths from " << fNWorkers << " workers";
+}
+
 //___________________________________________________________________________
 bool ROOTGeomAnalyzer::GenBoxRay(int indx, TLorentzVector& x4, TLorentzVector& p4)
 {
@@ -1688,3 +2046,152 @@ bool ROOTGeomAnalyzer::WillNeverEnter(double step)
 }
 
 //___________________________________________________________________________
+void ROOTGeomAnalyzer::ComputeVoxelWeights(void)
+{
+/// Compute the weight of each voxel map material for each target nucleus.
+/// Weights are in the curr geom density units.
+
+  int ntgt = fCurrPathLengthList->size();
+  int nmat = fVoxelMap->NMaterials();
+
+  fVoxelWeights.assign(nmat*ntgt, 0.);
+
+  for (int imat = 1; imat < nmat; imat++) {
+    const TGeoMaterial * mat = 
+       fGeometry->GetMaterial(fVoxelMap->MaterialName(imat).c_str());
+    if (!mat) {
+      LOG("GROOTGeom", pWARN)
+        << "No material " << fVoxelMap->MaterialName(imat) << " in geometry";
+      continue;
+    }
+    int itgt = 0;
+    PathLengthList::const_iterator pliter;
+    for (pliter = fCurrPathLengthList->begin(); 
+         pliter != fCurrPathLengthList->end(); ++pliter, ++itgt) {
+      fVoxelWeights[imat*ntgt + itgt] = this->GetWeight(mat,pliter->first);
+    }
+  }
+
+  fVoxelWeightsDensWeight  = fDensWeight;
+  fVoxelWeightsMixtWghtSum = fMixtWghtSum;
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::VoxelPathLengths(
+                                  const TVector3 & r0, const TVector3 & udir)
+{
+/// Compute the path-lengths (in curr geom units) for all target nuclei by
+/// following the ray through the voxel map, starting from the input 
+/// position r0 (top vol coord & units) and moving along the direction of
+/// the unit vector udir (top vol coord).
+
+  if ( fVoxelWeights.size() == 0                 || 
+       fVoxelWeightsDensWeight  != fDensWeight   ||
+       fVoxelWeightsMixtWghtSum != fMixtWghtSum  ) this->ComputeVoxelWeights();
+
+  fVoxelMap->Traverse(r0,udir,fVoxelSteps);
+
+  int ntgt = fCurrPathLengthList->size();
+
+  vector<GeomVoxelStep>::const_iterator siter;
+  for (siter = fVoxelSteps.begin(); siter != fVoxelSteps.end(); ++siter) {
+    double step = siter->fTMax - siter->fTMin;
+    const double * weight = &fVoxelWeights[siter->fMaterial * ntgt];
+    int itgt = 0;
+    PathLengthList::iterator pliter;
+    for (pliter = fCurrPathLengthList->begin(); 
+         pliter != fCurrPathLengthList->end(); ++pliter, ++itgt) {
+      pliter->second += step * weight[itgt];
+    }
+  }
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("GROOTGeom", pDEBUG)
+    << "Voxel map path-lengths (" << fVoxelSteps.size() << " steps): "
+    << *fCurrPathLengthList;
+#endif
+}
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::CompareVoxelPathLengths(
+                                  const TVector3 & r0, const TVector3 & udir)
+{
+/// Validation mode: Compare the path-lengths computed using the voxel map
+/// with the ones obtained by swimming through the geometry. The latter
+/// replace the former in the current list of path-lengths.
+
+  double sumdiff = 0;
+  double sumpl   = 0;
+
+  PathLengthList::iterator pliter;
+  for (pliter = fCurrPathLengthList->begin(); 
+       pliter != fCurrPathLengthList->end(); ++pliter) {
+    int    pdgc = pliter->first;
+    double vpl  = pliter->second;
+    double pl   = this->ComputePathLengthPDG(r0,udir,pdgc);
+    sumdiff += TMath::Abs(vpl-pl);
+    sumpl   += pl;
+    pliter->second = pl;
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("GROOTGeom", pDEBUG)
+      << "Path-length for material: " << pdgc 
+      << " = " << pl << " (voxel map: " << vpl << ")";
+#endif
+  }
+
+  double reldiff = (sumpl > 0) ? sumdiff/sumpl : ((sumdiff > 0) ? 1. : 0.);
+
+  fVoxelNRays++;
+  fVoxelSumDiff    += sumdiff;
+  fVoxelSumPl      += sumpl;
+  fVoxelMaxRelDiff  = TMath::Max(fVoxelMaxRelDiff, reldiff);
+}
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::GenerateVoxelVertex(
+   const TVector3 & r0, const TVector3 & udir, int tgtpdg, TVector3 & vtx)
+{
+/// Generate a vertex (top vol coord & units) in the material with the input
+/// PDG code by following the ray through the voxel map.
+
+  int itgt = 0;
+  int ntgt = fCurrPathLengthList->size();
+  PathLengthList::const_iterator pliter = fCurrPathLengthList->begin();
+  for ( ; pliter != fCurrPathLengthList->end(); ++pliter, ++itgt) {
+    if ( pliter->first == tgtpdg ) break;
+  }
+  if ( itgt == ntgt ) return false;
+
+  if ( fVoxelWeights.size() == 0                 || 
+       fVoxelWeightsDensWeight  != fDensWeight   ||
+       fVoxelWeightsMixtWghtSum != fMixtWghtSum  ) this->ComputeVoxelWeights();
+
+  fVoxelMap->Traverse(r0,udir,fVoxelSteps);
+
+  double maxwgt_dist = 0;
+  vector<GeomVoxelStep>::const_iterator siter;
+  for (siter = fVoxelSteps.begin(); siter != fVoxelSteps.end(); ++siter) {
+    double weight = fVoxelWeights[siter->fMaterial * ntgt + itgt];
+    maxwgt_dist += (siter->fTMax - siter->fTMin) * weight;
+  }
+  if ( maxwgt_dist <= 0 ) return false;
+
+  RandomGen * rnd = RandomGen::Instance();
+  double genwgt_dist = maxwgt_dist * rnd->RndGeom().Rndm();
+
+  double walked = 0;
+  for (siter = fVoxelSteps.begin(); siter != fVoxelSteps.end(); ++siter) {
+    double weight  = fVoxelWeights[siter->fMaterial * ntgt + itgt];
+    double step    = siter->fTMax - siter->fTMin;
+    double wgtstep = step * weight;
+    if ( wgtstep > 0 && walked + wgtstep >= genwgt_dist ) {
+      double t = siter->fTMin + step * (genwgt_dist - walked) / wgtstep;
+      TVector3 v(r0.X() + t*udir.X(), r0.Y() + t*udir.Y(), r0.Z() + t*udir.Z());
+      vtx = v;
+      LOG("GROOTGeom", pINFO)
+        << "Voxel map vertex position: " << utils::print::Vec3AsString(&vtx);
+      return true;
+    }
+    walked += wgtstep;
+  }
+  return false;
+}
+//___________________________________________________________________________
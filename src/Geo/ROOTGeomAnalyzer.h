@@ -21,12 +21,14 @@
 #define _ROOT_GEOMETRY_ANALYZER_H_
 
 #include <string>
+#include <vector>
 #include <algorithm>
 
 #include <TGeoManager.h>
 #include <TVector3.h>
 
 #include "EVGDrivers/GeomAnalyzerI.h"
+#include "Geo/GeomVoxelMap.h"
 #include "PDG/PDGUtils.h"
 
 class TGeoVolume;
@@ -36,6 +38,7 @@ class TGeoElement;
 class TGeoHMatrix;
 
 using std::string;
+using std::vector;
 
 namespace genie    {
 
@@ -70,6 +73,7 @@ public :
   virtual void SetScannerNRays      (int    nr) { fNRays      = nr; } /* box  scanner */
   virtual void SetScannerNParticles (int    np) { fNParticles = np; } /* flux scanner */
   virtual void SetScannerFlux       (GFluxI* f) { fFlux       = f;  } /* flux scanner */
+  virtual void SetScannerNWorkers   (int    nw);                        /* box & flux scanners */
   virtual void SetWeightWithDensity (bool   wt) { fDensWeight = wt; }
   virtual void SetMixtureWeightsSum (double sum);
   virtual void SetLengthUnits       (double lu);
@@ -84,6 +88,7 @@ public :
   virtual int           ScannerNPoints    (void) const { return fNPoints;           }
   virtual int           ScannerNRays      (void) const { return fNRays;             }
   virtual int           ScannerNParticles (void) const { return fNParticles;        }
+  virtual int           ScannerNWorkers   (void) const { return fNWorkers;          }
   virtual bool          WeightWithDensity (void) const { return fDensWeight;        }
   virtual double        LengthUnits       (void) const { return fLengthScale;       }
   virtual double        DensityUnits      (void) const { return fDensityScale;      }
@@ -109,6 +114,17 @@ public :
   virtual GeomVolSelectorI* AdoptGeomVolSelector (GeomVolSelectorI* selector) /// take ownership, return old
   { std::swap(selector,fGeomVolSelector); return selector; }
 
+  /// optional voxelized material map used for computing path-lengths
+  /// (see GeomVoxelMap); not used if a GeomVolSelectorI is in place
+
+  virtual void  BuildVoxelMap       (int nx, int ny, int nz, int nsub = 1);
+  virtual bool  LoadVoxelMap        (string filename);
+  virtual bool  SaveVoxelMap        (string filename) const;
+  virtual void  AdoptVoxelMap       (GeomVoxelMap * vmap);
+  virtual void  SetValidateVoxelMap (bool val) { fValidateVoxelMap = val;  }
+  virtual bool  ValidateVoxelMap    (void) const { return fValidateVoxelMap; }
+  virtual const GeomVoxelMap * VoxelMap (void) const { return fVoxelMap;  }
+
 
 protected:
 
@@ -126,11 +142,17 @@ protected:
 
   virtual void   MaxPathLengthsFluxMethod(void);
   virtual void   MaxPathLengthsBoxMethod (void);
+  virtual void   MaxPathLengthsInParallel(void);
   virtual bool   GenBoxRay               (int indx, TLorentzVector& x4, TLorentzVector& p4);
 
   virtual double ComputePathLengthPDG    (const TVector3 & r, const TVector3 & udir, int pdgc);
   virtual void   SwimOnce                (const TVector3 & r, const TVector3 & udir);
 
+  virtual void   ComputeVoxelWeights     (void);
+  virtual void   VoxelPathLengths        (const TVector3 & r, const TVector3 & udir);
+  virtual void   CompareVoxelPathLengths (const TVector3 & r, const TVector3 & udir);
+  virtual bool   GenerateVoxelVertex     (const TVector3 & r, const TVector3 & udir, int pdgc, TVector3 & vtx);
+
   virtual bool   FindMaterialInCurrentVol(int pdgc);
   virtual bool   WillNeverEnter          (double step);
   virtual double StepToNextBoundary      (void);
@@ -145,6 +167,8 @@ protected:
   int              fNPoints;               ///< max path length scanner (box method): points/surface [def:200]
   int              fNRays;                 ///< max path length scanner (box method): rays/point [def:200]
   int              fNParticles;            ///< max path length scanner (flux method): particles in [def:10000]
+  int              fNWorkers;              ///< max path length scanner: number of worker processes [def:1]
+  int              fWorker;                ///< max path length scanner: current worker
   GFluxI *         fFlux;                  ///< a flux objects that can be used to scan the max path lengths
   bool             fDensWeight;            ///< if true pathlengths are weighted with density [def:true]
   double           fLengthScale;           ///< conversion factor: input geometry length units -> meters
@@ -163,6 +187,17 @@ protected:
   PathSegmentList* fCurrPathSegmentList;   ///< current list of path-segments
   GeomVolSelectorI* fGeomVolSelector;      ///< optional path seg trimmer (owned)
 
+  GeomVoxelMap *   fVoxelMap;                ///< optional voxelized material map (owned)
+  vector<double>   fVoxelWeights;            ///< weight of each voxel map material for each target [imat*ntgt+itgt]
+  bool             fVoxelWeightsDensWeight;  ///< fDensWeight used when computing fVoxelWeights
+  double           fVoxelWeightsMixtWghtSum; ///< fMixtWghtSum used when computing fVoxelWeights
+  vector<GeomVoxelStep> fVoxelSteps;         ///< current list of voxel map steps
+  bool             fValidateVoxelMap;        ///< compare voxel map path-lengths with the ones from swimming
+  long int         fVoxelNRays;              ///< validation: number of rays compared
+  double           fVoxelSumDiff;            ///< validation: sum of |path-length difference|
+  double           fVoxelSumPl;              ///< validation: sum of path-lengths from swimming
+  double           fVoxelMaxRelDiff;         ///< validation: max relative path-length difference
+
   // used by GenBoxRay to retain history between calls
   TVector3         fGenBoxRayPos;
   TVector3         fGenBoxRayDir;
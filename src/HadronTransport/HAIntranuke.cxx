@@ -38,6 +38,10 @@
    and Inelastic.
  @ Jan 24, 2012 - SD
    Add option of doing K+.  
+ @ Oct 17, 2026 - agent
+   Added the UseLookupTables config option (INukeHadroData lookup tables).
+ @ Oct 17, 2026 - agent
+   Added the BatchStepping config option (see Intranuke::StepToInteraction()).
 */
 //____________________________________________________________________________
 
@@ -1347,6 +1351,10 @@ void HAIntranuke::LoadConfig(void)
   fDoFermi       = fConfig->GetBoolDef   ("DoFermi",      gc->GetBool("INUKE-DoFermi"));
   fFreeStep      = fConfig->GetDoubleDef ("FreeStep",     gc->GetDouble("INUKE-FreeStep"));
   fDoCompoundNucleus = fConfig->GetBoolDef ("DoCompoundNucleus", gc->GetBool("INUKE-DoCompoundNucleus"));
+  fUseLookupTables   = fConfig->GetBoolDef ("UseLookupTables",   gc->GetBool("INUKE-UseLookupTables"));
+  fBatchStepping     = fConfig->GetBoolDef ("BatchStepping",     gc->GetBool("INUKE-BatchStepping"));
+
+  fHadroData->UseLookupTables(fUseLookupTables);
 
   // report
   LOG("HAIntranuke", pINFO) << "Settings for INTRANUKE mode: " << INukeMode::AsString(kIMdHA);
@@ -1363,5 +1371,7 @@ void HAIntranuke::LoadConfig(void)
   LOG("HAIntranuke", pINFO) << "FermiMomtm  = " << fFermiMomentum;
   LOG("HAIntranuke", pINFO) << "DoFermi?    = " << ((fDoFermi)?(true):(false));
   LOG("HAIntranuke", pINFO) << "DoCmpndNuc? = " << ((fDoCompoundNucleus)?(true):(false));
+  LOG("HAIntranuke", pINFO) << "LookupTbls? = " << ((fUseLookupTables)?(true):(false));
+  LOG("HAIntranuke", pINFO) << "BatchStep?  = " << ((fBatchStepping)?(true):(false));
 }
 //___________________________________________________________________________
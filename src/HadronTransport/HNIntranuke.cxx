@@ -33,6 +33,10 @@
    produced by reactions are stepped through the nucleus like probe particles.
    Particles react with nucleons instead of the entire nucleus, and final states
    are determined after reactions are finished, not before.
+ @ Oct 17, 2026 - agent
+   Added the UseLookupTables config option (INukeHadroData lookup tables).
+ @ Oct 17, 2026 - agent
+   Added the BatchStepping config option (see Intranuke::StepToInteraction()).
 */
 //____________________________________________________________________________
 
@@ -906,6 +910,10 @@ void HNIntranuke::LoadConfig(void)
   fDoFermi       = fConfig->GetBoolDef   ("DoFermi",      gc->GetBool("INUKE-DoFermi"));
   fFreeStep      = fConfig->GetDoubleDef ("FreeStep",     gc->GetDouble("INUKE-FreeStep"));
   fDoCompoundNucleus = fConfig->GetBoolDef ("DoCompoundNucleus", gc->GetBool("INUKE-DoCompoundNucleus"));
+  fUseLookupTables   = fConfig->GetBoolDef ("UseLookupTables",   gc->GetBool("INUKE-UseLookupTables"));
+  fBatchStepping     = fConfig->GetBoolDef ("BatchStepping",     gc->GetBool("INUKE-BatchStepping"));
+
+  fHadroData->UseLookupTables(fUseLookupTables);
   
 
   // report
@@ -924,5 +932,7 @@ void HNIntranuke::LoadConfig(void)
   LOG("HNIntranuke", pWARN) << "FermiMomtm  = " << fFermiMomentum;
   LOG("HNIntranuke", pWARN) << "DoFermi?    = " << ((fDoFermi)?(true):(false));
   LOG("HNIntranuke", pWARN) << "DoCmpndNuc? = " << ((fDoCompoundNucleus)?(true):(false));
+  LOG("HNIntranuke", pWARN) << "LookupTbls? = " << ((fUseLookupTables)?(true):(false));
+  LOG("HNIntranuke", pWARN) << "BatchStep?  = " << ((fBatchStepping)?(true):(false));
 }
 //___________________________________________________________________________
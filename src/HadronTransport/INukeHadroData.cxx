@@ -25,12 +25,29 @@
    similar to IntBounce, but also determines the target nucleon.
  @ May 01, 2012 - CA
    Pick data from $GENIE/data/evgen/intranuke/
+ @ Oct 17, 2026 - agent
+   Splines and hN grids can be loaded from (or saved in) a binary data bundle,
+   mapped in memory in one go, set via $GINUKEHADRONBUNDLE. The bundle is
+   checked against a digest of the data files it was built from. Added TotXSecs()
+   and optional lookup tables for the hA fractions and the h+p, h+n total
+   x-sections.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
 #include <string>
+#include <sstream>
+#include <fstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <TSystem.h>
 #include <TNtupleD.h>
@@ -58,9 +75,35 @@ INukeHadroData * INukeHadroData::fInstance = 0;
 double INukeHadroData::fMinKinEnergy   =    1.0; // MeV
 double INukeHadroData::fMaxKinEnergyHA =  999.0; // MeV
 double INukeHadroData::fMaxKinEnergyHN = 1799.0; // MeV
+double INukeHadroData::fTableStepKE    =    0.5; // MeV
+//____________________________________________________________________________
+// INTRANUKE data bundle layout: a header (magic string, a double set to 1 for
+// checking the byte order, the number of records and the digest of the data
+// files the bundle was built from), a table of contents and the records
+// (arrays of doubles)
+//
+static const char     kINukeBundleMagic[9]  = "GNKDATA2";
+static const unsigned kINukeBundleHdrLen    = 32;
+static const unsigned kINukeBundleNameLen   = 48;
+typedef struct {
+  char     name[kINukeBundleNameLen];
+  uint64_t offset;   // in doubles, from the start of the file
+  uint64_t size;     // in doubles
+} INukeBundleRec_t;
+
+static void INukeDataDigest(string dir, string rel, uint64_t & hash);
 //____________________________________________________________________________
 INukeHadroData::INukeHadroData()
 {
+  fBundleAddr  = 0;
+  fBundleSize  = 0;
+  fSaveBundle  = false;
+  fUseTables   = false;
+  fTablesBuilt = false;
+  for(int ih = 0; ih < 6; ih++) {
+    for(int ifate = 0; ifate < 5; ifate++) fFracInTable[ih][ifate] = false;
+  }
+
   this->LoadCrossSections();
   fInstance = 0;
 }
@@ -171,8 +214,38 @@ void INukeHadroData::LoadCrossSections(void)
              string(gSystem->Getenv("GINUKEHADRONDATA")) :
              string(gSystem->Getenv("GENIE")) + string("/data/evgen/intranuke");
 
-  LOG("INukeData", pINFO)  
+  //-- Check whether an INTRANUKE data bundle is to be used
+  //   (search for $GINUKEHADRONBUNDLE)
+  string bundle = (gSystem->Getenv("GINUKEHADRONBUNDLE")) ?
+             string(gSystem->Getenv("GINUKEHADRONBUNDLE")) : "";
+
+  bool from_bundle = false;
+  uint64_t digest = 14695981039346656037ULL;
+  if(bundle.size() > 0) {
+    INukeDataDigest(data_dir, "", digest);
+    if(gSystem->AccessPathName(bundle.c_str())) {
+      LOG("INukeData", pNOTICE)
+        << "INTRANUKE data bundle " << bundle << " doesn't exist yet. "
+        << "It will be created after loading the data files";
+      fSaveBundle = true;
+    } else {
+      from_bundle = this->LoadBundle(bundle, digest);
+      if(!from_bundle) {
+        LOG("INukeData", pWARN)
+          << "Couldn't load the INTRANUKE data bundle " << bundle
+          << " - Falling back to the data files. The bundle will be re-written";
+        fSaveBundle = true;
+      }
+    }
+  }
+
+  if(from_bundle) {
+    LOG("INukeData", pINFO)
+      << "Loading INTRANUKE hadron data from bundle: " << bundle;
+  } else {
+    LOG("INukeData", pINFO)  
       << "Loading INTRANUKE hadron data from: " << data_dir;
+  }
 
   //-- Build filenames
 
@@ -185,21 +258,6 @@ void INukeHadroData::LoadCrossSections(void)
   string datafile_gamN = data_dir + "/tot_xsec/intranuke-xsections-gamN.dat";
   string datafile_kN   = data_dir + "/tot_xsec/intranuke-xsections-kaonN.dat";
 
-  //-- Make sure that all data files are available
-
-  assert( ! gSystem->AccessPathName(datafile_NN.  c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_pipN.c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_pi0N.c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_NA.  c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_piA. c_str()) );
-  assert( ! gSystem->AccessPathName(datafile_KA. c_str())  );
-  assert( ! gSystem->AccessPathName(datafile_gamN.c_str())  );
-  assert( ! gSystem->AccessPathName(datafile_kN.  c_str())  );
-
-  LOG("INukeData", pINFO)  << "Found all necessary data files...";
-
-  //-- Load data files
-
   TTree data_NN;
   TTree data_pipN;
   TTree data_pi0N;
@@ -209,118 +267,136 @@ void INukeHadroData::LoadCrossSections(void)
   TTree data_gamN; 
   TTree data_kN;
 
-  data_NN.ReadFile(datafile_NN.c_str(),
-     "ke/D:pp_tot/D:pp_elas/D:pp_reac/D:pn_tot/D:pn_elas/D:pn_reac/D:nn_tot/D:nn_elas/D:nn_reac/D");
-  data_pipN.ReadFile(datafile_pipN.c_str(),
-     "ke/D:pipn_tot/D:pipn_cex/D:pipn_elas/D:pipn_reac/D:pipp_tot/D:pipp_cex/D:pipp_elas/D:pipp_reac/D:pipd_abs");
-  data_pi0N.ReadFile(datafile_pi0N.c_str(),
-     "ke/D:pi0n_tot/D:pi0n_cex/D:pi0n_elas/D:pi0n_reac/D:pi0p_tot/D:pi0p_cex/D:pi0p_elas/D:pi0p_reac/D:pi0d_abs");
-  data_NA.ReadFile(datafile_NA.c_str(),
-     "ke/D:pA_tot/D:pA_elas/D:pA_inel/D:pA_cex/D:pA_abs/D:pA_pipro/D");
-  data_piA.ReadFile(datafile_piA.c_str(),
-     "ke/D:piA_tot/D:piA_elas/D:piA_inel/D:piA_cex/D:piA_np/D:piA_pp/D:piA_npp/D:piA_nnp/D:piA_2n2p/D:piA_piprod/D");
-  data_gamN.ReadFile(datafile_gamN.c_str(),
-    "ke/D:pi0p_tot/D:pipn_tot/D:pimp_tot/D:pi0n_tot/D:gamp_fs/D:gamn_fs/D:gamN_tot/D");
-  data_kN.ReadFile(datafile_kN.c_str(),
-		   "ke/D:kpn_elas/D:kpp_elas/D:kp_abs/D:kpN_tot/D");  //????
-  data_KA.ReadFile(datafile_KA.c_str(),
-     "ke/D:KA_tot/D:KA_elas/D:KA_inel/D:KA_abs/D");
-
-  LOG("INukeData", pDEBUG)  << "Number of data rows in NN : "   << data_NN.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in pipN : " << data_pipN.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in pi0N : " << data_pi0N.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in NA  : "  << data_NA.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in piA : "  << data_piA.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in KA : "   << data_KA.GetEntries();
-  LOG("INukeData", pDEBUG)  << "Number of data rows in gamN : " << data_gamN.GetEntries(); 
-  LOG("INukeData", pDEBUG)  << "Number of data rows in kN  : "  << data_kN.GetEntries();
-
-  LOG("INukeData", pINFO)  << "Done loading all x-section files...";
+  if(!from_bundle) {
+
+    //-- Make sure that all data files are available
+
+    assert( ! gSystem->AccessPathName(datafile_NN.  c_str()) );
+    assert( ! gSystem->AccessPathName(datafile_pipN.c_str()) );
+    assert( ! gSystem->AccessPathName(datafile_pi0N.c_str()) );
+    assert( ! gSystem->AccessPathName(datafile_NA.  c_str()) );
+    assert( ! gSystem->AccessPathName(datafile_piA. c_str()) );
+    assert( ! gSystem->AccessPathName(datafile_KA. c_str())  );
+    assert( ! gSystem->AccessPathName(datafile_gamN.c_str())  );
+    assert( ! gSystem->AccessPathName(datafile_kN.  c_str())  );
+
+    LOG("INukeData", pINFO)  << "Found all necessary data files...";
+
+    //-- Load data files
+
+    data_NN.ReadFile(datafile_NN.c_str(),
+       "ke/D:pp_tot/D:pp_elas/D:pp_reac/D:pn_tot/D:pn_elas/D:pn_reac/D:nn_tot/D:nn_elas/D:nn_reac/D");
+    data_pipN.ReadFile(datafile_pipN.c_str(),
+       "ke/D:pipn_tot/D:pipn_cex/D:pipn_elas/D:pipn_reac/D:pipp_tot/D:pipp_cex/D:pipp_elas/D:pipp_reac/D:pipd_abs");
+    data_pi0N.ReadFile(datafile_pi0N.c_str(),
+       "ke/D:pi0n_tot/D:pi0n_cex/D:pi0n_elas/D:pi0n_reac/D:pi0p_tot/D:pi0p_cex/D:pi0p_elas/D:pi0p_reac/D:pi0d_abs");
+    data_NA.ReadFile(datafile_NA.c_str(),
+       "ke/D:pA_tot/D:pA_elas/D:pA_inel/D:pA_cex/D:pA_abs/D:pA_pipro/D");
+    data_piA.ReadFile(datafile_piA.c_str(),
+       "ke/D:piA_tot/D:piA_elas/D:piA_inel/D:piA_cex/D:piA_np/D:piA_pp/D:piA_npp/D:piA_nnp/D:piA_2n2p/D:piA_piprod/D");
+    data_gamN.ReadFile(datafile_gamN.c_str(),
+      "ke/D:pi0p_tot/D:pipn_tot/D:pimp_tot/D:pi0n_tot/D:gamp_fs/D:gamn_fs/D:gamN_tot/D");
+    data_kN.ReadFile(datafile_kN.c_str(),
+  		   "ke/D:kpn_elas/D:kpp_elas/D:kp_abs/D:kpN_tot/D");  //????
+    data_KA.ReadFile(datafile_KA.c_str(),
+       "ke/D:KA_tot/D:KA_elas/D:KA_inel/D:KA_abs/D");
+
+    LOG("INukeData", pDEBUG)  << "Number of data rows in NN : "   << data_NN.GetEntries();
+    LOG("INukeData", pDEBUG)  << "Number of data rows in pipN : " << data_pipN.GetEntries();
+    LOG("INukeData", pDEBUG)  << "Number of data rows in pi0N : " << data_pi0N.GetEntries();
+    LOG("INukeData", pDEBUG)  << "Number of data rows in NA  : "  << data_NA.GetEntries();
+    LOG("INukeData", pDEBUG)  << "Number of data rows in piA : "  << data_piA.GetEntries();
+    LOG("INukeData", pDEBUG)  << "Number of data rows in KA : "   << data_KA.GetEntries();
+    LOG("INukeData", pDEBUG)  << "Number of data rows in gamN : " << data_gamN.GetEntries(); 
+    LOG("INukeData", pDEBUG)  << "Number of data rows in kN  : "  << data_kN.GetEntries();
+
+    LOG("INukeData", pINFO)  << "Done loading all x-section files...";
+  }
 
   //-- Build x-section splines
 
   // p/n+p/n hA x-section splines
-  fXSecPp_Tot      = new Spline(&data_NN, "ke:pp_tot");     
-  fXSecPp_Elas     = new Spline(&data_NN, "ke:pp_elas");      
-  fXSecPp_Reac     = new Spline(&data_NN, "ke:pp_reac");      
-  fXSecPn_Tot      = new Spline(&data_NN, "ke:pn_tot");     
-  fXSecPn_Elas     = new Spline(&data_NN, "ke:pn_elas");      
-  fXSecPn_Reac     = new Spline(&data_NN, "ke:pn_reac");      
-  fXSecNn_Tot      = new Spline(&data_NN, "ke:nn_tot");     
-  fXSecNn_Elas     = new Spline(&data_NN, "ke:nn_elas");      
-  fXSecNn_Reac     = new Spline(&data_NN, "ke:nn_reac");      
+  fXSecPp_Tot      = this->NewSpline("XSecPp_Tot", &data_NN, "ke:pp_tot");     
+  fXSecPp_Elas     = this->NewSpline("XSecPp_Elas", &data_NN, "ke:pp_elas");      
+  fXSecPp_Reac     = this->NewSpline("XSecPp_Reac", &data_NN, "ke:pp_reac");      
+  fXSecPn_Tot      = this->NewSpline("XSecPn_Tot", &data_NN, "ke:pn_tot");     
+  fXSecPn_Elas     = this->NewSpline("XSecPn_Elas", &data_NN, "ke:pn_elas");      
+  fXSecPn_Reac     = this->NewSpline("XSecPn_Reac", &data_NN, "ke:pn_reac");      
+  fXSecNn_Tot      = this->NewSpline("XSecNn_Tot", &data_NN, "ke:nn_tot");     
+  fXSecNn_Elas     = this->NewSpline("XSecNn_Elas", &data_NN, "ke:nn_elas");      
+  fXSecNn_Reac     = this->NewSpline("XSecNn_Reac", &data_NN, "ke:nn_reac");      
 
   // pi+n/p hA x-section splines
-  fXSecPipn_Tot     = new Spline(&data_pipN, "ke:pipn_tot");    
-  fXSecPipn_CEx     = new Spline(&data_pipN, "ke:pipn_cex");    
-  fXSecPipn_Elas    = new Spline(&data_pipN, "ke:pipn_elas");    
-  fXSecPipn_Reac    = new Spline(&data_pipN, "ke:pipn_reac");    
-  fXSecPipp_Tot     = new Spline(&data_pipN, "ke:pipp_tot");    
-  fXSecPipp_CEx     = new Spline(&data_pipN, "ke:pipp_cex");    
-  fXSecPipp_Elas    = new Spline(&data_pipN, "ke:pipp_elas");    
-  fXSecPipp_Reac    = new Spline(&data_pipN, "ke:pipp_reac");    
-  fXSecPipd_Abs     = new Spline(&data_pipN, "ke:pipd_abs");    
+  fXSecPipn_Tot     = this->NewSpline("XSecPipn_Tot", &data_pipN, "ke:pipn_tot");    
+  fXSecPipn_CEx     = this->NewSpline("XSecPipn_CEx", &data_pipN, "ke:pipn_cex");    
+  fXSecPipn_Elas    = this->NewSpline("XSecPipn_Elas", &data_pipN, "ke:pipn_elas");    
+  fXSecPipn_Reac    = this->NewSpline("XSecPipn_Reac", &data_pipN, "ke:pipn_reac");    
+  fXSecPipp_Tot     = this->NewSpline("XSecPipp_Tot", &data_pipN, "ke:pipp_tot");    
+  fXSecPipp_CEx     = this->NewSpline("XSecPipp_CEx", &data_pipN, "ke:pipp_cex");    
+  fXSecPipp_Elas    = this->NewSpline("XSecPipp_Elas", &data_pipN, "ke:pipp_elas");    
+  fXSecPipp_Reac    = this->NewSpline("XSecPipp_Reac", &data_pipN, "ke:pipp_reac");    
+  fXSecPipd_Abs     = this->NewSpline("XSecPipd_Abs", &data_pipN, "ke:pipd_abs");    
 
   // pi0n/p hA x-section splines
-  fXSecPi0n_Tot     = new Spline(&data_pi0N, "ke:pi0n_tot");    
-  fXSecPi0n_CEx     = new Spline(&data_pi0N, "ke:pi0n_cex");    
-  fXSecPi0n_Elas    = new Spline(&data_pi0N, "ke:pi0n_elas");    
-  fXSecPi0n_Reac    = new Spline(&data_pi0N, "ke:pi0n_reac");    
-  fXSecPi0p_Tot     = new Spline(&data_pi0N, "ke:pi0p_tot");    
-  fXSecPi0p_CEx     = new Spline(&data_pi0N, "ke:pi0p_cex");    
-  fXSecPi0p_Elas    = new Spline(&data_pi0N, "ke:pi0p_elas");    
-  fXSecPi0p_Reac    = new Spline(&data_pi0N, "ke:pi0p_reac");    
-  fXSecPi0d_Abs     = new Spline(&data_pi0N, "ke:pi0d_abs");   
+  fXSecPi0n_Tot     = this->NewSpline("XSecPi0n_Tot", &data_pi0N, "ke:pi0n_tot");    
+  fXSecPi0n_CEx     = this->NewSpline("XSecPi0n_CEx", &data_pi0N, "ke:pi0n_cex");    
+  fXSecPi0n_Elas    = this->NewSpline("XSecPi0n_Elas", &data_pi0N, "ke:pi0n_elas");    
+  fXSecPi0n_Reac    = this->NewSpline("XSecPi0n_Reac", &data_pi0N, "ke:pi0n_reac");    
+  fXSecPi0p_Tot     = this->NewSpline("XSecPi0p_Tot", &data_pi0N, "ke:pi0p_tot");    
+  fXSecPi0p_CEx     = this->NewSpline("XSecPi0p_CEx", &data_pi0N, "ke:pi0p_cex");    
+  fXSecPi0p_Elas    = this->NewSpline("XSecPi0p_Elas", &data_pi0N, "ke:pi0p_elas");    
+  fXSecPi0p_Reac    = this->NewSpline("XSecPi0p_Reac", &data_pi0N, "ke:pi0p_reac");    
+  fXSecPi0d_Abs     = this->NewSpline("XSecPi0d_Abs", &data_pi0N, "ke:pi0d_abs");   
 
    // K+N x-section splines  
-  fXSecKpn_Elas   = new Spline(&data_kN,  "ke:kpn_elas");
-  fXSecKpp_Elas   = new Spline(&data_kN,  "ke:kpp_elas");
-  fXSecKpN_Abs    = new Spline(&data_kN,  "ke:kp_abs");
-  fXSecKpN_Tot    = new Spline(&data_kN,  "ke:kpN_tot");
+  fXSecKpn_Elas   = this->NewSpline("XSecKpn_Elas", &data_kN, "ke:kpn_elas");
+  fXSecKpp_Elas   = this->NewSpline("XSecKpp_Elas", &data_kN, "ke:kpp_elas");
+  fXSecKpN_Abs    = this->NewSpline("XSecKpN_Abs", &data_kN, "ke:kp_abs");
+  fXSecKpN_Tot    = this->NewSpline("XSecKpN_Tot", &data_kN, "ke:kpN_tot");
 
   // gamma x-section splines  
-  fXSecGamp_fs     = new Spline(&data_gamN, "ke:gamp_fs");
-  fXSecGamn_fs     = new Spline(&data_gamN, "ke:gamn_fs");
-  fXSecGamN_Tot    = new Spline(&data_gamN, "ke:gamN_tot");
+  fXSecGamp_fs     = this->NewSpline("XSecGamp_fs", &data_gamN, "ke:gamp_fs");
+  fXSecGamn_fs     = this->NewSpline("XSecGamn_fs", &data_gamN, "ke:gamn_fs");
+  fXSecGamN_Tot    = this->NewSpline("XSecGamN_Tot", &data_gamN, "ke:gamN_tot");
 
   // N+A x-section fraction splines
-  fFracPA_Tot      = new Spline(&data_NA, "ke:pA_tot");
-  fFracPA_Elas     = new Spline(&data_NA, "ke:pA_elas");
-  fFracPA_Inel     = new Spline(&data_NA, "ke:pA_inel");   
-  fFracPA_CEx      = new Spline(&data_NA, "ke:pA_cex");   
-  fFracPA_Abs      = new Spline(&data_NA, "ke:pA_abs");
-  fFracPA_Pipro    = new Spline(&data_NA, "ke:pA_pipro");  
-  fFracNA_Tot      = new Spline(&data_NA, "ke:pA_tot");  // assuming nA same as pA
-  fFracNA_Elas     = new Spline(&data_NA, "ke:pA_elas"); 
-  fFracNA_Inel     = new Spline(&data_NA, "ke:pA_inel");   
-  fFracNA_CEx      = new Spline(&data_NA, "ke:pA_cex");   
-  fFracNA_Abs      = new Spline(&data_NA, "ke:pA_abs");
-  fFracNA_Pipro    = new Spline(&data_NA, "ke:pA_pipro");  
+  fFracPA_Tot      = this->NewSpline("FracPA_Tot", &data_NA, "ke:pA_tot");
+  fFracPA_Elas     = this->NewSpline("FracPA_Elas", &data_NA, "ke:pA_elas");
+  fFracPA_Inel     = this->NewSpline("FracPA_Inel", &data_NA, "ke:pA_inel");   
+  fFracPA_CEx      = this->NewSpline("FracPA_CEx", &data_NA, "ke:pA_cex");   
+  fFracPA_Abs      = this->NewSpline("FracPA_Abs", &data_NA, "ke:pA_abs");
+  fFracPA_Pipro    = this->NewSpline("FracPA_Pipro", &data_NA, "ke:pA_pipro");  
+  fFracNA_Tot      = this->NewSpline("FracNA_Tot", &data_NA, "ke:pA_tot");  // assuming nA same as pA
+  fFracNA_Elas     = this->NewSpline("FracNA_Elas", &data_NA, "ke:pA_elas"); 
+  fFracNA_Inel     = this->NewSpline("FracNA_Inel", &data_NA, "ke:pA_inel");   
+  fFracNA_CEx      = this->NewSpline("FracNA_CEx", &data_NA, "ke:pA_cex");   
+  fFracNA_Abs      = this->NewSpline("FracNA_Abs", &data_NA, "ke:pA_abs");
+  fFracNA_Pipro    = this->NewSpline("FracNA_Pipro", &data_NA, "ke:pA_pipro");  
 
   // pi+A x-section splines
-  fFracPipA_Tot     = new Spline(&data_piA, "ke:piA_tot");    
-  fFracPipA_Elas    = new Spline(&data_piA, "ke:piA_elas");    
-  fFracPipA_Inel    = new Spline(&data_piA, "ke:piA_inel");    
-  fFracPipA_CEx     = new Spline(&data_piA, "ke:piA_cex");    
-  fFracPipA_Abs     = new Spline(&data_piA, "ke:piA_np+piA_pp+piA_npp+piA_nnp+piA_2n2p");
-  fFracPipA_PiProd  = new Spline(&data_piA, "ke:piA_piprod");    
-  fFracPimA_Tot     = new Spline(&data_piA, "ke:piA_tot");    
-  fFracPimA_Elas    = new Spline(&data_piA, "ke:piA_elas");    
-  fFracPimA_Inel    = new Spline(&data_piA, "ke:piA_inel");    
-  fFracPimA_CEx     = new Spline(&data_piA, "ke:piA_cex");    
-  fFracPimA_Abs     = new Spline(&data_piA, "ke:piA_np+piA_pp+piA_npp+piA_nnp+piA_2n2p");
-  fFracPimA_PiProd  = new Spline(&data_piA, "ke:piA_piprod");    
-  fFracPi0A_Tot     = new Spline(&data_piA, "ke:piA_tot");    
-  fFracPi0A_Elas    = new Spline(&data_piA, "ke:piA_elas");    
-  fFracPi0A_Inel    = new Spline(&data_piA, "ke:piA_inel");    
-  fFracPi0A_CEx     = new Spline(&data_piA, "ke:piA_cex");    
-  fFracPi0A_Abs     = new Spline(&data_piA, "ke:piA_np+piA_pp+piA_npp+piA_nnp+piA_2n2p");
-  fFracPi0A_PiProd  = new Spline(&data_piA, "ke:piA_piprod");
+  fFracPipA_Tot     = this->NewSpline("FracPipA_Tot", &data_piA, "ke:piA_tot");    
+  fFracPipA_Elas    = this->NewSpline("FracPipA_Elas", &data_piA, "ke:piA_elas");    
+  fFracPipA_Inel    = this->NewSpline("FracPipA_Inel", &data_piA, "ke:piA_inel");    
+  fFracPipA_CEx     = this->NewSpline("FracPipA_CEx", &data_piA, "ke:piA_cex");    
+  fFracPipA_Abs     = this->NewSpline("FracPipA_Abs", &data_piA, "ke:piA_np+piA_pp+piA_npp+piA_nnp+piA_2n2p");
+  fFracPipA_PiProd  = this->NewSpline("FracPipA_PiProd", &data_piA, "ke:piA_piprod");    
+  fFracPimA_Tot     = this->NewSpline("FracPimA_Tot", &data_piA, "ke:piA_tot");    
+  fFracPimA_Elas    = this->NewSpline("FracPimA_Elas", &data_piA, "ke:piA_elas");    
+  fFracPimA_Inel    = this->NewSpline("FracPimA_Inel", &data_piA, "ke:piA_inel");    
+  fFracPimA_CEx     = this->NewSpline("FracPimA_CEx", &data_piA, "ke:piA_cex");    
+  fFracPimA_Abs     = this->NewSpline("FracPimA_Abs", &data_piA, "ke:piA_np+piA_pp+piA_npp+piA_nnp+piA_2n2p");
+  fFracPimA_PiProd  = this->NewSpline("FracPimA_PiProd", &data_piA, "ke:piA_piprod");    
+  fFracPi0A_Tot     = this->NewSpline("FracPi0A_Tot", &data_piA, "ke:piA_tot");    
+  fFracPi0A_Elas    = this->NewSpline("FracPi0A_Elas", &data_piA, "ke:piA_elas");    
+  fFracPi0A_Inel    = this->NewSpline("FracPi0A_Inel", &data_piA, "ke:piA_inel");    
+  fFracPi0A_CEx     = this->NewSpline("FracPi0A_CEx", &data_piA, "ke:piA_cex");    
+  fFracPi0A_Abs     = this->NewSpline("FracPi0A_Abs", &data_piA, "ke:piA_np+piA_pp+piA_npp+piA_nnp+piA_2n2p");
+  fFracPi0A_PiProd  = this->NewSpline("FracPi0A_PiProd", &data_piA, "ke:piA_piprod");
   // K+A x-section fraction splines
-  fFracKA_Tot      = new Spline(&data_KA, "ke:KA_tot");
-  fFracKA_Elas     = new Spline(&data_KA, "ke:KA_elas");
-  fFracKA_Inel     = new Spline(&data_KA, "ke:KA_inel");   
-  fFracKA_Abs      = new Spline(&data_KA, "ke:KA_abs");
+  fFracKA_Tot      = this->NewSpline("FracKA_Tot", &data_KA, "ke:KA_tot");
+  fFracKA_Elas     = this->NewSpline("FracKA_Elas", &data_KA, "ke:KA_elas");
+  fFracKA_Inel     = this->NewSpline("FracKA_Inel", &data_KA, "ke:KA_inel");   
+  fFracKA_Abs      = this->NewSpline("FracKA_Abs", &data_KA, "ke:KA_abs");
   //
   // hN stuff
   //
@@ -377,7 +453,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_ppelas_costh_cond[ient] = hN_ppelas_costh[ient];
       }*/
 
-    fhN2dXSecPP_Elas = new BLI2DNonUnifGrid(hN_ppelas_nfiles,hN_ppelas_points_per_file,
+    fhN2dXSecPP_Elas = this->NewGrid2D("hN2dXSecPP_Elas", hN_ppelas_nfiles,hN_ppelas_points_per_file,
 			   hN_ppelas_energies,hN_ppelas_costh,hN_ppelas_xsec); 
   }
 
@@ -413,7 +489,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_npelas_costh_cond[ient] = hN_npelas_costh[ient];
       }*/
 
-    fhN2dXSecNP_Elas = new BLI2DNonUnifGrid(hN_npelas_nfiles,hN_npelas_points_per_file,
+    fhN2dXSecNP_Elas = this->NewGrid2D("hN2dXSecNP_Elas", hN_npelas_nfiles,hN_npelas_points_per_file,
 			   hN_npelas_energies,hN_npelas_costh,hN_npelas_xsec); 
   }
 
@@ -454,7 +530,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_pipNelas_costh_cond[ient] = hN_pipNelas_costh[ient];
       }*/
 
-    fhN2dXSecPipN_Elas = new BLI2DNonUnifGrid(hN_pipNelas_nfiles,hN_pipNelas_points_per_file,
+    fhN2dXSecPipN_Elas = this->NewGrid2D("hN2dXSecPipN_Elas", hN_pipNelas_nfiles,hN_pipNelas_points_per_file,
 			   hN_pipNelas_energies,hN_pipNelas_costh,hN_pipNelas_xsec); 
   }
 
@@ -495,7 +571,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_pi0Nelas_costh_cond[ient] = hN_pi0Nelas_costh[ient];
       }*/
 
-    fhN2dXSecPi0N_Elas = new BLI2DNonUnifGrid(hN_pi0Nelas_nfiles,hN_pi0Nelas_points_per_file,
+    fhN2dXSecPi0N_Elas = this->NewGrid2D("hN2dXSecPi0N_Elas", hN_pi0Nelas_nfiles,hN_pi0Nelas_points_per_file,
 			   hN_pi0Nelas_energies,hN_pi0Nelas_costh,hN_pi0Nelas_xsec); 
   }
 
@@ -536,7 +612,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_pimNelas_costh_cond[ient] = hN_pimNelas_costh[ient];
       }*/
 
-    fhN2dXSecPimN_Elas = new BLI2DNonUnifGrid(hN_pimNelas_nfiles,hN_pimNelas_points_per_file,
+    fhN2dXSecPimN_Elas = this->NewGrid2D("hN2dXSecPimN_Elas", hN_pimNelas_nfiles,hN_pimNelas_points_per_file,
 			   hN_pimNelas_energies,hN_pimNelas_costh,hN_pimNelas_xsec); 
   }
  
@@ -572,7 +648,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_kpNelas_costh_cond[ient] = hN_kpNelas_costh[ient];
       }*/
 
-    fhN2dXSecKpN_Elas = new BLI2DNonUnifGrid(hN_kpNelas_nfiles,hN_kpNelas_points_per_file,
+    fhN2dXSecKpN_Elas = this->NewGrid2D("hN2dXSecKpN_Elas", hN_kpNelas_nfiles,hN_kpNelas_points_per_file,
 			   hN_kpNelas_energies,hN_kpNelas_costh,hN_kpNelas_xsec); 
   }
   
@@ -608,7 +684,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_kpPelas_costh_cond[ient] = hN_kpPelas_costh[ient];
       }*/
 
-    fhN2dXSecKpP_Elas = new BLI2DNonUnifGrid(hN_kpPelas_nfiles,hN_kpPelas_points_per_file,
+    fhN2dXSecKpP_Elas = this->NewGrid2D("hN2dXSecKpP_Elas", hN_kpPelas_nfiles,hN_kpPelas_points_per_file,
 			   hN_kpPelas_energies,hN_kpPelas_costh,hN_kpPelas_xsec); 
 	}
 
@@ -649,7 +725,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_piNcex_costh_cond[ient] = hN_piNcex_costh[ient];
       }*/
 
-    fhN2dXSecPiN_CEx = new BLI2DNonUnifGrid(hN_piNcex_nfiles,hN_piNcex_points_per_file,
+    fhN2dXSecPiN_CEx = this->NewGrid2D("hN2dXSecPiN_CEx", hN_piNcex_nfiles,hN_piNcex_points_per_file,
 			   hN_piNcex_energies,hN_piNcex_costh,hN_piNcex_xsec); 
   }
 
@@ -685,7 +761,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_piNabs_costh_cond[ient] = hN_piNabs_costh[ient];
       }*/
 
-    fhN2dXSecPiN_Abs = new BLI2DNonUnifGrid(hN_piNabs_nfiles,hN_piNabs_points_per_file,
+    fhN2dXSecPiN_Abs = this->NewGrid2D("hN2dXSecPiN_Abs", hN_piNabs_nfiles,hN_piNabs_points_per_file,
 			   hN_piNabs_energies,hN_piNabs_costh,hN_piNabs_xsec);
   }
 
@@ -722,7 +798,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_gampi0pInelas_costh_cond[ient] = hN_gampi0pInelas_costh[ient];
       }*/
 
-    fhN2dXSecGamPi0P_Inelas = new BLI2DNonUnifGrid(hN_gampi0pInelas_nfiles,hN_gampi0pInelas_points_per_file,
+    fhN2dXSecGamPi0P_Inelas = this->NewGrid2D("hN2dXSecGamPi0P_Inelas", hN_gampi0pInelas_nfiles,hN_gampi0pInelas_points_per_file,
 			   hN_gampi0pInelas_energies,hN_gampi0pInelas_costh,hN_gampi0pInelas_xsec);
   }
 
@@ -758,7 +834,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_gampi0nInelas_costh_cond[ient] = hN_gampi0nInelas_costh[ient];
       }*/
 
-    fhN2dXSecGamPi0N_Inelas = new BLI2DNonUnifGrid(hN_gampi0nInelas_nfiles,hN_gampi0nInelas_points_per_file,
+    fhN2dXSecGamPi0N_Inelas = this->NewGrid2D("hN2dXSecGamPi0N_Inelas", hN_gampi0nInelas_nfiles,hN_gampi0nInelas_points_per_file,
 			   hN_gampi0nInelas_energies,hN_gampi0nInelas_costh,hN_gampi0nInelas_xsec);
   }
 
@@ -795,7 +871,7 @@ void INukeHadroData::LoadCrossSections(void)
       hN_gampipnInelas_costh_cond[ient] = hN_gampipnInelas_costh[ient];
       }*/
 
-    fhN2dXSecGamPipN_Inelas = new BLI2DNonUnifGrid(hN_gampipnInelas_nfiles,hN_gampipnInelas_points_per_file,
+    fhN2dXSecGamPipN_Inelas = this->NewGrid2D("hN2dXSecGamPipN_Inelas", hN_gampipnInelas_nfiles,hN_gampipnInelas_points_per_file,
 			   hN_gampipnInelas_energies,hN_gampipnInelas_costh,hN_gampipnInelas_xsec);
   }
 
@@ -832,17 +908,34 @@ void INukeHadroData::LoadCrossSections(void)
       hN_gampimpInelas_costh_cond[ient] = hN_gampimpInelas_costh[ient];
       }*/
 
-    fhN2dXSecGamPimP_Inelas = new BLI2DNonUnifGrid(hN_gampimpInelas_nfiles,hN_gampimpInelas_points_per_file,
+    fhN2dXSecGamPimP_Inelas = this->NewGrid2D("hN2dXSecGamPimP_Inelas", hN_gampimpInelas_nfiles,hN_gampimpInelas_points_per_file,
 			   hN_gampimpInelas_energies,hN_gampimpInelas_costh,hN_gampimpInelas_xsec);
   }
 
   LOG("INukeData", pINFO)  << "Done building x-section splines...";
+
+  //-- Release the loaded bundle / save the data in a new bundle
+
+  if(from_bundle) {
+    munmap(fBundleAddr, fBundleSize);
+    fBundleAddr = 0;
+    fBundleSize = 0;
+    fBundleData.clear();
+  }
+  if(fSaveBundle) {
+    this->SaveBundle(bundle, digest);
+    fBundleSave.clear();
+    fSaveBundle = false;
+  }
 }
 //____________________________________________________________________________
 void INukeHadroData::ReadhNFile(
   string filename, double ke, int npoints, int & curr_point,
   double * costh_array, double * xsec_array, int cols)
 {
+  // nothing to read if the hN data come from a data bundle
+  if(fBundleData.size() > 0) return;
+
   // open 
   std::ifstream hN_stream(filename.c_str(), ios::in);
   if(!hN_stream.good()) {
@@ -1041,6 +1134,22 @@ double INukeHadroData::Frac(int hpdgc, INukeFateHA_t fate, double ke) const
 
   LOG("INukeData", pDEBUG)  << "Querying hA cross section at ke = " << ke;
 
+  if(fUseTables) {
+    int ih    = this->TableIdx(hpdgc);
+    int ifate = -1;
+    switch(fate) {
+      case kIHAFtCEx    : ifate = 0; break;
+      case kIHAFtElas   : ifate = 1; break;
+      case kIHAFtInelas : ifate = 2; break;
+      case kIHAFtAbs    : ifate = 3; break;
+      case kIHAFtPiProd : ifate = 4; break;
+      default           : break;
+    }
+    if(ih >= 0 && ih < 6 && ifate >= 0 && fFracInTable[ih][ifate]) {
+      return this->Lookup(fFracTableHA[ih], 5, ifate, ke);
+    }
+  }
+
   if(hpdgc == kPdgProton) {
    /* handle protons */
         if (fate == kIHAFtCEx    ) return TMath::Max(0., fFracPA_CEx     -> Evaluate (ke));
@@ -1633,3 +1742,426 @@ while(iter)
   return endPart;
 }*/
 //___________________________________________________________________________
+//____________________________________________________________________________
+bool INukeHadroData::TotXSecs(
+   int hpdgc, double ke, double & xsec_p, double & xsec_n) const
+{
+// Returns the h+p and h+n total x-sections (in mbarns) used for computing the
+// mean free path of the input hadron at the input kinetic energy (in MeV).
+// Returns false if there are no such x-sections for the input hadron.
+
+  xsec_p = 0;
+  xsec_n = 0;
+
+  if(fUseTables) {
+    int ih = this->TableIdx(hpdgc);
+    if(ih < 0) return false;
+    ke = TMath::Max(fMinKinEnergy,   ke);
+    ke = TMath::Min(fMaxKinEnergyHN, ke);
+    xsec_p = this->Lookup(fXSecTable[ih], 2, 0, ke);
+    xsec_n = this->Lookup(fXSecTable[ih], 2, 1, ke);
+    return true;
+  }
+
+  if (hpdgc == kPdgPiP) {
+    xsec_p = fXSecPipp_Tot -> Evaluate(ke);
+    xsec_n = fXSecPipn_Tot -> Evaluate(ke);
+  } else if (hpdgc == kPdgPi0) {
+    xsec_p = fXSecPi0p_Tot -> Evaluate(ke);
+    xsec_n = fXSecPi0n_Tot -> Evaluate(ke);
+  } else if (hpdgc == kPdgPiM) {
+    xsec_p = fXSecPipn_Tot -> Evaluate(ke);
+    xsec_n = fXSecPipp_Tot -> Evaluate(ke);
+  } else if (hpdgc == kPdgProton) {
+    xsec_p = fXSecPp_Tot   -> Evaluate(ke);
+    xsec_n = fXSecPn_Tot   -> Evaluate(ke);
+  } else if (hpdgc == kPdgNeutron) {
+    xsec_p = fXSecPn_Tot   -> Evaluate(ke);
+    xsec_n = fXSecNn_Tot   -> Evaluate(ke);
+  } else if (hpdgc == kPdgKP) {
+    xsec_p = fXSecKpN_Tot  -> Evaluate(ke);
+    xsec_n = xsec_p;
+  } else if (hpdgc == kPdgGamma) {
+    xsec_p = fXSecGamp_fs  -> Evaluate(ke);
+    xsec_n = fXSecGamn_fs  -> Evaluate(ke);
+  } else {
+    return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+void INukeHadroData::UseLookupTables(bool on)
+{
+  if(on && !fTablesBuilt) {
+    this->BuildLookupTables();
+  }
+  fUseTables = on;
+}
+//____________________________________________________________________________
+int INukeHadroData::TableIdx(int hpdgc) const
+{
+  switch(hpdgc) {
+    case kPdgProton  : return 0;
+    case kPdgNeutron : return 1;
+    case kPdgPiP     : return 2;
+    case kPdgPiM     : return 3;
+    case kPdgPi0     : return 4;
+    case kPdgKP      : return 5;
+    case kPdgGamma   : return 6;
+    default          : break;
+  }
+  return -1;
+}
+//____________________________________________________________________________
+double INukeHadroData::Lookup(
+   const vector<double> & table, int ncol, int icol, double ke) const
+{
+// Linear interpolation in a table of ncol columns, with rows uniformly spaced
+// in kinetic energy starting at fMinKinEnergy. The input kinetic energy must
+// be within the range of the table.
+
+  int    nrow = table.size() / ncol;
+  double u    = (ke - fMinKinEnergy) / fTableStepKE;
+  int    irow = TMath::Min((int)u, nrow-2);
+  irow = TMath::Max(irow, 0);
+  double w    = u - irow;
+
+  const double * row = &table[irow*ncol];
+  return (1.-w) * row[icol] + w * row[ncol+icol];
+}
+//____________________________________________________________________________
+void INukeHadroData::BuildLookupTables(void)
+{
+// Tabulate the hA fractions and the h+p, h+n total x-sections, evaluated from
+// the splines, on a uniform kinetic energy grid
+
+  LOG("INukeData", pNOTICE)
+    << "Building INTRANUKE lookup tables (KE step = " << fTableStepKE << " MeV)";
+
+  const int hadrons[7] = {
+    kPdgProton, kPdgNeutron, kPdgPiP, kPdgPiM, kPdgPi0, kPdgKP, kPdgGamma };
+  const INukeFateHA_t fates[5] = {
+    kIHAFtCEx, kIHAFtElas, kIHAFtInelas, kIHAFtAbs, kIHAFtPiProd };
+
+  bool use_tables = fUseTables;
+  fUseTables = false;
+
+  int nke_ha = 2 + (int) ((fMaxKinEnergyHA - fMinKinEnergy) / fTableStepKE);
+  int nke_hn = 2 + (int) ((fMaxKinEnergyHN - fMinKinEnergy) / fTableStepKE);
+
+  // hA fractions (K+ only have inelastic and absorption fates)
+  for(int ih = 0; ih < 6; ih++) {
+    for(int ifate = 0; ifate < 5; ifate++) {
+      bool kaon = (hadrons[ih] == kPdgKP);
+      fFracInTable[ih][ifate] =
+          !kaon || fates[ifate] == kIHAFtInelas || fates[ifate] == kIHAFtAbs;
+    }
+    fFracTableHA[ih].assign(5*nke_ha, 0.);
+    for(int ike = 0; ike < nke_ha; ike++) {
+      double ke = TMath::Min(fMinKinEnergy + ike*fTableStepKE, fMaxKinEnergyHA);
+      for(int ifate = 0; ifate < 5; ifate++) {
+        if(!fFracInTable[ih][ifate]) continue;
+        fFracTableHA[ih][5*ike+ifate] = this->Frac(hadrons[ih], fates[ifate], ke);
+      }
+    }
+  }
+
+  // h+p, h+n total x-sections
+  for(int ih = 0; ih < 7; ih++) {
+    fXSecTable[ih].assign(2*nke_hn, 0.);
+    for(int ike = 0; ike < nke_hn; ike++) {
+      double ke = TMath::Min(fMinKinEnergy + ike*fTableStepKE, fMaxKinEnergyHN);
+      double xsec_p = 0, xsec_n = 0;
+      this->TotXSecs(hadrons[ih], ke, xsec_p, xsec_n);
+      fXSecTable[ih][2*ike  ] = xsec_p;
+      fXSecTable[ih][2*ike+1] = xsec_n;
+    }
+  }
+
+  fUseTables   = use_tables;
+  fTablesBuilt = true;
+}
+//____________________________________________________________________________
+Spline * INukeHadroData::NewSpline(string name, TTree * data, string xy)
+{
+// Build the named spline either from the input data tree or from the data
+// bundle being loaded. Record its knots if a data bundle is to be saved.
+// Bundle record layout: [n, x[0..n-1], y[0..n-1]]
+
+  Spline * spl = 0;
+
+  if(fBundleData.size() > 0) {
+    map<string, const double *>::const_iterator rec = fBundleData.find(name);
+    if(rec == fBundleData.end()) {
+      LOG("INukeData", pFATAL)
+        << "No spline " << name << " in the INTRANUKE data bundle";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    const double * buf = rec->second;
+    int n = (int) buf[0];
+    double * x = new double[n];
+    double * y = new double[n];
+    for(int i = 0; i < n; i++) {
+      x[i] = buf[1+i];
+      y[i] = buf[1+n+i];
+    }
+    spl = new Spline(n, x, y);
+    delete [] x;
+    delete [] y;
+  } else {
+    spl = new Spline(data, xy);
+  }
+
+  if(fSaveBundle) {
+    int n = spl->NKnots();
+    vector<double> & buf = fBundleSave[name];
+    buf.assign(1+2*n, 0.);
+    buf[0] = n;
+    for(int i = 0; i < n; i++) {
+      double x = 0, y = 0;
+      spl->GetKnot(i, x, y);
+      buf[1+i]   = x;
+      buf[1+n+i] = y;
+    }
+  }
+  return spl;
+}
+//____________________________________________________________________________
+BLI2DNonUnifGrid * INukeHadroData::NewGrid2D(
+   string name, int nx, int ny, double * x, double * y, double * z)
+{
+// Build the named hN grid either from the input arrays or from the data
+// bundle being loaded. Record its data if a data bundle is to be saved.
+// Bundle record layout: [nx, ny, x[0..nx-1], y[0..ny-1], z[0..nx*ny-1]]
+
+  if(fBundleData.size() > 0) {
+    map<string, const double *>::const_iterator rec = fBundleData.find(name);
+    if(rec == fBundleData.end()) {
+      LOG("INukeData", pFATAL)
+        << "No hN grid " << name << " in the INTRANUKE data bundle";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    const double * buf = rec->second;
+    nx = (int) buf[0];
+    ny = (int) buf[1];
+    // the grid ctor doesn't modify its input arrays
+    x = const_cast<double *> (buf + 2);
+    y = const_cast<double *> (buf + 2 + nx);
+    z = const_cast<double *> (buf + 2 + nx + ny);
+  }
+
+  if(fSaveBundle) {
+    vector<double> & buf = fBundleSave[name];
+    buf.assign(2 + nx + ny + nx*ny, 0.);
+    buf[0] = nx;
+    buf[1] = ny;
+    std::copy(x, x+nx,    buf.begin() + 2);
+    std::copy(y, y+ny,    buf.begin() + 2 + nx);
+    std::copy(z, z+nx*ny, buf.begin() + 2 + nx + ny);
+  }
+
+  return new BLI2DNonUnifGrid(nx, ny, x, y, z);
+}
+//____________________________________________________________________________
+bool INukeHadroData::LoadBundle(string filename, ULong64_t digest)
+{
+// Map the INTRANUKE data bundle in memory and index its records, checking
+// that it was built from the current data files and that each record has
+// the size implied by its contents
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) return false;
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || st.st_size < (off_t) kINukeBundleHdrLen) {
+    close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) return false;
+
+  const char *   bytes = (const char *)   addr;
+  const double * data  = (const double *) addr;
+  uint64_t ndoubles = size / sizeof(double);
+
+  bool ok = (memcmp(bytes, kINukeBundleMagic, 8) == 0) && (data[1] == 1.0);
+  uint64_t nrec = 0;
+  uint64_t bundle_digest = 0;
+  if(ok) {
+    memcpy(&nrec,          bytes + 16, sizeof(uint64_t));
+    memcpy(&bundle_digest, bytes + 24, sizeof(uint64_t));
+    ok = (kINukeBundleHdrLen + nrec * sizeof(INukeBundleRec_t) <= size);
+  }
+  if(!ok) {
+    LOG("INukeData", pERROR)
+      << filename << " is not an INTRANUKE data bundle "
+      << "(or has a different version or byte order)";
+    munmap(addr, size);
+    return false;
+  }
+  if(bundle_digest != digest) {
+    LOG("INukeData", pWARN)
+      << "The INTRANUKE data bundle " << filename 
+      << " was built from different data files";
+    munmap(addr, size);
+    return false;
+  }
+
+  const INukeBundleRec_t * toc = 
+      (const INukeBundleRec_t *) (bytes + kINukeBundleHdrLen);
+  for(uint64_t irec = 0; irec < nrec; irec++) {
+    uint64_t offset = toc[irec].offset;
+    uint64_t recsz  = toc[irec].size;
+    ok = (recsz > 0) && (offset <= ndoubles) && (recsz <= ndoubles - offset);
+    string name(toc[irec].name, strnlen(toc[irec].name, kINukeBundleNameLen));
+    if(ok) {
+      // check the record size against the number of knots / grid points
+      // it contains (see NewSpline() and NewGrid2D())
+      const double * buf = data + offset;
+      bool grid = (name.find("hN2dXSec") == 0);
+      if(grid) {
+        double nx = buf[0];
+        double ny = (recsz > 1) ? buf[1] : -1.;
+        ok = (nx >= 0 && ny >= 0 && nx <= recsz && ny <= recsz &&
+              recsz == (uint64_t) (2 + nx + ny + nx*ny));
+      } else {
+        double n = buf[0];
+        ok = (n >= 0 && n <= recsz && recsz == (uint64_t) (1 + 2*n));
+      }
+    }
+    if(!ok) {
+      LOG("INukeData", pERROR)
+        << "Corrupted INTRANUKE data bundle: " << filename 
+        << " (record " << irec << ": " << name << ")";
+      fBundleData.clear();
+      munmap(addr, size);
+      return false;
+    }
+    fBundleData[name] = data + offset;
+  }
+
+  fBundleAddr = addr;
+  fBundleSize = size;
+
+  LOG("INukeData", pINFO)
+    << "Mapped " << nrec << " records from INTRANUKE data bundle " << filename;
+  return true;
+}
+//____________________________________________________________________________
+void INukeHadroData::SaveBundle(string filename, ULong64_t digest) const
+{
+// Write out the recorded splines and hN grids as an INTRANUKE data bundle.
+// The bundle is written in a temporary file which is then renamed, so that
+// concurrent jobs never map a partially written bundle.
+
+  uint64_t nrec = fBundleSave.size();
+
+  // header + table of contents, padded to a whole number of doubles
+  uint64_t offset = 
+      (kINukeBundleHdrLen + nrec * sizeof(INukeBundleRec_t) + sizeof(double) - 1)
+      / sizeof(double);
+
+  vector<INukeBundleRec_t> toc(nrec);
+  map<string, vector<double> >::const_iterator iter = fBundleSave.begin();
+  for(uint64_t irec = 0; iter != fBundleSave.end(); ++iter, irec++) {
+    memset(toc[irec].name, 0, kINukeBundleNameLen);
+    strncpy(toc[irec].name, iter->first.c_str(), kINukeBundleNameLen-1);
+    toc[irec].offset = offset;
+    toc[irec].size   = iter->second.size();
+    offset += iter->second.size();
+  }
+
+  ostringstream tmp_file;
+  tmp_file << filename << ".tmp." << getpid();
+
+  std::ofstream out(tmp_file.str().c_str(), ios::out | ios::binary);
+  if(!out.good()) {
+    LOG("INukeData", pERROR)
+      << "Couldn't write INTRANUKE data bundle: " << tmp_file.str();
+    return;
+  }
+
+  double   one = 1.0;
+  uint64_t dig = digest;
+  out.write(kINukeBundleMagic, 8);
+  out.write((const char *) &one,  sizeof(double));
+  out.write((const char *) &nrec, sizeof(uint64_t));
+  out.write((const char *) &dig,  sizeof(uint64_t));
+  if(nrec > 0) {
+    out.write((const char *) &toc[0], nrec * sizeof(INukeBundleRec_t));
+  }
+  uint64_t npad = toc.size() > 0 ? toc[0].offset * sizeof(double) - 
+     kINukeBundleHdrLen - nrec * sizeof(INukeBundleRec_t) : 0;
+  for(uint64_t i = 0; i < npad; i++) out.put(0);
+
+  for(iter = fBundleSave.begin(); iter != fBundleSave.end(); ++iter) {
+    out.write((const char *) &(iter->second)[0],
+              iter->second.size() * sizeof(double));
+  }
+  out.close();
+
+  if(out.fail()) {
+    LOG("INukeData", pERROR)
+      << "Error writing INTRANUKE data bundle: " << tmp_file.str();
+    gSystem->Unlink(tmp_file.str().c_str());
+    return;
+  }
+  if(rename(tmp_file.str().c_str(), filename.c_str()) != 0) {
+    LOG("INukeData", pERROR)
+      << "Couldn't rename " << tmp_file.str() << " to " << filename;
+    gSystem->Unlink(tmp_file.str().c_str());
+    return;
+  }
+
+  LOG("INukeData", pNOTICE)
+    << "Saved " << nrec << " records in INTRANUKE data bundle " << filename;
+}
+//____________________________________________________________________________
+static void INukeDataDigest(string dir, string rel, uint64_t & hash)
+{
+// Update the input 64-bit FNV-1a hash with the names (relative to the
+// top-level data directory) and the contents of all files in the input
+// directory and its sub-directories, visited in alphabetical order
+
+  void * dirp = gSystem->OpenDirectory(dir.c_str());
+  if(!dirp) return;
+  vector<string> entries;
+  const char * entry = 0;
+  while( (entry = gSystem->GetDirEntry(dirp)) != 0 ) {
+    string sentry(entry);
+    if(sentry == "." || sentry == "..") continue;
+    entries.push_back(sentry);
+  }
+  gSystem->FreeDirectory(dirp);
+  std::sort(entries.begin(), entries.end());
+
+  vector<char> buf(65536);
+  for(unsigned int i = 0; i < entries.size(); i++) {
+    string path = dir + "/" + entries[i];
+    string name = rel + "/" + entries[i];
+    struct stat st;
+    if(stat(path.c_str(), &st) != 0) continue;
+    if(S_ISDIR(st.st_mode)) {
+      INukeDataDigest(path, name, hash);
+      continue;
+    }
+    for(unsigned int ic = 0; ic <= name.size(); ic++) {
+      hash ^= (unsigned char) name.c_str()[ic];
+      hash *= 1099511628211ULL;
+    }
+    std::ifstream in(path.c_str(), ios::in | ios::binary);
+    while(in.good()) {
+      in.read(&buf[0], buf.size());
+      std::streamsize nread = in.gcount();
+      for(std::streamsize ic = 0; ic < nread; ic++) {
+        hash ^= (unsigned char) buf[ic];
+        hash *= 1099511628211ULL;
+      }
+    }
+  }
+}
+//____________________________________________________________________________
@@ -21,6 +21,17 @@
           data and extrapolations, and INC model results from Mashnik et al.
           for h+Fe56.
 
+          If $GINUKEHADRONBUNDLE is set, the splines and grids are loaded in
+          one go from that (binary) INTRANUKE data bundle rather than from the
+          ASCII data files. If the bundle does not exist yet, it is written
+          after loading the ASCII data files. The bundle stores a digest of
+          the ASCII data files it was built from: A bundle built from other
+          data files (or a corrupted one) is not used, and is re-written.
+          Optionally (see UseLookupTables()), the hA-mode fate fractions and
+          the h+p, h+n total x-sections used for computing mean free paths
+          are served from lookup tables, uniform in kinetic energy, built
+          from the splines.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>, Rutherford Lab.
           Steve Dytman <dytman+@pitt.edu>, Pittsburgh Univ.
 	  Aaron Meyer <asm58@pitt.edu>, Pittsburgh Univ.
@@ -34,11 +45,22 @@
 #ifndef _INTRANUKE_HADRON_CROSS_SECTIONS_H_
 #define _INTRANUKE_HADRON_CROSS_SECTIONS_H_
 
+#include <map>
+#include <vector>
+#include <string>
+
+#include <Rtypes.h>
+
 #include "HadronTransport/INukeHadroFates.h"
 #include "GHEP/GHepParticle.h"
 #include "Numerical/BLI2D.h"
 
 class TGraph2D;
+class TTree;
+
+using std::map;
+using std::vector;
+using std::string;
 
 namespace genie {
 
@@ -60,6 +82,15 @@ public:
   //  double Frac (int hpdgc, INukeFateHA_t fate, double ke) const;
   double Frac (int hpdgc, INukeFateHN_t fate, double ke, int targA=0, int targZ=0) const;
   double IntBounce       (const GHepParticle* p, int target, int s1, INukeFateHN_t fate);
+
+  // h+p and h+n total x-sections used for computing the hadron mean free
+  // path (false if there is no such x-section for the input hadron)
+  bool   TotXSecs (int hpdgc, double ke, double & xsec_p, double & xsec_n) const;
+
+  // serve the hA-mode fractions and the mean free path x-sections from
+  // lookup tables uniform in kinetic energy (built on first use)
+  void   UseLookupTables   (bool on);
+  bool   UsingLookupTables (void) const { return fUseTables; }
   //int    AngleAndProduct (const GHepParticle* p, int target, double &angle, INukeFateHN_t fate);
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -170,6 +201,7 @@ public:
   static double fMinKinEnergy;   ///<
   static double fMaxKinEnergyHA; ///<
   static double fMaxKinEnergyHN; ///<
+  static double fTableStepKE;    ///< kinetic energy step of the lookup tables
 
 private:
   INukeHadroData();
@@ -178,6 +210,17 @@ private:
 
   void LoadCrossSections(void); 
 
+  // data bundle
+  bool               LoadBundle (string filename, ULong64_t digest);
+  void               SaveBundle (string filename, ULong64_t digest) const;
+  Spline *           NewSpline  (string name, TTree * data, string xy);
+  BLI2DNonUnifGrid * NewGrid2D  (string name, int nx, int ny, double * x, double * y, double * z);
+
+  // lookup tables
+  void   BuildLookupTables (void);
+  int    TableIdx          (int hpdgc) const;
+  double Lookup            (const vector<double> & table, int ncol, int icol, double ke) const;
+
   void ReadhNFile(
          string filename, double ke, int npoints, int & curr_point,
          /*double * ke_array,*/ double * costh_array, double * xsec_array, int cols);
@@ -280,6 +323,18 @@ private:
   BLI2DNonUnifGrid * fhN2dXSecGamPipN_Inelas;
   BLI2DNonUnifGrid * fhN2dXSecGamPimP_Inelas;
 
+  void *                        fBundleAddr;   ///< memory-mapped bundle
+  size_t                        fBundleSize;   ///< size of the memory-mapped bundle (bytes)
+  map<string, const double *>   fBundleData;   ///< records of the bundle being loaded
+  map<string, vector<double> >  fBundleSave;   ///< records of the bundle to be saved
+  bool                          fSaveBundle;   ///< save the loaded data in a bundle?
+
+  bool           fUseTables;       ///< use the lookup tables?
+  bool           fTablesBuilt;     ///< lookup tables built?
+  vector<double> fFracTableHA[6];  ///< hA fractions [ke][fate], for p, n, pi+, pi-, pi0, K+
+  bool           fFracInTable[6][5]; ///< hA fraction tabulated, per hadron and fate
+  vector<double> fXSecTable  [7];  ///< h+p, h+n total x-sections [ke][2], for p, n, pi+, pi-, pi0, K+, gamma
+
   //-- Sinleton cleaner
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
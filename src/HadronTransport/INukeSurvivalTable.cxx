@@ -0,0 +1,216 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <limits>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+
+#include "HadronTransport/INukeSurvivalTable.h"
+#include "HadronTransport/INukeUtils.h"
+#include "Messenger/Messenger.h"
+#include "Utils/NuclearUtils.h"
+
+using namespace genie;
+
+// the step size used by utils::intranuke::ProbSurvival()
+static const double kStep = 0.05; // fermi
+
+//____________________________________________________________________________
+INukeSurvivalTable * INukeSurvivalTable::fInstance = 0;
+//____________________________________________________________________________
+INukeSurvivalTable::INukeSurvivalTable()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+INukeSurvivalTable::~INukeSurvivalTable()
+{
+  map<int, Table *>::iterator it = fTables.begin();
+  for( ; it != fTables.end(); ++it) delete it->second;
+  fTables.clear();
+}
+//____________________________________________________________________________
+INukeSurvivalTable * INukeSurvivalTable::Instance()
+{
+  if(fInstance == 0) {
+    static INukeSurvivalTable::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new INukeSurvivalTable;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+double INukeSurvivalTable::OpticalDepth(
+  int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+  double Z, double nRpi, double nRnuc, double NR, double R0)
+{
+  // the stepping doesn't start if the hadron is outside the tracking volume
+  double rmax = NR * R0 * TMath::Power(A, 1./3.) + kStep;
+  double r    = x4.Vect().Mag();
+  if(r > rmax) return 0.;
+
+  // a null mean free path (no x-section for the input hadron) or an infinite
+  // one (null x-section) both result in a null survival probability
+  const double kInfDepth = std::numeric_limits<double>::infinity();
+
+  double sigtot = 0;
+  if(! utils::intranuke::TotXSec(pdgc, p4, A, Z, sigtot)) return kInfDepth;
+  if(sigtot <= 0) return kInfDepth;
+
+  double ring = utils::intranuke::RingSize(pdgc, p4, A, nRpi, nRnuc);
+
+  // hadron position along its path (t) and impact parameter (b)
+  double momentum = p4.Vect().Mag();
+  double t = (momentum>0) ? x4.Vect().Dot(p4.Vect()) / momentum : 0.;
+  double b = TMath::Sqrt(TMath::Max(0., r*r - t*t));
+
+  const Table * table = this->GetTable((int) A, rmax);
+
+  return A * sigtot * this->ColumnDensity(*table, ring, b, t);
+}
+//____________________________________________________________________________
+double INukeSurvivalTable::ProbSurvival(
+  int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+  double Z, double mfp_scale_factor,
+  double nRpi, double nRnuc, double NR, double R0)
+{
+  double depth = this->OpticalDepth(pdgc,x4,p4,A,Z,nRpi,nRnuc,NR,R0);
+  if(depth <= 0) return 1.;
+  if(mfp_scale_factor <= 0) return 0.;
+
+  return TMath::Exp(-depth/mfp_scale_factor);
+}
+//____________________________________________________________________________
+const INukeSurvivalTable::Table * INukeSurvivalTable::GetTable(
+   int A, double rmax)
+{
+  map<int, Table *>::iterator it = fTables.find(A);
+  if(it != fTables.end()) {
+    if(it->second->rmax >= rmax) return it->second;
+    // built for a smaller tracking volume
+    delete it->second;
+    fTables.erase(it);
+  }
+  Table * table = this->BuildTable(A, rmax);
+  fTables.insert(map<int, Table *>::value_type(A, table));
+  return table;
+}
+//____________________________________________________________________________
+INukeSurvivalTable::Table * INukeSurvivalTable::BuildTable(
+   int A, double rmax) const
+{
+  LOG("INukeSurv", pNOTICE)
+    << "Building survival probability table for A = " << A
+    << " (tracking up to r = " << rmax << " fm)";
+
+  // the ring size is capped in utils::nuclear::Density() -- find the cap, at
+  // the table edge where the density is most sensitive to the ring size
+  double dens_cap = utils::nuclear::Density(rmax, A, 10*rmax);
+  double ring_lo = 0., ring_hi = 10*rmax;
+  for(int i = 0; i < 50; i++) {
+    double ring = 0.5*(ring_lo + ring_hi);
+    if(utils::nuclear::Density(rmax, A, ring) == dens_cap) ring_hi = ring;
+    else ring_lo = ring;
+  }
+  double ringmax = ring_hi;
+
+  // steps along the path are stored every 0.2 fm (every 4 steps)
+  const int kNStepsPerKnot = 4;
+
+  Table * table = new Table;
+  table->rmax  = rmax;
+  table->nring = TMath::CeilNint(ringmax / TMath::Min(0.1, ringmax/20.)) + 1;
+  table->dring = ringmax / (table->nring - 1);
+  table->db    = 0.2;
+  table->nb    = TMath::CeilNint(rmax / table->db) + 1;
+  table->dt    = kNStepsPerKnot * kStep;
+  table->nt    = TMath::CeilNint(2*rmax / table->dt) + 1;
+  table->logcd.resize(table->nring * table->nb * table->nt);
+
+  int nsteps = (table->nt - 1) * kNStepsPerKnot;
+
+  // the density is evaluated on a fine radial grid and log-linearly
+  // interpolated -- it is needed at too many points along the paths
+  const double kDr = 0.01; // fm
+  int nr = TMath::CeilNint(TMath::Sqrt(2.) * (rmax + table->dt) / kDr) + 2;
+  vector<double> rgrid(nr), logdens(nr);
+  vector<double> cd(nsteps+1);
+  for(int ir = 0; ir < nr; ir++) rgrid[ir] = ir*kDr;
+
+  for(int iring = 0; iring < table->nring; iring++) {
+    double ring = iring * table->dring;
+    utils::nuclear::Density(nr, &rgrid[0], A, ring, &logdens[0]);
+    for(int ir = 0; ir < nr; ir++) {
+      logdens[ir] = TMath::Log(TMath::Max(logdens[ir], 1E-300));
+    }
+    for(int ib = 0; ib < table->nb; ib++) {
+      double b = ib * table->db;
+      // sum of step*density from the far end of the path backwards
+      cd[nsteps] = 0.;
+      for(int is = nsteps-1; is >= 0; is--) {
+        double t  = -rmax + (is+1)*kStep;
+        double x  = TMath::Sqrt(b*b + t*t) / kDr;
+        int    ir = TMath::Min((int)x, nr-2);
+        double dx = x - ir;
+        double dens = TMath::Exp(logdens[ir] + dx*(logdens[ir+1]-logdens[ir]));
+        cd[is] = cd[is+1] + kStep*dens;
+      }
+      int offset = (iring * table->nb + ib) * table->nt;
+      for(int it = 0; it < table->nt; it++) {
+        double c = cd[it*kNStepsPerKnot];
+        table->logcd[offset + it] = TMath::Log(TMath::Max(c, 1E-300));
+      }
+    }
+  }
+
+  LOG("INukeSurv", pNOTICE)
+    << "Ring size knots: " << table->nring << " (up to " << ringmax << " fm)"
+    << ", impact parameter knots: " << table->nb
+    << ", knots along path: " << table->nt;
+
+  return table;
+}
+//____________________________________________________________________________
+double INukeSurvivalTable::ColumnDensity(
+   const Table & table, double ring, double b, double t) const
+{
+  double x[3] = {
+    TMath::Min(ring, (table.nring-1)*table.dring) / table.dring,
+    TMath::Min(b,    (table.nb   -1)*table.db   ) / table.db,
+    TMath::Min(t + table.rmax, (table.nt-1)*table.dt) / table.dt
+  };
+  int n[3] = { table.nring, table.nb, table.nt };
+  int    i[3];
+  double f[3];
+  for(int k = 0; k < 3; k++) {
+    x[k] = TMath::Max(x[k], 0.);
+    i[k] = TMath::Min((int)x[k], n[k]-2);
+    f[k] = x[k] - i[k];
+  }
+
+  double logcd = 0;
+  for(int iring = 0; iring < 2; iring++) {
+   for(int ib = 0; ib < 2; ib++) {
+    for(int it = 0; it < 2; it++) {
+     double w = (iring ? f[0] : 1-f[0]) * (ib ? f[1] : 1-f[1]) * (it ? f[2] : 1-f[2]);
+     int idx = ((i[0]+iring) * table.nb + i[1]+ib) * table.nt + i[2]+it;
+     logcd += w * table.logcd[idx];
+    }
+   }
+  }
+  return TMath::Exp(logcd);
+}
+//____________________________________________________________________________
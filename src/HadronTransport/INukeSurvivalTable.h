@@ -0,0 +1,108 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::INukeSurvivalTable
+
+\brief    Singleton class serving hadron survival probabilities in a nucleus
+          from precomputed tables, as a fast replacement for the numerical
+          stepping in utils::intranuke::ProbSurvival(), mainly for the
+          INTRANUKE reweighting.
+
+          Along a straight hadron path the mean free path factorizes into the
+          nuclear density, which depends only on the radial position and on
+          the ring size, and into the total h+N x-section, which is constant.
+          The sum of step/mfp computed by the stepping (the optical depth) is
+          thus the h+N x-section times the sum of step*density (the column
+          density), which depends only on the ring size, on the impact
+          parameter of the hadron path and on the hadron position along it.
+          The column density is tabulated, once per nucleus, on a grid in
+          these three variables (with the same 0.05 fm stepping as in
+          ProbSurvival()) and its logarithm is linearly interpolated.
+          A survival probability then costs a x-section evaluation and a few
+          table lookups and the one for any mean free path scale factor
+          follows from the same optical depth, as exp(-depth/scale).
+
+          The table for a heavy nucleus (Pb208) takes ~13 MB.
+          See $GENIE/src/test/gtestINukeSurvival.cxx for a regression test
+          against the stepping.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _INTRANUKE_SURVIVAL_TABLE_H_
+#define _INTRANUKE_SURVIVAL_TABLE_H_
+
+#include <map>
+#include <vector>
+
+class TLorentzVector;
+
+using std::map;
+using std::vector;
+
+namespace genie {
+
+class INukeSurvivalTable
+{
+public:
+  static INukeSurvivalTable * Instance (void);
+
+  // optical depth (sum of step/mfp) from the input position to the edge of
+  // the tracking volume, as in utils::intranuke::ProbSurvival()
+  double OpticalDepth (
+    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+    double Z, double nRpi=0.5, double nRnuc=1.0, double NR=3, double R0=1.4);
+
+  // hadron survival probability, as in utils::intranuke::ProbSurvival()
+  double ProbSurvival (
+    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+    double Z, double mfp_scale_factor=1.0,
+    double nRpi=0.5, double nRnuc=1.0, double NR=3, double R0=1.4);
+
+private:
+  INukeSurvivalTable();
+  INukeSurvivalTable(const INukeSurvivalTable & table);
+ ~INukeSurvivalTable();
+
+  // column density table for a given nucleus
+  struct Table {
+    double         rmax;    ///< max radius covered (fm)
+    double         dring;   ///< ring size knot spacing (fm)
+    double         db;      ///< impact parameter knot spacing (fm)
+    double         dt;      ///< position along the path knot spacing (fm)
+    int            nring;   ///< number of ring size knots
+    int            nb;      ///< number of impact parameter knots
+    int            nt;      ///< number of knots along the path
+    vector<double> logcd;   ///< log(column density) [ring][b][t]
+  };
+
+  const Table * GetTable      (int A, double rmax);
+  Table *       BuildTable    (int A, double rmax) const;
+  double        ColumnDensity (const Table & table, double ring, double b, double t) const;
+
+  static INukeSurvivalTable * fInstance;
+
+  map<int, Table *> fTables;  ///< column density tables, per nucleus mass number
+
+  //-- Singleton cleaner
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (INukeSurvivalTable::fInstance !=0) {
+            delete INukeSurvivalTable::fInstance;
+            INukeSurvivalTable::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+#endif //_INTRANUKE_SURVIVAL_TABLE_H_
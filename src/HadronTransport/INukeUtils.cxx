@@ -31,6 +31,12 @@
    Added common utility functions used by both hA and hN mode. Updated
    MeanFreePath to separate proton and neutron cross sections. Added general
    utility functions.
+ @ Oct 17, 2026 - agent
+   MeanFreePath() gets the h+p, h+n total x-sections from INukeHadroData::
+   TotXSecs(), which can serve them from lookup tables.
+ @ Oct 17, 2026 - agent
+   Factored out RingSize() and TotXSec() from MeanFreePath(), for computing
+   the quantities which are constant along a hadron path only once.
 */
 //____________________________________________________________________________
 
@@ -80,14 +86,46 @@ double genie::utils::intranuke::MeanFreePath(
 //  A    : Nucleus atomic mass number
 //  nRpi : Controls the pion ring size in terms of de-Broglie wavelengths
 //  nRnuc: Controls the nuclepn ring size in terms of de-Broglie wavelengths
+//
+  // get total xsection for the incident hadron at its current
+  // kinetic energy
+  double sigtot = 0;
+  if(! utils::intranuke::TotXSec(pdgc, p4, A, Z, sigtot)) {
+     return 0;
+  }
+
+  // get the nuclear density at the current position
+  double ring = utils::intranuke::RingSize(pdgc, p4, A, nRpi, nRnuc);
+  double rnow = x4.Vect().Mag(); 
+  double rho  = A * utils::nuclear::Density(rnow,(int) A,ring);
+
+  // compute the mean free path
+  double lamda = 1. / (rho * sigtot);
+
+  // exits if lamda is InF (if cross section is 0)
+  if( ! TMath::Finite(lamda) ) {
+     return -1;
+  }
+
+/*
+  LOG("INukeUtils", pDEBUG) 
+     << "sig_total = " << sigtot << " fm^2, rho = " << rho 
+     << " fm^-3  => mfp = " << lamda << " fm.";
+*/
+  return lamda;
+}
+//____________________________________________________________________________
+double genie::utils::intranuke::RingSize(
+   int pdgc, const TLorentzVector & p4, double A, double nRpi, double nRnuc)
+{
+// Size (in fm) of the 'ring' by which the nucleus becomes larger for the input
+// hadron when computing its mean free path. See MeanFreePath() for the inputs.
 //
   bool is_pion    = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM;
   bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
   bool is_kaon    = pdgc == kPdgKP;
   bool is_gamma   = pdgc == kPdgGamma;
 
-  if(!is_pion && !is_nucleon && !is_kaon && !is_gamma) return 0.;
-        
   // before getting the nuclear density at the current position
   // check whether the nucleus has to become larger by const times the
   // de Broglie wavelength -- that is somewhat empirical, but this
@@ -105,9 +143,25 @@ double genie::utils::intranuke::MeanFreePath(
   else if (is_nucleon            ) { ring *= nRnuc; }
   else if (is_gamma              ) { ring = 0.;     }
 
-  // get the nuclear density at the current position
-  double rnow = x4.Vect().Mag(); 
-  double rho  = A * utils::nuclear::Density(rnow,(int) A,ring);
+  return ring;
+}
+//____________________________________________________________________________
+bool genie::utils::intranuke::TotXSec(
+   int pdgc, const TLorentzVector & p4, double A, double Z, double & sigtot)
+{
+// Total x-section (in fm^2) of the input hadron on a nucleon of a nucleus
+// with the input A, Z, used for computing its mean free path.
+// Returns false if there is no such x-section for the input hadron.
+// See MeanFreePath() for the inputs.
+//
+  bool is_pion    = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM;
+  bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
+  bool is_kaon    = pdgc == kPdgKP;
+  bool is_gamma   = pdgc == kPdgGamma;
+
+  sigtot = 0;
+
+  if(!is_pion && !is_nucleon && !is_kaon && !is_gamma) return false;
 
   // the hadron+nucleon cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -116,55 +170,21 @@ double genie::utils::intranuke::MeanFreePath(
   ke = TMath::Max(INukeHadroData::fMinKinEnergy,   ke);
   ke = TMath::Min(INukeHadroData::fMaxKinEnergyHN, ke);
 
-  // get total xsection for the incident hadron at its current
-  // kinetic energy
-  double sigtot = 0;
   double ppcnt = (double) Z/ (double) A; // % of protons remaining
   INukeHadroData * fHadroData = INukeHadroData::Instance();
 
-  if (pdgc == kPdgPiP)
-    { sigtot = fHadroData -> XSecPipp_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecPipn_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPi0)
-    { sigtot = fHadroData -> XSecPi0p_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecPi0n_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgPiM)
-    { sigtot = fHadroData -> XSecPipn_Tot() -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecPipp_Tot() -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgProton)
-    { sigtot = fHadroData -> XSecPp_Tot()   -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecPn_Tot()   -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgNeutron)
-    { sigtot = fHadroData -> XSecPn_Tot()   -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecNn_Tot()   -> Evaluate(ke)*(1-ppcnt);}
-  else if (pdgc == kPdgKP)
-    { sigtot = fHadroData -> XSecKpN_Tot()  -> Evaluate(ke);
-      sigtot*=1.2;}
-  else if (pdgc == kPdgGamma)
-    { sigtot = fHadroData -> XSecGamp_fs()  -> Evaluate(ke)*ppcnt;
-      sigtot+= fHadroData -> XSecGamn_fs()  -> Evaluate(ke)*(1-ppcnt);}
-  else {
-     return 0;
+  double sigp = 0, sign = 0;
+  if(! fHadroData->TotXSecs(pdgc, ke, sigp, sign)) {
+     return false;
   }
+  if (pdgc == kPdgKP) { sigtot = 1.2 * sigp; }
+  else                { sigtot = sigp*ppcnt + sign*(1-ppcnt); }
 
   // the xsection splines in INukeHadroData return the hadron x-section in
   // mb -> convert to fm^2
   sigtot *= (units::mb / units::fm2);
 
-  // compute the mean free path
-  double lamda = 1. / (rho * sigtot);
-
-  // exits if lamda is InF (if cross section is 0)
-  if( ! TMath::Finite(lamda) ) {
-     return -1;
-  }
-
-/*
-  LOG("INukeUtils", pDEBUG) 
-     << "sig_total = " << sigtot << " fm^2, rho = " << rho 
-     << " fm^-3  => mfp = " << lamda << " fm.";
-*/
-  return lamda;
+  return true;
 }
 //____________________________________________________________________________
 double genie::utils::intranuke::MeanFreePath_Delta(
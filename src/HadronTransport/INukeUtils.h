@@ -52,7 +52,16 @@ namespace intranuke
   double MeanFreePath(
     int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
     double Z, double nRpi=0.5, double nRnuc=1.0);
- 
+
+  //! Ring size (nuclear size enhancement) used in the mean free path calculation
+  double RingSize(
+    int pdgc, const TLorentzVector & p4, double A,
+    double nRpi=0.5, double nRnuc=1.0);
+
+  //! h+N total x-section (fm^2) used in the mean free path calculation
+  bool TotXSec(
+    int pdgc, const TLorentzVector & p4, double A, double Z, double & sigtot);
+
   //! Mean free path (Delta++ **test**)
   double MeanFreePath_Delta(
     int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A);
@@ -48,6 +48,11 @@
    start of the event processing and is used throughout. fInTestMode flag and
    special INTRANUKE configs not needed. ProcessEventRecord() was added by 
    factoring out code from HNIntranuke and HAIntranuke. Some comments added.
+ @ Oct 17, 2026 - agent
+   Added StepToInteraction(), stepping hadrons in batches of steps with the
+   quantities which are constant along the hadron path computed only once.
+   It is used by TransportHadrons() if BatchStepping is set (default) and
+   gives identical results to the step-by-step loop.
 
 */
 //____________________________________________________________________________
@@ -334,16 +339,21 @@ void Intranuke::TransportHadrons(GHepRecord * evrec) const
 
     // Start stepping particle out of the nucleus
     bool has_interacted = false;
-    while ( this-> IsInNucleus(sp) ) 
-    {
-      // advance the hadron by a step
-      utils::intranuke::StepParticle(sp, fHadStep);
-
-      // check whether it interacts
-      double d = this->GenerateStep(evrec,sp);
-      has_interacted = (d<fHadStep);
-      if(has_interacted) break;
-    }//stepping
+    if(fBatchStepping) {
+      has_interacted = this->StepToInteraction(sp);
+    }
+    else {
+      while ( this-> IsInNucleus(sp) ) 
+      {
+        // advance the hadron by a step
+        utils::intranuke::StepParticle(sp, fHadStep);
+
+        // check whether it interacts
+        double d = this->GenerateStep(evrec,sp);
+        has_interacted = (d<fHadStep);
+        if(has_interacted) break;
+      }//stepping
+    }
  
     if(has_interacted && fRemnA>0)  {
         // the particle interacts - simulate the hadronic interaction
@@ -406,6 +416,98 @@ double Intranuke::GenerateStep(GHepRecord* /*evrec*/, GHepParticle* p) const
   return d;
 }
 //___________________________________________________________________________
+bool Intranuke::StepToInteraction(GHepParticle* p) const
+{
+// Steps particle p out of the nucleus and checks whether it interacts at each
+// step. Returns true if it does, leaving it at the position of that step.
+//
+// Gives identical results to the loop over StepParticle() and GenerateStep()
+// calls in TransportHadrons(): The same arithmetic is used and one random
+// number is drawn per step, in the same order. However, the quantities which
+// don't change along the path (step vector, ring size and h+N x-section) are
+// computed once and the positions, nuclear densities and mean free paths are
+// computed for batches of steps, kept in structure-of-arrays buffers.
+
+  const int kNStepsBatch = 64;
+
+  if((int)fStepX.size() < kNStepsBatch) {
+    fStepX.resize   (kNStepsBatch);
+    fStepY.resize   (kNStepsBatch);
+    fStepZ.resize   (kNStepsBatch);
+    fStepR.resize   (kNStepsBatch);
+    fStepDens.resize(kNStepsBatch);
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  int    pdgc = p->Pdg();
+  double A    = fRemnA;
+  double Z    = fRemnZ;
+  const TLorentzVector & p4 = *(p->P4());
+
+  // step vector, as in utils::intranuke::StepParticle()
+  TVector3 dr = p4.Vect().Unit();
+  dr.SetMag(fHadStep);
+  double dx = dr.X(), dy = dr.Y(), dz = dr.Z();
+
+  // mean free path = 1/(A*density*sigtot), as in MeanFreePath()
+  double sigtot = 0;
+  bool   has_xsec = utils::intranuke::TotXSec(pdgc, p4, A, Z, sigtot);
+  double ring = utils::intranuke::RingSize(pdgc, p4, A, fDelRPion, fDelRNucleon);
+
+  double x = p->Vx(), y = p->Vy(), z = p->Vz();
+  double rmax = fTrackingRadius + fHadStep;  // see IsInNucleus()
+
+  bool has_interacted = false;
+  bool is_in_nucleus  = true;
+
+  while(is_in_nucleus && !has_interacted) {
+
+    // positions for the next batch of steps
+    int nsteps = 0;
+    while(nsteps < kNStepsBatch) {
+      is_in_nucleus = (TMath::Sqrt(x*x + y*y + z*z) < rmax);
+      if(!is_in_nucleus) break;
+      x += dx;
+      y += dy;
+      z += dz;
+      fStepX[nsteps] = x;
+      fStepY[nsteps] = y;
+      fStepZ[nsteps] = z;
+      fStepR[nsteps] = TMath::Sqrt(x*x + y*y + z*z);
+      nsteps++;
+    }
+    if(nsteps == 0) break;
+
+    // nuclear densities at these positions
+    if(has_xsec) {
+      utils::nuclear::Density(nsteps, &fStepR[0], (int)A, ring, &fStepDens[0]);
+    }
+
+    // check whether it interacts at any of these steps
+    for(int istep = 0; istep < nsteps; istep++) {
+      double L = 0;
+      if(has_xsec) {
+        double rho = A * fStepDens[istep];
+        L = 1. / (rho * sigtot);
+        if( ! TMath::Finite(L) ) L = -1;
+      }
+      double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
+      has_interacted = (d<fHadStep);
+      if(has_interacted) {
+        x = fStepX[istep];
+        y = fStepY[istep];
+        z = fStepZ[istep];
+        break;
+      }
+    }
+  }
+
+  p->SetPosition(x, y, z, p->Vt());
+
+  return has_interacted;
+}
+//___________________________________________________________________________
 void Intranuke::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
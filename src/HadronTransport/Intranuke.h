@@ -30,8 +30,9 @@
 #ifndef _INTRANUKE_H_
 #define _INTRANUKE_H_
 
-#include <TGenPhaseSpace.h>
+#include <vector>
 
+#include <TGenPhaseSpace.h>
 
 #include "Algorithm/AlgFactory.h"
 #include "EVGCore/EventRecordVisitorI.h"
@@ -43,6 +44,8 @@
 class TLorentzVector;
 class TVector3;
 
+using std::vector;
+
 namespace genie {
 
 class GHepParticle;
@@ -82,6 +85,7 @@ protected:
   bool   IsInNucleus        (const GHepParticle* p) const;
   void   SetTrackingRadius  (const GHepParticle* p) const;
   double GenerateStep       (GHepRecord* ev, GHepParticle* p) const;
+  bool   StepToInteraction  (GHepParticle* p) const;
 
   // virtual functions for individual modes
   virtual void SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p) const = 0;
@@ -98,6 +102,13 @@ protected:
   mutable TLorentzVector fRemnP4;        ///< P4 of remnant system
   mutable GEvGenMode_t   fGMode;         ///< event generation mode (lepton+A, hadron+A, ...)
 
+  // structure-of-arrays buffers for the batched hadron stepping (per step)
+  mutable vector<double> fStepX;         ///< hadron position after each step (fm)
+  mutable vector<double> fStepY;         ///<
+  mutable vector<double> fStepZ;         ///<
+  mutable vector<double> fStepR;         ///< hadron radial position after each step (fm)
+  mutable vector<double> fStepDens;      ///< nuclear density after each step (fm^-3, normalized to 1)
+
   // configuration parameters
   double       fR0;           ///< effective nuclear size param
   double       fNR;           ///< param multiplying the nuclear radius, determining how far to track hadrons beyond the "nuclear boundary"
@@ -114,6 +125,8 @@ protected:
   bool         fDoFermi;      ///< whether or not to do fermi mom. 
   bool         fDoMassDiff;   ///< whether or not to do mass diff. mode
   bool         fDoCompoundNucleus; ///< whether or not to do compound nucleus considerations
+  bool         fUseLookupTables;  ///< serve hadron x-sections & fractions from lookup tables?
+  bool         fBatchStepping;    ///< step hadrons in batches of steps (see StepToInteraction())?
 };
 
 }      // genie namespace
@@ -8,6 +8,7 @@
 #pragma link C++ namespace genie::utils::intranuke;
 
 #pragma link C++ class genie::INukeHadroData;
+#pragma link C++ class genie::INukeSurvivalTable;
 #pragma link C++ class genie::INukeDeltaPropg;
 //#pragma link C++ class genie::INukePhotoPropg;
 #pragma link C++ class genie::Intranuke;
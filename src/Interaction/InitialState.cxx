@@ -18,6 +18,8 @@
    memory allocated in the default ctor when objects of this class are read by 
    the ROOT Streamer. 
 	
+ @ Oct 17, 2026 - agent
+   Added Key() returning a compact 64-bit code to be used in look-ups.
 */
 //____________________________________________________________________________
 
@@ -371,6 +373,17 @@ string InitialState::AsString(void) const
   return init_state.str();
 }
 //___________________________________________________________________________
+ULong64_t InitialState::Key(void) const
+{
+// Pack the probe and target PDG codes in a 64-bit integer:
+// bits 0-23: probe PDG code (offset by 2^23), bits 24-63: target PDG code
+
+  ULong64_t probe = (ULong64_t) (this->ProbePdg() + (1<<23)) & 0xffffff;
+  ULong64_t tgt   = (ULong64_t) this->Tgt().Pdg();
+
+  return (tgt << 24) | probe;
+}
+//___________________________________________________________________________
 void InitialState::Print(ostream & stream) const
 {
   stream << "[-] [Init-State] " << endl;
@@ -75,6 +75,9 @@ public:
   string AsString (void) const;
   void   Print    (ostream & stream) const;
 
+  //-- Compact code holding the same information as AsString() (look-up key)
+  ULong64_t Key   (void) const;
+
   //-- Overloaded operators
   bool             operator == (const InitialState & i) const;             ///< equal?
   InitialState &   operator =  (const InitialState & i);                   ///< copy
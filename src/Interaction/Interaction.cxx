@@ -54,12 +54,17 @@
  @ Feb 12, 2013 - CA (code from Rosen Matev)
    In elastic neutrino-electron scattering, always set the electron as the 
    final state primary lepton. Handle the IMD annihilation channel.
+ @ Oct 17, 2026 - agent
+   Added Key() returning a compact 64-bit code to be used in look-ups
+   instead of AsString().
 */
 //____________________________________________________________________________
 
 #include <sstream>
+#include <map>
 
 #include <TRootIOCtor.h>
+#include <TMath.h>
 
 #include "Conventions/Constants.h"
 #include "Interaction/Interaction.h"
@@ -73,6 +78,7 @@ using namespace genie::constants;
 
 using std::endl;
 using std::ostringstream;
+using std::map;
 
 ClassImp(Interaction)
 
@@ -311,6 +317,132 @@ string Interaction::AsString(void) const
   return interaction.str();
 }
 //___________________________________________________________________________
+ULong64_t Interaction::Key(void) const
+{
+// Pack the interaction in a 64-bit integer. It holds the same information as
+// AsString() and is much faster to build and compare.
+// Layout (from least significant bit):
+//   4 bits : probe (0: none, 1-6: l-, nu, 7-12: l+, nubar - for e,mu,tau)
+//   7 bits : target Z
+//   8 bits : target A
+//   3 bits : hit nucleon (0: not set, 1: p, 2: n, 3: nn, 4: np, 5: pp cluster)
+//   4 bits : hit quark (0: not set, else pdg+7)
+//   1 bit  : sea quark?
+//   3 bits : interaction type
+//   4 bits : scattering type
+//   1 bit  : charm event?
+//   4 bits : charmed hadron (0: inclusive)
+//  15 bits : f/s multiplicities (p, n, pi+, pi-, pi0; 3 bits each)
+//   5 bits : resonance (0: not set)
+//   3 bits : decay mode (0: not set)
+// Interactions that do not fit in this layout (eg hypernuclei, other probes,
+// large multiplicities) get a sequential code with the most significant bit
+// set, so that codes are always unique within a job.
+
+  const Target &  tgt  = fInitialState->Tgt();
+  const XclsTag & xcls = *fExclusiveTag;
+
+  bool fits = true;
+
+  // probe
+  int probe = fInitialState->ProbePdg();
+  int aprobe = TMath::Abs(probe);
+  ULong64_t cprobe = 0;
+  if(probe != 0) {
+    fits = fits && (aprobe >= 11 && aprobe <= 16);
+    cprobe = (aprobe - 10) + ((probe < 0) ? 6 : 0);
+  }
+
+  // target
+  int Z = tgt.Z();
+  int A = tgt.A();
+  fits = fits && (Z >= 0 && Z < 128 && A >= 0 && A < 256);
+  fits = fits && (tgt.Pdg() == pdg::IonPdgCode(A,Z));
+
+  // hit nucleon & quark
+  ULong64_t cnuc = 0;
+  if(tgt.HitNucIsSet()) {
+    int nuc = tgt.HitNucPdg();
+    if      (nuc == kPdgProton   ) cnuc = 1;
+    else if (nuc == kPdgNeutron  ) cnuc = 2;
+    else if (nuc == kPdgClusterNN) cnuc = 3;
+    else if (nuc == kPdgClusterNP) cnuc = 4;
+    else if (nuc == kPdgClusterPP) cnuc = 5;
+    else fits = false;
+  }
+  ULong64_t cqrk = 0;
+  ULong64_t csea = 0;
+  if(tgt.HitQrkIsSet()) {
+    int qrk = tgt.HitQrkPdg();
+    fits = fits && (qrk != 0 && TMath::Abs(qrk) <= 6);
+    cqrk = qrk + 7;
+    csea = (tgt.HitSeaQrk()) ? 1 : 0;
+  }
+
+  // process
+  int it = (int) fProcInfo->InteractionTypeId();
+  int st = (int) fProcInfo->ScatteringTypeId();
+  fits = fits && (it >= 0 && it < 8 && st >= 0 && st < 16);
+
+  // exclusive tag
+  ULong64_t ccharm = (xcls.IsCharmEvent()) ? 1 : 0;
+  ULong64_t chadr  = 0;
+  if(xcls.IsCharmEvent() && xcls.CharmHadronPdg() != 0) {
+    const int charm_hadrons[] = { 
+      kPdgDP, kPdgDM, kPdgD0, kPdgAntiD0, kPdgDPs, kPdgDMs, 
+      kPdgLambdaPc, -kPdgLambdaPc };
+    for(int ich = 0; ich < 8; ich++) {
+      if(xcls.CharmHadronPdg() == charm_hadrons[ich]) chadr = ich + 1;
+    }
+    fits = fits && (chadr != 0);
+  }
+  int mult[5] = { xcls.NProtons(), xcls.NNeutrons(), 
+                  xcls.NPiPlus(),  xcls.NPiMinus(),  xcls.NPi0() };
+  ULong64_t cmult = 0;
+  for(int im = 0; im < 5; im++) {
+    fits = fits && (mult[im] >= 0 && mult[im] < 8);
+    cmult |= ((ULong64_t) (mult[im] & 0x7)) << (3*im);
+  }
+  ULong64_t cres = 0;
+  if(xcls.KnownResonance()) {
+    int res = (int) xcls.Resonance();
+    fits = fits && (res >= 0 && res < 31);
+    cres = res + 1;
+  }
+  int decay = xcls.DecayMode();
+  fits = fits && (decay >= -1 && decay < 7);
+  ULong64_t cdec = decay + 1;
+
+  if(!fits) {
+    // unique code for anything that does not fit
+    static map<string, ULong64_t> other;
+    string code = this->AsString();
+    map<string, ULong64_t>::const_iterator iter = other.find(code);
+    if(iter != other.end()) return iter->second;
+    ULong64_t key = (((ULong64_t) 1) << 63) | (ULong64_t) other.size();
+    other.insert(map<string, ULong64_t>::value_type(code, key));
+    return key;
+  }
+
+  ULong64_t key = 0;
+  int shift = 0;
+  key |= cprobe                     << shift;  shift += 4;
+  key |= (ULong64_t) Z              << shift;  shift += 7;
+  key |= (ULong64_t) A              << shift;  shift += 8;
+  key |= cnuc                       << shift;  shift += 3;
+  key |= (cqrk & 0xf)               << shift;  shift += 4;
+  key |= csea                       << shift;  shift += 1;
+  key |= (ULong64_t) it             << shift;  shift += 3;
+  key |= (ULong64_t) st             << shift;  shift += 4;
+  key |= ccharm                     << shift;  shift += 1;
+  key |= chadr                      << shift;  shift += 4;
+  key |= cmult                      << shift;  shift += 15;
+  key |= cres                       << shift;  shift += 5;
+  key |= (cdec & 0x7)               << shift;  shift += 3;
+
+  return key;
+}
+//___________________________________________________________________________
 void Interaction::Print(ostream & stream) const
 {
   const string line(110, '-');
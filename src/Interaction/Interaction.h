@@ -87,6 +87,10 @@ public:
   string AsString (void) const;
   void   Print    (ostream & stream) const;
 
+  // Compact code holding the same information as AsString(). To be used
+  // as key in look-ups (AsString() should be used for printing only)
+  ULong64_t Key   (void) const;
+
   // Overloaded operators
   Interaction &    operator =  (const Interaction & i);                   ///< copy
   friend ostream & operator << (ostream & stream, const Interaction & i); ///< print
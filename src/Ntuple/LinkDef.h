@@ -13,6 +13,7 @@
 #pragma link C++ class genie::NtpMCRecHeader;
 #pragma link C++ class genie::NtpMCRecordI;
 #pragma link C++ class genie::NtpMCEventRecord;
+#pragma link C++ class genie::NtpMCFlatEvent;
 #pragma link C++ class genie::NtpWriter;
 
 #endif
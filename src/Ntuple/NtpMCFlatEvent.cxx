@@ -0,0 +1,255 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <vector>
+#include <iomanip>
+
+#include <TTree.h>
+#include <TMath.h>
+#include <TLorentzVector.h>
+
+#include "EVGCore/EventRecord.h"
+#include "GHEP/GHepParticle.h"
+#include "Messenger/Messenger.h"
+#include "Ntuple/NtpMCFlatEvent.h"
+#include "Utils/StringUtils.h"
+
+using std::vector;
+using std::endl;
+using std::setw;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator<< (ostream& stream, const NtpMCFlatEvent & rec)
+  {
+     rec.PrintToStream(stream);
+     return stream;
+  }
+}
+//____________________________________________________________________________
+NtpMCFlatEvent::NtpMCFlatEvent()
+{
+  pdg    = 0;
+  ist    = 0;
+  rescat = 0;
+  fm     = 0;
+  lm     = 0;
+  fd     = 0;
+  ld     = 0;
+  p4     = 0;
+  x4     = 0;
+  fNMax  = 0;
+  fTree  = 0;
+
+  this->Reserve(250);
+  this->Clear();
+}
+//____________________________________________________________________________
+NtpMCFlatEvent::~NtpMCFlatEvent()
+{
+  delete [] pdg;
+  delete [] ist;
+  delete [] rescat;
+  delete [] fm;
+  delete [] lm;
+  delete [] fd;
+  delete [] ld;
+  delete [] p4;
+  delete [] x4;
+}
+//____________________________________________________________________________
+void NtpMCFlatEvent::Fill(unsigned int ievent, const EventRecord * ev_rec)
+{
+  this->Clear();
+
+  iev   = ievent;
+  wght  = ev_rec->Weight();
+  prob  = ev_rec->Probability();
+  xsec  = ev_rec->XSec();
+  dxsec = ev_rec->DiffXSec();
+
+  const TLorentzVector * v = ev_rec->Vertex();
+  if(v) {
+    vtx[0] = v->X(); vtx[1] = v->Y(); vtx[2] = v->Z(); vtx[3] = v->T();
+  }
+
+  int np = ev_rec->GetEntries();
+  if(np > fNMax) this->Reserve(np);
+
+  for(int i = 0; i < np; i++) {
+    const GHepParticle * p = ev_rec->Particle(i);
+    if(!p) continue;
+    pdg   [i] = p->Pdg();
+    ist   [i] = (int) p->Status();
+    rescat[i] = p->RescatterCode();
+    fm    [i] = p->FirstMother();
+    lm    [i] = p->LastMother();
+    fd    [i] = p->FirstDaughter();
+    ld    [i] = p->LastDaughter();
+    double * pp = p4 + 4*i;
+    double * px = x4 + 4*i;
+    pp[0] = p->Px(); pp[1] = p->Py(); pp[2] = p->Pz(); pp[3] = p->E();
+    px[0] = p->Vx(); px[1] = p->Vy(); px[2] = p->Vz(); px[3] = p->Vt();
+  }
+  n = np;
+}
+//____________________________________________________________________________
+void NtpMCFlatEvent::Clear(void)
+{
+// The per-particle arrays are only meaningful for the first n entries, so
+// only the counters and event-level values need resetting
+
+  iev   = 0;
+  wght  = 0;
+  prob  = 0;
+  xsec  = 0;
+  dxsec = 0;
+  for(int k = 0; k < 4; k++) vtx[k] = 0;
+  n     = 0;
+}
+//____________________________________________________________________________
+void NtpMCFlatEvent::CreateBranches(TTree * tree)
+{
+  if(!tree) return;
+
+  LOG("Ntp", pINFO) << "Creating the flat event TBranches";
+
+  fTree = tree;
+
+  tree->Branch("iev",    &iev,     "iev/I"        );
+  tree->Branch("wght",   &wght,    "wght/D"       );
+  tree->Branch("prob",   &prob,    "prob/D"       );
+  tree->Branch("xsec",   &xsec,    "xsec/D"       );
+  tree->Branch("dxsec",  &dxsec,   "dxsec/D"      );
+  tree->Branch("vtx",     vtx,     "vtx[4]/D"     );
+  tree->Branch("n",      &n,       "n/I"          );
+  tree->Branch("pdg",     pdg,     "pdg[n]/I"     );
+  tree->Branch("ist",     ist,     "ist[n]/I"     );
+  tree->Branch("rescat",  rescat,  "rescat[n]/I"  );
+  tree->Branch("fm",      fm,      "fm[n]/I"      );
+  tree->Branch("lm",      lm,      "lm[n]/I"      );
+  tree->Branch("fd",      fd,      "fd[n]/I"      );
+  tree->Branch("ld",      ld,      "ld[n]/I"      );
+  tree->Branch("p4",      p4,      "p4[n][4]/D"   );
+  tree->Branch("x4",      x4,      "x4[n][4]/D"   );
+}
+//____________________________________________________________________________
+void NtpMCFlatEvent::SetBranchAddresses(TTree * tree, string columns)
+{
+  if(!tree) return;
+
+  this->Clear();
+
+  // make room for the largest event in the tree
+  fTree = tree;
+  int nmax = (int) tree->GetMaximum("n");
+  if(nmax > fNMax) this->Reserve(nmax);
+
+  columns = utils::str::TrimSpaces(columns);
+  bool all = (columns.size() == 0 || columns == "*");
+
+  if(!all) {
+    const char * per_particle[] = {
+       "pdg", "ist", "rescat", "fm", "lm", "fd", "ld", "p4", "x4" };
+
+    tree->SetBranchStatus("*", 0);
+    vector<string> cols = utils::str::Split(columns, ",");
+    vector<string>::const_iterator iter = cols.begin();
+    for( ; iter != cols.end(); ++iter) {
+      string col = utils::str::TrimSpaces(*iter);
+      if(col.size() == 0) continue;
+      if(!tree->GetBranch(col.c_str())) {
+        LOG("Ntp", pWARN) << "No column named `" << col << "' in event tree";
+        continue;
+      }
+      tree->SetBranchStatus(col.c_str(), 1);
+      for(int k = 0; k < 9; k++) {
+        if(col == per_particle[k]) tree->SetBranchStatus("n", 1);
+      }
+    }
+  }
+
+  tree->SetBranchAddress("iev",    &iev      );
+  tree->SetBranchAddress("wght",   &wght     );
+  tree->SetBranchAddress("prob",   &prob     );
+  tree->SetBranchAddress("xsec",   &xsec     );
+  tree->SetBranchAddress("dxsec",  &dxsec    );
+  tree->SetBranchAddress("vtx",     vtx      );
+  tree->SetBranchAddress("n",      &n        );
+  this->SetArrayAddresses();
+}
+//____________________________________________________________________________
+void NtpMCFlatEvent::Reserve(int nparticles)
+{
+// Re-allocate the per-particle arrays (their contents are not kept) so that
+// they hold at least nparticles and re-point the tree branches to them
+
+  if(nparticles <= fNMax) return;
+
+  int nmax = TMath::Max(nparticles, 2*fNMax);
+
+  delete [] pdg;    pdg    = new Int_t    [nmax];
+  delete [] ist;    ist    = new Int_t    [nmax];
+  delete [] rescat; rescat = new Int_t    [nmax];
+  delete [] fm;     fm     = new Int_t    [nmax];
+  delete [] lm;     lm     = new Int_t    [nmax];
+  delete [] fd;     fd     = new Int_t    [nmax];
+  delete [] ld;     ld     = new Int_t    [nmax];
+  delete [] p4;     p4     = new Double_t [4*nmax];
+  delete [] x4;     x4     = new Double_t [4*nmax];
+
+  fNMax = nmax;
+
+  if(fTree) {
+    LOG("Ntp", pINFO)
+      << "Flat event record particle arrays resized to " << fNMax;
+    this->SetArrayAddresses();
+  }
+}
+//____________________________________________________________________________
+void NtpMCFlatEvent::SetArrayAddresses(void)
+{
+  if(!fTree) return;
+
+  fTree->SetBranchAddress("pdg",     pdg      );
+  fTree->SetBranchAddress("ist",     ist      );
+  fTree->SetBranchAddress("rescat",  rescat   );
+  fTree->SetBranchAddress("fm",      fm       );
+  fTree->SetBranchAddress("lm",      lm       );
+  fTree->SetBranchAddress("fd",      fd       );
+  fTree->SetBranchAddress("ld",      ld       );
+  fTree->SetBranchAddress("p4",      p4       );
+  fTree->SetBranchAddress("x4",      x4       );
+}
+//____________________________________________________________________________
+void NtpMCFlatEvent::PrintToStream(ostream & stream) const
+{
+  stream << "Event: " << iev << ", weight = " << wght
+         << ", prob = " << prob << ", xsec = " << xsec
+         << ", dxsec = " << dxsec << ", vtx = ("
+         << vtx[0] << ", " << vtx[1] << ", " << vtx[2] << ", " << vtx[3] << ")"
+         << endl;
+  for(int i = 0; i < n; i++) {
+    stream << setw(4) << i << " | " << setw(11) << pdg[i]
+           << " | " << setw(3) << ist[i]
+           << " | " << setw(3) << fm[i] << " " << setw(3) << lm[i]
+           << " | " << setw(3) << fd[i] << " " << setw(3) << ld[i]
+           << " | " << p4[4*i] << " " << p4[4*i+1] << " " << p4[4*i+2]
+           << " " << p4[4*i+3] << endl;
+  }
+}
+//____________________________________________________________________________
@@ -0,0 +1,110 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpMCFlatEvent
+
+\brief   Flat, columnar event ntuple record (the kNFFlat output format).
+         Rather than streaming a full EventRecord (a TClonesArray of
+         GHepParticle objects, each holding its own TLorentzVectors) per
+         event, each event is stored as a few event-level values plus one
+         variable-length array per particle property (pdg code, status,
+         mothers, daughters, 4-momentum, 4-position). Every property is a
+         separate TBranch, so ROOT stores it in its own compressed baskets.
+         Reading an event fills the arrays of this record in place (no
+         object is created), and readers may restrict the read to the
+         columns they need (see SetBranchAddresses()).
+         There is no limit on the number of particles: The per-particle
+         arrays grow as needed and the tree branches are re-pointed to the
+         new arrays (when writing), or are sized for the largest event in
+         the tree (when reading).
+
+         The format keeps the GHEP particle list and the event weights but
+         not the attached Interaction summary, so it is intended for
+         analysis / downstream applications rather than as a replacement of
+         the GHEP format for event generation studies.
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_MC_FLAT_EVENT_H_
+#define _NTP_MC_FLAT_EVENT_H_
+
+#include <string>
+#include <ostream>
+
+#include <Rtypes.h>
+
+class TTree;
+
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpMCFlatEvent {
+
+public :
+  NtpMCFlatEvent();
+ ~NtpMCFlatEvent();
+
+  void Fill  (unsigned int ievent, const EventRecord * ev_rec);
+  void Clear (void);
+
+  ///< create the event tree branches (one per column) pointing to this record
+  void CreateBranches (TTree * tree);
+
+  ///< point the branches of an existing event tree to this record.
+  ///< Only the comma-separated list of columns is read (all if "*"); the
+  ///< particle count column `n' is enabled with any per-particle column.
+  void SetBranchAddresses (TTree * tree, string columns = "*");
+
+  void PrintToStream(ostream & stream) const;
+  friend ostream & operator<< (ostream& stream, const NtpMCFlatEvent & rec);
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+
+  // event-level columns
+  Int_t    iev;     ///< event number
+  Double_t wght;    ///< event weight
+  Double_t prob;    ///< event probability
+  Double_t xsec;    ///< cross section for selected event (1E-38 cm2)
+  Double_t dxsec;   ///< differential cross section for selected event kinematics (1E-38 cm2/{K^n})
+  Double_t vtx[4];  ///< vertex x,y,z,t in the detector coordinate system
+
+  // per-particle columns (n entries each; 4 entries per particle for p4, x4)
+  Int_t      n;       ///< number of particles
+  Int_t    * pdg;     ///< PDG code
+  Int_t    * ist;     ///< status code (see GHepStatus_t)
+  Int_t    * rescat;  ///< rescattering code
+  Int_t    * fm;      ///< first mother
+  Int_t    * lm;      ///< last mother
+  Int_t    * fd;      ///< first daughter
+  Int_t    * ld;      ///< last daughter
+  Double_t * p4;      ///< px,py,pz,E (GeV) of particle i at p4[4*i] ... p4[4*i+3]
+  Double_t * x4;      ///< x,y,z,t in the hit nucleus frame (fm) of particle i at x4[4*i] ... x4[4*i+3]
+
+private:
+  // the record owns its arrays: no copies
+  NtpMCFlatEvent(const NtpMCFlatEvent & rec);
+  NtpMCFlatEvent & operator = (const NtpMCFlatEvent & rec);
+
+  void Reserve           (int nparticles); ///< make room for nparticles in the per-particle arrays
+  void SetArrayAddresses (void);           ///< point the per-particle branches of fTree to the arrays
+
+  int     fNMax;  ///< size of the per-particle arrays
+  TTree * fTree;  ///< event tree whose branches point to this record
+};
+
+}      // genie namespace
+
+#endif // _NTP_MC_FLAT_EVENT_H_
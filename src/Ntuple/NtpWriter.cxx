@@ -18,6 +18,12 @@
    Added CustomizeFilename() and CustomizeFilenamePrefix() to allow the use
    to customize either the entire output name or just the prefix before the
    run number.
+ @ Oct 17, 2026 - agent
+   Added the kNFFlat format, where events are written as flat columns (see
+   NtpMCFlatEvent) rather than as full NtpMCEventRecord objects.
+   The NtpMCEventRecord of the GHEP event branch is created once and re-used
+   for all events (rather than being re-allocated for every event) so that
+   the GHEP record particle objects are recycled.
 
 */
 //____________________________________________________________________________
@@ -34,6 +40,7 @@
 #include "Messenger/Messenger.h"
 #include "Ntuple/NtpWriter.h"
 #include "Ntuple/NtpMCEventRecord.h"
+#include "Ntuple/NtpMCFlatEvent.h"
 #include "Ntuple/NtpMCTreeHeader.h"
 #include "Ntuple/NtpMCJobConfig.h"
 #include "Ntuple/NtpMCJobEnv.h"
@@ -50,6 +57,7 @@ fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
 fNtpMCEventRecord(0),
+fNtpMCFlatEvent(0),
 fNtpMCTreeHeader(0)
 {
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
@@ -61,7 +69,8 @@ fNtpMCTreeHeader(0)
 //____________________________________________________________________________
 NtpWriter::~NtpWriter()
 {
-
+  if(fNtpMCEventRecord) delete fNtpMCEventRecord;
+  if(fNtpMCFlatEvent)   delete fNtpMCFlatEvent;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
@@ -79,11 +88,12 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
 
   switch (fNtpFormat) {
      case kNFGHEP:
-          fNtpMCEventRecord = new NtpMCEventRecord();
           fNtpMCEventRecord->Fill(ievent, ev_rec);
           fOutTree->Fill();
-          delete fNtpMCEventRecord;
-          fNtpMCEventRecord = 0;
+          break;
+     case kNFFlat:
+          fNtpMCFlatEvent->Fill(ievent, ev_rec);
+          fOutTree->Fill();
           break;
      default:
         break;
@@ -164,6 +174,9 @@ void NtpWriter::CreateEventBranch(void)
      case kNFGHEP:
         this->CreateGHEPEventBranch();
         break;
+     case kNFFlat:
+        this->CreateFlatEventBranch();
+        break;
      default:
         LOG("Ntp", pERROR)
            << "Unknown TTree format. Can not create TBranches";
@@ -177,13 +190,24 @@ void NtpWriter::CreateGHEPEventBranch(void)
 {
   LOG("Ntp", pINFO) << "Creating a NtpMCEventRecord TBranch";
 
-  fNtpMCEventRecord = 0;
+  if(!fNtpMCEventRecord) fNtpMCEventRecord = new NtpMCEventRecord();
   TTree::SetBranchStyle(1);
 
   fEventBranch = fOutTree->Branch("gmcrec",
       "genie::NtpMCEventRecord", &fNtpMCEventRecord, 32000, 1);
 }
 //____________________________________________________________________________
+void NtpWriter::CreateFlatEventBranch(void)
+{
+  LOG("Ntp", pINFO) << "Creating the NtpMCFlatEvent TBranches";
+
+  if(!fNtpMCFlatEvent) fNtpMCFlatEvent = new NtpMCFlatEvent;
+
+  fNtpMCFlatEvent->CreateBranches(fOutTree);
+
+  fEventBranch = fOutTree->GetBranch("n");
+}
+//____________________________________________________________________________
 void NtpWriter::CreateTreeHeader(void)
 {
   LOG("Ntp", pINFO) << "Creating the NtpMCTreeHeader";
@@ -35,6 +35,7 @@ namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
+class NtpMCFlatEvent;
 class NtpMCTreeHeader;
 
 class NtpWriter {
@@ -68,6 +69,7 @@ private:
   void CreateTreeHeader      (void);
   void CreateEventBranch     (void);
   void CreateGHEPEventBranch (void);
+  void CreateFlatEventBranch (void);
 
   NtpMCFormat_t      fNtpFormat;          ///< enumeration of event formats
   Long_t             fRunNu;              ///< run nu
@@ -75,7 +77,8 @@ private:
   TFile *            fOutFile;            ///< output file
   TTree *            fOutTree;            ///< output tree
   TBranch *          fEventBranch;        ///< the generated event branch 
-  NtpMCEventRecord * fNtpMCEventRecord;   ///< 
+  NtpMCEventRecord * fNtpMCEventRecord;   ///< GHEP event record (kNFGHEP format), re-used for all events
+  NtpMCFlatEvent *   fNtpMCFlatEvent;     ///< flat event record (kNFFlat format)
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
 };
 
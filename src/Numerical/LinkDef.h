@@ -7,7 +7,8 @@
 #pragma link C++ namespace genie;
 
 #pragma link C++ class genie::RandomGen;
-#pragma link C++ class genie::Spline;
+#pragma link C++ class genie::RandomStream;
+#pragma link C++ class genie::Spline-;
 #pragma link C++ class genie::BLI2DGrid;
 #pragma link C++ class genie::BLI2DUnifGrid;
 #pragma link C++ class genie::BLI2DNonUnifGrid;
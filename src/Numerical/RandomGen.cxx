@@ -12,6 +12,10 @@
  Important revisions after version 2.0.0 :
  @ Jan 24, 2013 - CA
    No longer uses the $GSEED variable for setting the random number seed.
+ @ Oct 17, 2026 - agent
+   Each accessor is now backed by its own counter-based random number stream
+   (see RandomStream) rather than by a single shared TRandom3. Added
+   SetEvent(run,event) to key all streams to the current event.
 
 */
 //____________________________________________________________________________
@@ -38,6 +42,10 @@ RandomGen::RandomGen()
 
   fInitalized = false;
   fInstance = 0;
+  fCurrRun    = 0;
+  fCurrEvent  = kRndPreRunEvent;
+  fEventKeyed = false;
+  for(int i = 0; i < kNRndStreams; i++) fStream[i] = 0;
 /*
   // try to get this job's random number seed from the environment
   const char * seed = gSystem->Getenv("GSEED");
@@ -73,7 +81,10 @@ RandomGen::RandomGen()
 RandomGen::~RandomGen()
 {
   fInstance = 0;
-  if(fRandom3) delete fRandom3;
+  for(int i = 0; i < kNRndStreams; i++) {
+    if(fStream[i]) delete fStream[i];
+    fStream[i] = 0;
+  }
 }
 //____________________________________________________________________________
 RandomGen * RandomGen::Instance()
@@ -96,18 +107,14 @@ void RandomGen::SetSeed(long int seed)
      << ((fInitalized) ? ": " : " at random number generator initialization: ")
      << seed;
 
+  fCurrSeed = seed;
+
   // Set the seed number for all internal GENIE random number generators
-  this->RndKine ().SetSeed(seed);
-  this->RndHadro().SetSeed(seed);
-  this->RndDec  ().SetSeed(seed); 
-  this->RndFsi  ().SetSeed(seed);
-  this->RndLep  ().SetSeed(seed);
-  this->RndISel ().SetSeed(seed);
-  this->RndGeom ().SetSeed(seed);
-  this->RndFlux ().SetSeed(seed);
-  this->RndEvg  ().SetSeed(seed);
-  this->RndNum  ().SetSeed(seed); 
-  this->RndGen  ().SetSeed(seed);
+  // (random number streams are distinguished by their stream id, so they
+  // can all share the same seed number)
+  for(int i = 0; i < kNRndStreams; i++) {
+    fStream[i]->SetSeed(seed);
+  }
 
   // Set the seed number for ROOT's gRandom
   gRandom ->SetSeed (seed);
@@ -131,9 +138,27 @@ void RandomGen::SetSeed(long int seed)
   LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
 }
 //____________________________________________________________________________
+void RandomGen::SetEvent(Long_t run, Long64_t event)
+{
+  if(fEventKeyed && run == fCurrRun && event == fCurrEvent) return;
+
+  LOG("Rndm", pINFO)
+     << "Keying random number streams to run: " << run << ", event: " << event;
+
+  fCurrRun    = run;
+  fCurrEvent  = event;
+  fEventKeyed = true;
+
+  for(int i = 0; i < kNRndStreams; i++) {
+    fStream[i]->SetEvent(run, event);
+  }
+}
+//____________________________________________________________________________
 void RandomGen::InitRandomGenerators(long int seed)
 {
-  fRandom3 = new TRandom3();
+  for(int i = 0; i < kNRndStreams; i++) {
+    fStream[i] = new RandomStream(i);
+  }
   this->SetSeed(seed);
 }
 //____________________________________________________________________________
@@ -23,10 +23,26 @@
 #ifndef _RANDOM_GEN_H_
 #define _RANDOM_GEN_H_
 
-#include <TRandom3.h>
+#include "Numerical/RandomStream.h"
 
 namespace genie {
 
+//! Random number streams, one per GENIE subsystem
+typedef enum ERndStream {
+  kRndKine = 0,
+  kRndHadro,
+  kRndDec,
+  kRndFsi,
+  kRndLep,
+  kRndISel,
+  kRndGeom,
+  kRndFlux,
+  kRndEvg,
+  kRndNum,
+  kRndGen,
+  kNRndStreams
+} RndStream_t;
+
 class RandomGen {
 
 public:
@@ -35,50 +51,62 @@ public:
   static RandomGen * Instance();
 
   //! Random number generators used by various GENIE modules.
-  //! (See note at http://root.cern.ch/root/html//TRandom.html
-  //!  on using several TRandom objects each with each own
-  //!  "independent" run sequence).
-
-  //! At this point, since the actual random number generator
-  //! periodicity is very high, all the generators are in fact one!
-  //! However, the option to use many generators is reserved.
-
-  //! Currently, the preferred generator is the "Mersenne Twister"
-  //! with a periodicity of 10**6000
-  //! See: http://root.cern.ch/root/html/TRandom3.html
+  //! Each module has its own, independent, random number stream.
+  //! The streams are counter-based generators (Philox-4x32-10, see
+  //! RandomStream) keyed by (seed, run, event, stream): The numbers drawn
+  //! for a given event depend only on these and not on how many numbers
+  //! were drawn earlier in the job or by other modules. So, an event can be
+  //! regenerated in isolation, jobs can be split at any event boundary and
+  //! the event generation stages can be re-ordered without affecting the
+  //! random numbers seen by each stage.
 
   //! rnd number generator used by kinematics generators
-  TRandom3 & RndKine (void) const { return *fRandom3; } 
+  TRandom & RndKine (void) const { return *fStream[kRndKine]; } 
 
   //! rnd number generator used by hadronization models 
-  TRandom3 & RndHadro (void) const { return *fRandom3; }
+  TRandom & RndHadro (void) const { return *fStream[kRndHadro]; }
 
   //! rnd number generator used by decay models 
-  TRandom3 & RndDec (void) const { return *fRandom3; }
+  TRandom & RndDec (void) const { return *fStream[kRndDec]; }
 
   //! rnd number generator used by intranuclear cascade monte carlos
-  TRandom3 & RndFsi (void) const { return *fRandom3; }
+  TRandom & RndFsi (void) const { return *fStream[kRndFsi]; }
 
   //! rnd number generator used by final state primary lepton generators
-  TRandom3 & RndLep (void) const { return *fRandom3; } 
+  TRandom & RndLep (void) const { return *fStream[kRndLep]; } 
 
   //! rnd number generator used by interaction selectors
-  TRandom3 & RndISel (void) const { return *fRandom3; }
+  TRandom & RndISel (void) const { return *fStream[kRndISel]; }
 
   //! rnd number generator used by geometry drivers
-  TRandom3 & RndGeom (void) const { return *fRandom3; }
+  TRandom & RndGeom (void) const { return *fStream[kRndGeom]; }
 
   //! rnd number generator used by flux drivers
-  TRandom3 & RndFlux (void) const { return *fRandom3; }
+  TRandom & RndFlux (void) const { return *fStream[kRndFlux]; }
 
   //! rnd number generator used by the event generation drivers
-  TRandom3 & RndEvg (void) const { return *fRandom3; }
+  TRandom & RndEvg (void) const { return *fStream[kRndEvg]; }
 
   //! rnd number generator used by MC integrators & other numerical methods
-  TRandom3 & RndNum (void) const { return *fRandom3; }
+  TRandom & RndNum (void) const { return *fStream[kRndNum]; }
 
   //! rnd number generator for generic usage
-  TRandom3 & RndGen  (void) const { return *fRandom3; }
+  TRandom & RndGen  (void) const { return *fStream[kRndGen]; }
+
+  //! access a stream by id
+  RandomStream & Stream (RndStream_t id) const { return *fStream[id]; }
+
+  //! Position all streams at the start of the given (run, event).
+  //! Call it before generating each event (events are numbered from 0).
+  //! Repeated calls for the current (run, event) leave the streams untouched
+  //! so that re-trying to generate an event does not re-use the same random
+  //! numbers. Until the first call, the streams are at a position reserved
+  //! for the draws made while configuring the job (event kRndPreRunEvent),
+  //! so these do not overlap with the draws of the first event.
+  //! Note: Event-level reproducibility also requires that any state carried
+  //! between events (eg sequential flux ntuple readers, the PYTHIA6 random
+  //! number generator, lazily-built caches) is reproduced too.
+  void     SetEvent (Long_t run, Long64_t event);
 
   long int GetSeed (void)         const { return fCurrSeed; }
   void     SetSeed (long int seed);
@@ -91,9 +119,12 @@ private:
 
   static RandomGen * fInstance;
 
-  TRandom3 * fRandom3;    ///< Mersenne Twistor
-  long int   fCurrSeed;   ///< random number generator seed number
-  bool       fInitalized; ///< done initializing singleton?
+  RandomStream * fStream[kNRndStreams]; ///< random number streams
+  long int       fCurrSeed;             ///< random number generator seed number
+  Long_t         fCurrRun;              ///< current run number
+  Long64_t       fCurrEvent;            ///< current event number
+  bool           fEventKeyed;           ///< were the streams keyed to the current event?
+  bool           fInitalized;           ///< done initializing singleton?
 
   void InitRandomGenerators(long int seed);
 
@@ -0,0 +1,172 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include "Conventions/Controls.h"
+#include "Numerical/RandomStream.h"
+
+using namespace genie;
+using namespace genie::controls;
+
+ClassImp(RandomStream)
+
+// Philox-4x32 multipliers and Weyl sequence key increments
+static const UInt_t kPhiloxM0 = 0xD2511F53;
+static const UInt_t kPhiloxM1 = 0xCD9E8D57;
+static const UInt_t kPhiloxW0 = 0x9E3779B9;
+static const UInt_t kPhiloxW1 = 0xBB67AE85;
+
+// 2^-53
+static const double kTwoPowMinus53 = 1.1102230246251565e-16;
+
+//____________________________________________________________________________
+RandomStream::RandomStream(unsigned int stream_id, UInt_t seed) :
+TRandom(seed),
+fStreamId  (stream_id),
+fSeed      (seed),
+fRun       (0),
+fEvent     (kRndPreRunEvent),
+fNDraws    (0),
+fBlockId   (0),
+fHaveBlock (false)
+{
+  this->SetKey();
+}
+//____________________________________________________________________________
+RandomStream::~RandomStream()
+{
+
+}
+//____________________________________________________________________________
+Double_t RandomStream::Rndm(Int_t)
+{
+// Returns a uniformly distributed number in (0,1).
+// Each philox block (4x32 bits) gives two 53-bit doubles.
+
+  ULong64_t iblock = fNDraws >> 1;
+  int       ihalf  = (int) (fNDraws & 1);
+
+  if(!fHaveBlock || iblock != fBlockId) this->Generate(iblock);
+
+  fNDraws++;
+
+  UInt_t hi = fBlock[2*ihalf  ] >> 5; // 27 bits
+  UInt_t lo = fBlock[2*ihalf+1] >> 6; // 26 bits
+  ULong64_t k = ( ((ULong64_t) hi) << 26 ) | (ULong64_t) lo;
+
+  // never returns exactly 0 or 1
+  return (k + 0.5) * kTwoPowMinus53;
+}
+//____________________________________________________________________________
+void RandomStream::RndmArray(Int_t n, Float_t * array)
+{
+  for(Int_t i = 0; i < n; i++) array[i] = (Float_t) this->Rndm();
+}
+//____________________________________________________________________________
+void RandomStream::RndmArray(Int_t n, Double_t * array)
+{
+  for(Int_t i = 0; i < n; i++) array[i] = this->Rndm();
+}
+//____________________________________________________________________________
+void RandomStream::SetSeed(UInt_t seed)
+{
+// Unlike TRandom3, a 0 seed is a valid key and does not trigger a time-based
+// seed. Setting the seed restarts the stream at the first draw of the current
+// (run, event).
+
+  fSeed = seed;
+  TRandom::SetSeed(seed);
+
+  this->SetKey();
+  fNDraws    = 0;
+  fHaveBlock = false;
+}
+//____________________________________________________________________________
+void RandomStream::SetEvent(Long_t run, Long64_t event)
+{
+// Events are expected to be numbered from 0; event kRndPreRunEvent (-1) is
+// the position used before the first event
+
+  fRun   = run;
+  fEvent = event;
+
+  this->SetKey();
+  fNDraws    = 0;
+  fHaveBlock = false;
+}
+//____________________________________________________________________________
+void RandomStream::Skip(ULong64_t n)
+{
+  fNDraws += n;
+}
+//____________________________________________________________________________
+void RandomStream::SetKey(void)
+{
+// The key holds the seed and the stream id. Only the 28 least significant
+// bits of the run number are used (runs 2^28 apart share random streams).
+
+  fKey[0] = fSeed;
+  fKey[1] = ( ((UInt_t) fRun & 0x0FFFFFFF) << 4 ) | (fStreamId & 0xF);
+}
+//____________________________________________________________________________
+void RandomStream::Generate(ULong64_t iblock)
+{
+  ULong64_t event = (ULong64_t) fEvent;
+
+  UInt_t ctr[4];
+  ctr[0] = (UInt_t) (iblock & 0xFFFFFFFF);
+  ctr[1] = (UInt_t) (iblock >> 32);
+  ctr[2] = (UInt_t) (event  & 0xFFFFFFFF);
+  ctr[3] = (UInt_t) (event  >> 32);
+
+  RandomStream::Philox(ctr, fKey, fBlock);
+
+  fBlockId   = iblock;
+  fHaveBlock = true;
+}
+//____________________________________________________________________________
+void RandomStream::Philox(
+               const UInt_t counter[4], const UInt_t k[2], UInt_t out[4])
+{
+// Philox-4x32 with 10 rounds (checked against the Random123 known-answer
+// vectors by gtestRandomStream)
+
+  UInt_t ctr[4] = { counter[0], counter[1], counter[2], counter[3] };
+  UInt_t key[2] = { k[0], k[1] };
+
+  for(int iround = 0; iround < 10; iround++) {
+    ULong64_t p0 = (ULong64_t) kPhiloxM0 * ctr[0];
+    ULong64_t p1 = (ULong64_t) kPhiloxM1 * ctr[2];
+    UInt_t hi0 = (UInt_t) (p0 >> 32);
+    UInt_t lo0 = (UInt_t) (p0 & 0xFFFFFFFF);
+    UInt_t hi1 = (UInt_t) (p1 >> 32);
+    UInt_t lo1 = (UInt_t) (p1 & 0xFFFFFFFF);
+
+    UInt_t c1 = ctr[1];
+    UInt_t c3 = ctr[3];
+    ctr[0] = hi1 ^ c1 ^ key[0];
+    ctr[1] = lo1;
+    ctr[2] = hi0 ^ c3 ^ key[1];
+    ctr[3] = lo0;
+
+    key[0] += kPhiloxW0;
+    key[1] += kPhiloxW1;
+  }
+
+  out[0] = ctr[0];
+  out[1] = ctr[1];
+  out[2] = ctr[2];
+  out[3] = ctr[3];
+}
+//____________________________________________________________________________
@@ -0,0 +1,87 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::RandomStream
+
+\brief    A counter-based random number generator (Philox-4x32-10, see
+          J.K.Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+          SC11) exposed through the TRandom interface.
+
+          Every random number is a pure function of a key and a counter:
+          The 64-bit key identifies the stream (seed, run number, stream id)
+          while the 128-bit counter identifies the position in the stream
+          (event number, number of draws in the event).
+          Therefore, streams are independent of each other, any position in
+          a stream can be reached directly (skip-ahead is O(1)) and the
+          numbers drawn for a given event do not depend on what happened in
+          previous events.
+          Before the first SetEvent() call, and after SetEvent(run,
+          kRndPreRunEvent), the stream is at a position reserved for the
+          draws made while configuring the job, which is never used by an
+          actual event.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _RANDOM_STREAM_H_
+#define _RANDOM_STREAM_H_
+
+#include <TRandom.h>
+
+namespace genie {
+
+class RandomStream : public TRandom {
+
+public:
+  RandomStream(unsigned int stream_id = 0, UInt_t seed = 65539);
+  virtual ~RandomStream();
+
+  // TRandom interface
+  Double_t Rndm      (Int_t i = 0);
+  void     RndmArray (Int_t n, Float_t  * array);
+  void     RndmArray (Int_t n, Double_t * array);
+  void     SetSeed   (UInt_t seed = 0);
+  UInt_t   GetSeed   (void) const { return fSeed; }
+
+  // Position the stream at the first draw of the given (run, event)
+  void SetEvent (Long_t run, Long64_t event);
+
+  // Skip the next n draws
+  void Skip (ULong64_t n);
+
+  // Philox-4x32-10 block function: out = philox(counter, key)
+  static void Philox (const UInt_t ctr[4], const UInt_t key[2], UInt_t out[4]);
+
+  unsigned int StreamId (void) const { return fStreamId; }
+  Long_t       Run      (void) const { return fRun;      }
+  Long64_t     Event    (void) const { return fEvent;    }
+  ULong64_t    NDraws   (void) const { return fNDraws;   }
+
+private:
+
+  void SetKey   (void);
+  void Generate (ULong64_t iblock);
+
+  unsigned int fStreamId;   ///< stream (subsystem) id
+  UInt_t       fSeed;       ///< seed number
+  Long_t       fRun;        ///< current run number
+  Long64_t     fEvent;      ///< current event number
+  ULong64_t    fNDraws;     ///< number of draws since the start of the current event
+  UInt_t       fKey[2];     ///< philox key: (seed, run & stream id)
+  UInt_t       fBlock[4];   ///< philox output for counter: (block lo, block hi, event lo, event hi)
+  ULong64_t    fBlockId;    ///< block index of the cached philox output
+  bool         fHaveBlock;  ///< is the cached philox output valid?
+
+ClassDef(RandomStream,1)
+};
+
+}      // genie namespace
+
+#endif // _RANDOM_STREAM_H_
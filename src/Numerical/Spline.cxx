@@ -23,17 +23,37 @@
    interpolate quantities other than cross sections. Default is `false';
  @ Aug 25, 2009 - CA
    Adapt code to use the new utils::xml namespace.
+ @ Oct 17, 2026 - agent
+   Evaluate() no longer goes through TSpline3::Eval() and the closest-knot
+   searches: The spline coefficients are copied into flat arrays at build
+   time and the treatment of intervals next to zero-valued knots is decided
+   once. Knot look-ups are O(1) for uniform or log-uniform knot grids.
+   Added Evaluate(const double *, double *, int) for evaluating the spline
+   at many points. Fixed the linear interpolation in intervals whose right
+   knot is zero (it was interpolating towards the left knot value).
+   FindClosestKnot() parses its option without building a string, as it is
+   called for every interaction in every interaction selection.
+ @ Oct 17, 2026 - agent
+   Added a custom Streamer() that rebuilds the (non-persistent) flat tables
+   when a Spline is read back from a ROOT file, eg from a cache file.
+   GetKnot() and GetKnotY() return the input knot values again, rather
+   than the zero-rounded values of the evaluation tables.
+ @ Oct 17, 2026 - agent
+   Added EvaluateNonZeroInterval(), returning 0 in intervals starting at a
+   zero-valued knot with a single knot look-up.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstring>
 #include <iomanip>
 #include <cfloat>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
 
+#include <TBuffer.h>
 #include <TFile.h>
 #include <TNtupleD.h>
 #include <TTree.h>
@@ -346,7 +366,8 @@ void Spline::GetKnot(int iknot, double & x, double & y) const
      LOG("Spline", pWARN) << "Spline has not been built yet!";
      return;
   }
-  fInterpolator->GetKnot(iknot,x,y);
+  x = fKnotX[iknot];
+  y = fKnotY[iknot];
 }
 //___________________________________________________________________________
 double Spline::GetKnotX(int iknot) const
@@ -355,9 +376,7 @@ double Spline::GetKnotX(int iknot) const
      LOG("Spline", pWARN) << "Spline has not been built yet!";
      return 0;
   }
-  double x,y;
-  fInterpolator->GetKnot(iknot,x,y);
-  return x;
+  return fKnotX[iknot];
 }
 //___________________________________________________________________________
 double Spline::GetKnotY(int iknot) const
@@ -366,9 +385,7 @@ double Spline::GetKnotY(int iknot) const
      LOG("Spline", pWARN) << "Spline has not been built yet!";
      return 0;
   }
-  double x,y;
-  fInterpolator->GetKnot(iknot,x,y);
-  return y;
+  return fKnotY[iknot];
 }
 //___________________________________________________________________________
 bool Spline::IsWithinValidRange(double x) const
@@ -379,42 +396,13 @@ bool Spline::IsWithinValidRange(double x) const
 //___________________________________________________________________________
 double Spline::Evaluate(double x) const
 {
-  LOG("Spline", pDEBUG) << "Evaluating spline at point x = " << x;
   assert(!TMath::IsNaN(x));
 
   double y = 0;
-  if( this->IsWithinValidRange(x) ) {
-
-    // we can interpolate within the range of spline knots - be careful with
-    // strange cubic spline behaviour when close to knots with y=0
-    bool is0p = this->ClosestKnotValueIsZero(x, "+");
-    bool is0n = this->ClosestKnotValueIsZero(x, "-");
-
-    if(!is0p && !is0n) {
-      // both knots (on the left and right are non-zero) - just interpolate
-      LOG("Spline", pDEBUG) << "Point is between non-zero knots";
-      y = fInterpolator->Eval(x);
-    } else {
-      // at least one of the neighboring knots has y=0
-      if(is0p && is0n) {
-        // both neighboring knots have y=0
-        LOG("Spline", pDEBUG) << "Point is between zero knots";
-        y=0;
-      } else {
-        // just 1 neighboring knot has y=0 - do a linear interpolation
-        LOG("Spline", pDEBUG) 
-          << "Point has zero" << (is0n ? " left " : " right ") << "knot";
-        double xpknot=0, ypknot=0, xnknot=0, ynknot=0;
-        this->FindClosestKnot(x, xnknot, ynknot, "-");
-        this->FindClosestKnot(x, xpknot, ypknot, "+");
-        if(is0n) y = ypknot * (x-xnknot)/(xpknot-xnknot);
-        else     y = ynknot * (x-xnknot)/(xpknot-xnknot);
-      }
-    }
-
-  } else {
-    LOG("Spline", pDEBUG) << "x = " << x
-     << " is not within spline range [" << fXMin << ", " << fXMax << "]";
+  if( this->IsWithinValidRange(x) && fNKnots > 0 ) {
+    int    i  = this->FindKnot(x);
+    double dx = x - fKnotX[i];
+    y = fCoeffA[i] + dx*(fCoeffB[i] + dx*(fCoeffC[i] + dx*fCoeffD[i]));
   }
 
   if(y<0 && !fYCanBeNegative) {
@@ -423,11 +411,100 @@ double Spline::Evaluate(double x) const
     LOG("Spline", pINFO) << "spline range [" << fXMin << ", " << fXMax << "]";
   }
 
-  LOG("Spline", pDEBUG) << "Spline(x = " << x << ") = " << y;
+  return y;
+}
+//___________________________________________________________________________
+double Spline::EvaluateNonZeroInterval(double x) const
+{
+// Same as 'ClosestKnotValueIsZero(x,"-") ? 0 : Evaluate(x)', as used for
+// cross section splines which are zero below threshold, but with a single
+// knot look-up: The intervals starting at a zero-valued knot are those with
+// a zero 0th order coefficient (see BuildTables()). The only difference is
+// exactly at a knot following a zero-valued one, where the knot value is
+// returned.
+
+  assert(!TMath::IsNaN(x));
+
+  if( !this->IsWithinValidRange(x) || fNKnots <= 0 ) return 0.;
+
+  int i = this->FindKnot(x);
+  if(fCoeffA[i] == 0.) return 0.;
+
+  double dx = x - fKnotX[i];
+  double y  = fCoeffA[i] + dx*(fCoeffB[i] + dx*(fCoeffC[i] + dx*fCoeffD[i]));
+
+  if(y<0 && !fYCanBeNegative) {
+    LOG("Spline", pINFO) << "Negative y (" << y << ")";
+    LOG("Spline", pINFO) << "x = " << x;
+    LOG("Spline", pINFO) << "spline range [" << fXMin << ", " << fXMax << "]";
+  }
 
   return y;
 }
 //___________________________________________________________________________
+void Spline::Evaluate(const double * x, double * y, int n) const
+{
+// Evaluate the spline at the n input points (y[i] = Evaluate(x[i]))
+
+  const double * kx = (fNKnots > 0) ? &fKnotX [0] : 0;
+  const double * ca = (fNKnots > 0) ? &fCoeffA[0] : 0;
+  const double * cb = (fNKnots > 0) ? &fCoeffB[0] : 0;
+  const double * cc = (fNKnots > 0) ? &fCoeffC[0] : 0;
+  const double * cd = (fNKnots > 0) ? &fCoeffD[0] : 0;
+
+  for(int j = 0; j < n; j++) {
+    double xj = x[j];
+    assert(!TMath::IsNaN(xj));
+
+    double yj = 0;
+    if( fXMin <= xj && xj <= fXMax && fNKnots > 0 ) {
+      int    i  = this->FindKnot(xj);
+      double dx = xj - kx[i];
+      yj = ca[i] + dx*(cb[i] + dx*(cc[i] + dx*cd[i]));
+    }
+    y[j] = yj;
+
+    if(yj<0 && !fYCanBeNegative) {
+      LOG("Spline", pINFO) << "Negative y (" << yj << ")";
+      LOG("Spline", pINFO) << "x = " << xj;
+      LOG("Spline", pINFO) << "spline range [" << fXMin << ", " << fXMax << "]";
+    }
+  }
+}
+//___________________________________________________________________________
+int Spline::FindKnot(double x) const
+{
+// Returns i so that fKnotX[i] <= x < fKnotX[i+1], or the last knot if x is
+// at the upper end of the spline range. Spline knots are therefore always
+// evaluated at dx=0 and give exactly the knot value.
+// The input is expected to be within the spline range.
+
+  int ilast = fNKnots-1;
+  if(ilast <= 0 || x >= fKnotX[ilast]) return ilast;
+
+  int i = 0;
+  if(fGrid == 0) {
+    // arbitrary knots: binary search
+    int ihigh = ilast;
+    while(ihigh-i > 1) {
+      int ihalf = (i+ihigh)/2;
+      if(x >= fKnotX[ihalf]) i     = ihalf;
+      else                   ihigh = ihalf;
+    }
+    return i;
+  }
+
+  // (approximately) uniform or log-uniform knots: guess & correct
+  double u = (fGrid == 2) ? TMath::Log(x) : x;
+  i = (int) ((u - fGridU0) * fGridInvDU);
+  if(i < 0)     i = 0;
+  if(i > ilast) i = ilast;
+  while(i > 0     && x <  fKnotX[i]  ) i--;
+  while(i < ilast && x >= fKnotX[i+1]) i++;
+
+  return i;
+}
+//___________________________________________________________________________
 void Spline::SaveAsXml(
                 string filename, string xtag, string ytag, string name) const
 {
@@ -550,10 +627,8 @@ TGraph * Spline::GetAsTGraph(
 void Spline::FindClosestKnot(
               double x, double & xknot, double & yknot, Option_t * opt) const
 {
-  string option(opt);
-
-  bool pos = (option.find("+") != string::npos);
-  bool neg = (option.find("-") != string::npos);
+  bool pos = (opt && strchr(opt,'+') != 0);
+  bool neg = (opt && strchr(opt,'-') != 0);
 
   if(!pos && !neg) return;
 
@@ -745,10 +820,22 @@ void Spline::InitSpline(void)
   fXMax = 0.0;
   fYMax = 0.0;
 
+  fNKnots = 0;
+
   fInterpolator = 0;
 
   fYCanBeNegative = false;
 
+  fKnotX .clear();
+  fKnotY .clear();
+  fCoeffA.clear();
+  fCoeffB.clear();
+  fCoeffC.clear();
+  fCoeffD.clear();
+  fGrid      = 0;
+  fGridU0    = 0.;
+  fGridInvDU = 0.;
+
   LOG("Spline", pDEBUG) << "...done initializing spline";
 }
 //___________________________________________________________________________
@@ -774,6 +861,98 @@ void Spline::BuildSpline(int nentries, double x[], double y[])
 
   fInterpolator = new TSpline3("spl3", x, y, nentries, "0");
 
+  this->BuildTables();
+
   LOG("Spline", pDEBUG) << "...done building spline";
 }
 //___________________________________________________________________________
+void Spline::BuildTables(void)
+{
+// Copy the TSpline3 knots & coefficients into flat arrays.
+// In intervals with a zero-valued knot the cubic spline can behave strangely
+// so the interpolation there is linear (or y=0 if both knots are zero).
+// The knot values are kept as input in fKnotY (returned by GetKnot()) while
+// the evaluation uses the possibly zero-rounded values in fCoeffA.
+
+  int n = (fInterpolator) ? fNKnots : 0;
+
+  fKnotX .assign(n, 0.);
+  fKnotY .assign(n, 0.);
+  fCoeffA.assign(n, 0.);
+  fCoeffB.assign(n, 0.);
+  fCoeffC.assign(n, 0.);
+  fCoeffD.assign(n, 0.);
+
+  for(int i = 0; i < n; i++) {
+    double x=0, y=0, b=0, c=0, d=0;
+    fInterpolator->GetCoeff(i, x, y, b, c, d);
+    fKnotX [i] = x;
+    fKnotY [i] = y;
+    fCoeffA[i] = y;
+    fCoeffB[i] = b;
+    fCoeffC[i] = c;
+    fCoeffD[i] = d;
+  }
+
+  for(int i = 0; i < n-1; i++) {
+    bool is0n = utils::math::AreEqual(fKnotY[i],  0.);
+    bool is0p = utils::math::AreEqual(fKnotY[i+1],0.);
+    if(!is0n && !is0p) continue;
+
+    double dx = fKnotX[i+1] - fKnotX[i];
+    double y0 = (is0n) ? 0. : fKnotY[i];
+    double y1 = (is0p) ? 0. : fKnotY[i+1];
+    fCoeffA[i] = y0;
+    fCoeffB[i] = (dx > 0) ? (y1-y0)/dx : 0.;
+    fCoeffC[i] = 0.;
+    fCoeffD[i] = 0.;
+  }
+  // the last knot is only used for evaluating the spline at its upper end
+  if(n > 0) {
+    if(utils::math::AreEqual(fKnotY[n-1],0.)) fCoeffA[n-1] = 0.;
+    fCoeffB[n-1] = 0.;
+    fCoeffC[n-1] = 0.;
+    fCoeffD[n-1] = 0.;
+  }
+
+  // check whether the knots are (approximately) uniformly spaced in x or
+  // log(x) so that knots can be found without a binary search
+  fGrid      = 0;
+  fGridU0    = 0.;
+  fGridInvDU = 0.;
+  if(n < 3) return;
+
+  for(int grid = 1; grid <= 2; grid++) {
+    bool inlog = (grid == 2);
+    if(inlog && fKnotX[0] <= 0) break;
+    double u0 = (inlog) ? TMath::Log(fKnotX[0])   : fKnotX[0];
+    double u1 = (inlog) ? TMath::Log(fKnotX[n-1]) : fKnotX[n-1];
+    double du = (u1-u0)/(n-1);
+    if(du <= 0) break;
+    bool uniform = true;
+    for(int i = 1; i < n && uniform; i++) {
+      double ui = (inlog) ? TMath::Log(fKnotX[i]) : fKnotX[i];
+      uniform = (TMath::Abs(ui - (u0+i*du)) < 0.5*du);
+    }
+    if(uniform) {
+      fGrid      = grid;
+      fGridU0    = u0;
+      fGridInvDU = 1./du;
+      return;
+    }
+  }
+}
+//___________________________________________________________________________
+void Spline::Streamer(TBuffer & R__b)
+{
+// Only the knots (the TSpline3) and the spline range are persistent: the
+// flat evaluation tables are rebuilt after reading
+
+  if(R__b.IsReading()) {
+    R__b.ReadClassBuffer(Spline::Class(), this);
+    this->BuildTables();
+  } else {
+    R__b.WriteClassBuffer(Spline::Class(), this);
+  }
+}
+//___________________________________________________________________________
@@ -5,9 +5,16 @@
 
 \brief    A numeric analysis tool class for interpolating 1-D functions.
 
-          Uses ROOT's TSpline3 for the actual interpolation and can retrieve
-          function (x,y(x)) pairs from an XML file, a flat ascii file, a
-          TNtuple, a TTree or an SQL database.
+          Uses ROOT's TSpline3 for building the interpolating cubic spline
+          and can retrieve function (x,y(x)) pairs from an XML file, a flat
+          ascii file, a TNtuple, a TTree or an SQL database.
+          At build time, the TSpline3 coefficients are copied into flat
+          arrays (one array per coefficient) and the treatment of intervals
+          next to zero-valued knots is decided once, so that Evaluate() is
+          a knot look-up followed by a polynomial evaluation. Knot look-ups
+          are O(1) for uniform or log-uniform knot grids.
+          The flat arrays are not persistent: They are rebuilt when a Spline
+          is read back from a ROOT file (see Streamer()).
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
@@ -21,6 +28,7 @@
 #define _SPLINE_H_
 
 #include <string>
+#include <vector>
 #include <fstream>
 #include <ostream>
 
@@ -35,6 +43,7 @@ class TGraph;
 using std::string;
 using std::ostream;
 using std::ofstream;
+using std::vector;
 
 namespace genie {
 
@@ -70,6 +79,8 @@ public:
   double XMax               (void) const {return fXMax;  }
   double YMax               (void) const {return fYMax;  }
   double Evaluate           (double x) const;
+  void   Evaluate           (const double * x, double * y, int n) const;
+  double EvaluateNonZeroInterval (double x) const; ///< 0 in intervals starting at a zero knot
   bool   IsWithinValidRange (double x) const;
 
   void   SetName (string name) { fName = name; }
@@ -113,6 +124,8 @@ private:
   void InitSpline  (void);
   void ResetSpline (void);
   void BuildSpline (int nentries, double x[], double y[]);
+  void BuildTables (void);
+  int  FindKnot    (double x) const;
 
   //-- private data members
   string     fName;
@@ -123,7 +136,20 @@ private:
   TSpline3 * fInterpolator;
   bool       fYCanBeNegative;
 
-ClassDef(Spline,1)
+  //-- flat interpolation tables, built from fInterpolator
+  //   in interval i (x between fKnotX[i] and fKnotX[i+1]), with dx = x-fKnotX[i]:
+  //   y = fCoeffA[i] + dx*(fCoeffB[i] + dx*(fCoeffC[i] + dx*fCoeffD[i]))
+  vector<double> fKnotX;   //! knot x
+  vector<double> fKnotY;   //! knot y (as input)
+  vector<double> fCoeffA;  //! 0th order coefficient for each interval
+  vector<double> fCoeffB;  //! 1st order coefficient for each interval
+  vector<double> fCoeffC;  //! 2nd order coefficient for each interval
+  vector<double> fCoeffD;  //! 3rd order coefficient for each interval
+  int            fGrid;    //! knot grid type (0: arbitrary, 1: uniform, 2: log-uniform)
+  double         fGridU0;  //! x (or log(x)) at the first knot, for uniform grids
+  double         fGridInvDU; //! 1 / (x (or log(x)) knot spacing), for uniform grids
+
+ClassDef(Spline,2)
 };
 
 }
@@ -9,5 +9,6 @@
 #pragma link C++ class genie::PDF;
 #pragma link C++ class genie::PDFModelI;
 #pragma link C++ class genie::PDFLIB;
+#pragma link C++ class genie::PDFGrid;
 
 #endif
@@ -0,0 +1,486 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cassert>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#include <TSystem.h>
+#include <TMath.h>
+
+#include "Messenger/Messenger.h"
+#include "PDF/PDFGrid.h"
+#include "Utils/StringUtils.h"
+
+using std::ifstream;
+using std::ofstream;
+using std::istringstream;
+using std::setprecision;
+using std::scientific;
+using std::endl;
+using std::upper_bound;
+
+using namespace genie;
+
+//____________________________________________________________________________
+// Cubic Hermite interpolation at k in the knot interval [k[1], k[2]] of the
+// values y[1], y[2]. As in LHAPDF, the derivatives at the interval ends are
+// the averages of the slopes of the adjacent intervals, or the slope of the
+// interval itself at the edges of the grid (lo / hi: k[0] / k[3] exist)
+static double Hermite(
+      const double * k, const double * y, bool lo, bool hi, double kk)
+{
+  double dk  = k[2] - k[1];
+  double s   = (y[2] - y[1]) / dk;
+  double d1  = (lo) ? 0.5 * ( (y[1] - y[0]) / (k[1] - k[0]) + s ) : s;
+  double d2  = (hi) ? 0.5 * ( s + (y[3] - y[2]) / (k[3] - k[2]) ) : s;
+  double t   = (kk - k[1]) / dk;
+  double t2  = t*t;
+  double t3  = t2*t;
+  return (2*t3 - 3*t2 + 1) * y[1] + (t3 - 2*t2 + t) * dk * d1 +
+         (3*t2 - 2*t3)     * y[2] + (t3 - t2)       * dk * d2;
+}
+//____________________________________________________________________________
+// Index of the knot interval [knots[i], knots[i+1]] including k
+static int Interval(const vector<double> & knots, double k)
+{
+  int n = knots.size();
+  int i = upper_bound(knots.begin(), knots.end(), k) - knots.begin() - 1;
+  return TMath::Min(TMath::Max(i, 0), n - 2);
+}
+//____________________________________________________________________________
+PDFGrid::PDFGrid() :
+PDFModelI("genie::PDFGrid")
+{
+  fPDFModel = 0;
+}
+//____________________________________________________________________________
+PDFGrid::PDFGrid(string config) :
+PDFModelI("genie::PDFGrid", config)
+{
+  fPDFModel = 0;
+}
+//____________________________________________________________________________
+PDFGrid::~PDFGrid()
+{
+
+}
+//____________________________________________________________________________
+double PDFGrid::UpValence(double x, double q2) const
+{
+  return AllPDFs(x,q2).uval;
+}
+//____________________________________________________________________________
+double PDFGrid::DownValence(double x, double q2) const
+{
+  return AllPDFs(x,q2).dval;
+}
+//____________________________________________________________________________
+double PDFGrid::UpSea(double x, double q2) const
+{
+  return AllPDFs(x,q2).usea;
+}
+//____________________________________________________________________________
+double PDFGrid::DownSea(double x, double q2) const
+{
+  return AllPDFs(x,q2).dsea;
+}
+//____________________________________________________________________________
+double PDFGrid::Strange(double x, double q2) const
+{
+  return AllPDFs(x,q2).str;
+}
+//____________________________________________________________________________
+double PDFGrid::Charm(double x, double q2) const
+{
+  return AllPDFs(x,q2).chm;
+}
+//____________________________________________________________________________
+double PDFGrid::Bottom(double x, double q2) const
+{
+  return AllPDFs(x,q2).bot;
+}
+//____________________________________________________________________________
+double PDFGrid::Top(double x, double q2) const
+{
+  return AllPDFs(x,q2).top;
+}
+//____________________________________________________________________________
+double PDFGrid::Gluon(double x, double q2) const
+{
+  return AllPDFs(x,q2).gl;
+}
+//____________________________________________________________________________
+PDF_t PDFGrid::AllPDFs(double x, double q2) const
+{
+  PDF_t pdf;
+  this->Interpolate(x, q2, pdf);
+  return pdf;
+}
+//____________________________________________________________________________
+void PDFGrid::AllPDFs(
+    int n, const double * x, const double * q2, PDF_t * pdfs) const
+{
+  for(int i = 0; i < n; i++) {
+    this->Interpolate(x[i], q2[i], pdfs[i]);
+  }
+}
+//____________________________________________________________________________
+void PDFGrid::Interpolate(double x, double q2, PDF_t & pdf) const
+{
+// Only local variables are used here, so that concurrent calls are safe
+
+  double xfx[9] = { 0., 0., 0., 0., 0., 0., 0., 0., 0. };
+
+  int ns = fXfx.size();
+  if(ns > 0 && x > 0 && x <= 1) {
+
+    // find the Q2 subgrid and freeze x, Q2 at the grid edges
+    double aq2 = TMath::Abs(q2);
+    double lq2 = (aq2 > 0) ? TMath::Log(aq2) : fLogQ2[0].front();
+    int is = 0;
+    while(is < ns-1 && lq2 > fLogQ2[is].back()) is++;
+
+    const vector<double> & lxk = fLogX [is];
+    const vector<double> & lqk = fLogQ2[is];
+    const double *         val = &(fXfx[is][0]);
+
+    int nx = lxk.size();
+    int nq = lqk.size();
+
+    double lx = TMath::Min(TMath::Max(TMath::Log(x), lxk.front()), lxk.back());
+    lq2       = TMath::Min(TMath::Max(lq2,           lqk.front()), lqk.back());
+
+    int  ix  = Interval(lxk, lx);
+    int  iq  = Interval(lqk, lq2);
+    bool xlo = (ix > 0);
+    bool xhi = (ix < nx-2);
+    bool qlo = (iq > 0);
+    bool qhi = (iq < nq-2);
+
+    int    jx[4], jq[4];
+    double kx[4], kq[4];
+    for(int a = 0; a < 4; a++) {
+      jx[a] = TMath::Min(TMath::Max(ix - 1 + a, 0), nx - 1);
+      jq[a] = TMath::Min(TMath::Max(iq - 1 + a, 0), nq - 1);
+      kx[a] = lxk[jx[a]];
+      kq[a] = lqk[jq[a]];
+    }
+
+    // interpolate in log(x) at the 4 log(Q2) knots, then in log(Q2)
+    double y[4], yq[4][9];
+    for(int b = 0; b < 4; b++) {
+      for(int f = 0; f < 9; f++) {
+        for(int a = 0; a < 4; a++) y[a] = val[9*(jx[a]*nq + jq[b]) + f];
+        yq[b][f] = Hermite(kx, y, xlo, xhi, lx);
+      }
+    }
+    for(int f = 0; f < 9; f++) {
+      for(int b = 0; b < 4; b++) y[b] = yq[b][f];
+      xfx[f] = Hermite(kq, y, qlo, qhi, lq2);
+    }
+  }
+
+  pdf.uval = xfx[0];
+  pdf.dval = xfx[1];
+  pdf.usea = xfx[2];
+  pdf.dsea = xfx[3];
+  pdf.str  = xfx[4];
+  pdf.chm  = xfx[5];
+  pdf.bot  = xfx[6];
+  pdf.top  = xfx[7];
+  pdf.gl   = xfx[8];
+}
+//____________________________________________________________________________
+bool PDFGrid::ReadGrid(string filename)
+{
+// Read a LHAPDF6 data file (lhagrid1 format). After the header, each subgrid
+// is given by a line of x knots, a line of Q knots, a line of parton ids
+// and then the x*f(x,Q) values of all partons, one line per (x,Q) knot with
+// Q running faster. Subgrids end with a `---' line.
+
+  ifstream in(filename.c_str());
+  if(!in.good()) return false;
+
+  LOG("PDF", pNOTICE) << "Reading the PDF grid from " << filename;
+
+  // skip the header
+  string line;
+  bool header = true;
+  while(header && getline(in, line)) {
+    header = (utils::str::TrimSpaces(line) != "---");
+  }
+
+  while(!header && getline(in, line)) {
+
+    if(utils::str::TrimSpaces(line).size() == 0) continue;
+
+    // knots and parton ids
+    vector<double> xk, qk;
+    vector<int>    ids;
+    double v   = 0;
+    int    pid = 0;
+    istringstream xline(line);
+    while(xline >> v) xk.push_back(v);
+    if(getline(in, line)) {
+      istringstream qline(line);
+      while(qline >> v) qk.push_back(v);
+    }
+    if(getline(in, line)) {
+      istringstream pline(line);
+      while(pline >> pid) ids.push_back(pid);
+    }
+    int nx = xk.size();
+    int nq = qk.size();
+    int np = ids.size();
+    bool ok = (nx > 1 && nq > 1 && np > 0 && xk[0] > 0 && qk[0] > 0);
+    for(int i = 1; ok && i < nx; i++) ok = (xk[i] > xk[i-1]);
+    for(int i = 1; ok && i < nq; i++) ok = (qk[i] > qk[i-1]);
+    if(!ok) {
+      LOG("PDF", pERROR)
+        << "Invalid knots / parton ids in subgrid " << fXfx.size();
+      return false;
+    }
+
+    // column of each parton in the -6...6 range (gluon: 0 or 21)
+    int col[13];
+    for(int i = 0; i < 13; i++) col[i] = -1;
+    for(int i = 0; i < np; i++) {
+      int id = (ids[i] == 21) ? 0 : ids[i];
+      if(TMath::Abs(id) <= 6) col[id+6] = i;
+    }
+
+    vector<double> lxk(nx), lqk(nq);
+    for(int i = 0; i < nx; i++) lxk[i] = TMath::Log(xk[i]);
+    for(int i = 0; i < nq; i++) lqk[i] = 2*TMath::Log(qk[i]);
+
+    vector<double> xfx(9*nx*nq, 0.);
+    vector<double> xfp(np, 0.);
+    double xf[13];
+    for(int i = 0; i < nx*nq; i++) {
+      for(int k = 0; k < np; k++) in >> xfp[k];
+      if(in.fail()) {
+        LOG("PDF", pERROR)
+          << "Missing x*f(x,Q) values in subgrid " << fXfx.size();
+        return false;
+      }
+      for(int k = 0; k < 13; k++) xf[k] = (col[k] < 0) ? 0. : xfp[col[k]];
+      double * node = &xfx[9*i];
+      node[0] = xf[ 2+6] - xf[-2+6];   // u - ubar
+      node[1] = xf[ 1+6] - xf[-1+6];   // d - dbar
+      node[2] = xf[-2+6];              // ubar
+      node[3] = xf[-1+6];              // dbar
+      node[4] = xf[ 3+6];              // s
+      node[5] = xf[ 4+6];              // c
+      node[6] = xf[ 5+6];              // b
+      node[7] = xf[ 6+6];              // t
+      node[8] = xf[ 0+6];              // g
+    }
+    getline(in, line); // rest of the last line
+    header = true;
+    while(header && getline(in, line)) {
+      header = (utils::str::TrimSpaces(line) != "---");
+    }
+    if(header) {
+      LOG("PDF", pERROR) << "Subgrid " << fXfx.size() << " is not terminated";
+      return false;
+    }
+    header = false;
+
+    fLogX .push_back(lxk);
+    fLogQ2.push_back(lqk);
+    fXfx  .push_back(xfx);
+  }
+
+  if(fXfx.size() == 0) {
+    LOG("PDF", pERROR) << "No PDF grid found in " << filename;
+    return false;
+  }
+
+  LOG("PDF", pNOTICE) << "Read " << fXfx.size() << " PDF subgrid(s)";
+  return true;
+}
+//____________________________________________________________________________
+void PDFGrid::WriteGrid(string filename) const
+{
+// Write the tabulated grid as a single-subgrid LHAPDF6 data file
+
+  ofstream out(filename.c_str());
+  if(!out.good()) {
+    LOG("PDF", pWARN) << "Can not write the PDF grid in " << filename;
+    return;
+  }
+
+  const vector<double> & lxk = fLogX [0];
+  const vector<double> & lqk = fLogQ2[0];
+  const vector<double> & xfx = fXfx  [0];
+  int nx = lxk.size();
+  int nq = lqk.size();
+
+  out << "# x*f(x,Q) tabulated by genie::PDFGrid from "
+      << fPDFModel->Id().Key() << endl;
+  out << "PdfType: central" << endl;
+  out << "Format: lhagrid1" << endl;
+  out << "---" << endl;
+  out << scientific << setprecision(10);
+  for(int i = 0; i < nx; i++) {
+    out << (i>0 ? " " : "") << TMath::Exp(lxk[i]);
+  }
+  out << endl;
+  for(int i = 0; i < nq; i++) {
+    out << (i>0 ? " " : "") << TMath::Exp(0.5*lqk[i]);
+  }
+  out << endl;
+  out << "-6 -5 -4 -3 -2 -1 1 2 3 4 5 6 21" << endl;
+  for(int i = 0; i < nx*nq; i++) {
+    const double * node = &xfx[9*i];
+    out << node[7] << " "               // tbar
+        << node[6] << " "               // bbar
+        << node[5] << " "               // cbar
+        << node[4] << " "               // sbar
+        << node[2] << " "               // ubar
+        << node[3] << " "               // dbar
+        << node[1] + node[3] << " "     // d
+        << node[0] + node[2] << " "     // u
+        << node[4] << " "               // s
+        << node[5] << " "               // c
+        << node[6] << " "               // b
+        << node[7] << " "               // t
+        << node[8] << endl;             // g
+  }
+  out << "---" << endl;
+  out.close();
+
+  LOG("PDF", pNOTICE) << "Saved the PDF grid in " << filename;
+}
+//____________________________________________________________________________
+void PDFGrid::BuildGrid(void)
+{
+// Tabulate the `PDF-Set' model on log10(x) knots up to x = 0.1, then on
+// linear x knots up to x = 1 (where all PDFs vanish), and log10(Q2) knots
+
+  LOG("PDF", pNOTICE)
+    << "Tabulating " << fPDFModel->Id().Key() << " on a "
+    << fNLogX + fNLinX << " x " << fNLogQ2 << " (x,Q2) grid";
+
+  int nx = fNLogX + fNLinX;
+  int nq = fNLogQ2;
+
+  vector<double> lxk(nx), lqk(nq);
+  double dlx = (-1. - fLogXmin) / fNLogX;
+  double dx  = 0.9 / (fNLinX - 1);
+  for(int i = 0; i < fNLogX; i++) {
+    lxk[i] = TMath::Log(TMath::Power(10., fLogXmin + i*dlx));
+  }
+  for(int i = 0; i < fNLinX; i++) {
+    lxk[fNLogX+i] = TMath::Log(0.1 + i*dx);
+  }
+  lxk[nx-1] = 0.;
+  double dlq = (fLogQ2max - fLogQ2min) / (nq - 1);
+  for(int i = 0; i < nq; i++) {
+    lqk[i] = TMath::Log(TMath::Power(10., fLogQ2min + i*dlq));
+  }
+
+  vector<double> xfx(9*nx*nq, 0.);
+  for(int ix = 0; ix < nx-1; ix++) {
+    double x = TMath::Exp(lxk[ix]);
+    for(int iq = 0; iq < nq; iq++) {
+      double q2 = TMath::Exp(lqk[iq]);
+      PDF_t pdf = fPDFModel->AllPDFs(x, q2);
+      double * node = &xfx[9*(ix*nq + iq)];
+      node[0] = pdf.uval;
+      node[1] = pdf.dval;
+      node[2] = pdf.usea;
+      node[3] = pdf.dsea;
+      node[4] = pdf.str;
+      node[5] = pdf.chm;
+      node[6] = pdf.bot;
+      node[7] = pdf.top;
+      node[8] = pdf.gl;
+    }
+  }
+
+  fLogX .push_back(lxk);
+  fLogQ2.push_back(lqk);
+  fXfx  .push_back(xfx);
+}
+//____________________________________________________________________________
+void PDFGrid::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void PDFGrid::Configure(string config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void PDFGrid::LoadConfig(void)
+{
+  fPDFModel = 0;
+  if(fConfig->Exists("PDF-Set")) {
+    fPDFModel = dynamic_cast<const PDFModelI *> (this->SubAlg("PDF-Set"));
+    assert(fPDFModel);
+  }
+
+  fNLogX     = fConfig->GetIntDef    ("Grid-NLogX",      100);
+  fLogXmin   = fConfig->GetDoubleDef ("Grid-LogXmin",   -6.0);
+  fNLinX     = fConfig->GetIntDef    ("Grid-NLinX",       91);
+  fNLogQ2    = fConfig->GetIntDef    ("Grid-NLogQ2",     121);
+  fLogQ2min  = fConfig->GetDoubleDef ("Grid-LogQ2min",  -1.0);
+  fLogQ2max  = fConfig->GetDoubleDef ("Grid-LogQ2max",   5.0);
+  fGridFile  = fConfig->GetStringDef ("GridFile",         "");
+
+  assert(fNLogX > 0 && fNLinX > 1 && fNLogQ2 > 1);
+  assert(fLogXmin < -1 && fLogQ2max > fLogQ2min);
+
+  // environment variables in the grid file name
+  if(fGridFile.size() > 0) {
+    fGridFile = gSystem->ExpandPathName(fGridFile.c_str());
+  }
+
+  fLogX .clear();
+  fLogQ2.clear();
+  fXfx  .clear();
+
+  // read the grid file if it exists, otherwise tabulate the `PDF-Set' model
+  // (and save the grid if a grid file was specified)
+  bool exists =
+    (fGridFile.size() > 0 && !gSystem->AccessPathName(fGridFile.c_str()));
+  if(exists) {
+    if(!this->ReadGrid(fGridFile)) {
+      LOG("PDF", pFATAL) << "Could not read the PDF grid in " << fGridFile;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+  else {
+    if(!fPDFModel) {
+      LOG("PDF", pFATAL)
+        << "No PDF grid file and no PDF-Set to tabulate in the PDFGrid "
+        << "configuration: " << *fConfig;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    this->BuildGrid();
+    if(fGridFile.size() > 0) this->WriteGrid(fGridFile);
+  }
+}
+//____________________________________________________________________________
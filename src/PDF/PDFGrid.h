@@ -0,0 +1,102 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::PDFGrid
+
+\brief    Parton density functions interpolated from a grid held in memory.
+          Concrete implementation of the PDFModelI interface.
+
+          The grid is read from a LHAPDF6 data file (`lhagrid1' format: x
+          knots, Q knots, parton ids and x*f(x,Q) values, in one or more
+          Q subgrids), or it is tabulated once from any other PDFModelI
+          (eg the PDFLIB/LHAPDF interface) set as the `PDF-Set' sub-algorithm.
+          In the later case the tabulated grid can be written out in the
+          same format (`GridFile') and read back in subsequent jobs.
+
+          All flavours are obtained with a single bicubic interpolation in
+          log(x) and log(Q^2), using the same scheme as LHAPDF (cubic Hermite
+          polynomials with derivatives from the neighbouring knots). Outside
+          the grid the PDFs are frozen at the grid edges (as with
+          LHAPDF::extrapolate(false)).
+          The grid is not modified after configuration so, unlike PDFLIB,
+          the PDF evaluation methods are thread-safe and reentrant.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PDF_GRID_H_
+#define _PDF_GRID_H_
+
+#include <vector>
+#include <string>
+
+#include "PDF/PDFModelI.h"
+
+using std::vector;
+using std::string;
+
+namespace genie {
+
+class PDFGrid : public PDFModelI {
+
+public:
+
+  PDFGrid();
+  PDFGrid(string config);
+  virtual ~PDFGrid();
+
+  //-- impement PDFModelI interface
+
+  double UpValence   (double x, double q2) const;
+  double DownValence (double x, double q2) const;
+  double UpSea       (double x, double q2) const;
+  double DownSea     (double x, double q2) const;
+  double Strange     (double x, double q2) const;
+  double Charm       (double x, double q2) const;
+  double Bottom      (double x, double q2) const;
+  double Top         (double x, double q2) const;
+  double Gluon       (double x, double q2) const;
+  PDF_t  AllPDFs     (double x, double q2) const;
+  void   AllPDFs     (int n, const double * x, const double * q2, PDF_t * pdfs) const;
+
+  //-- override the default "Confugure" implementation
+  //   of the Algorithm interface
+
+  void Configure (const Registry & config);
+  void Configure (string config);
+
+private:
+
+  void   LoadConfig  (void);
+  bool   ReadGrid    (string filename);
+  void   WriteGrid   (string filename) const;
+  void   BuildGrid   (void);
+  void   Interpolate (double x, double q2, PDF_t & pdf) const;
+
+  const PDFModelI * fPDFModel;  ///< tabulated PDF model (if no grid file is read)
+
+  int    fNLogX;      ///< number of log10(x) knots in [xmin, 0.1) of the tabulated grid
+  double fLogXmin;    ///< min log10(x) of the tabulated grid
+  int    fNLinX;      ///< number of x knots in [0.1, 1] of the tabulated grid
+  int    fNLogQ2;     ///< number of log10(Q2) knots of the tabulated grid
+  double fLogQ2min;   ///< min log10(Q2/GeV^2) of the tabulated grid
+  double fLogQ2max;   ///< max log10(Q2/GeV^2) of the tabulated grid
+  string fGridFile;   ///< LHAPDF6 data file to read (or to write the tabulated grid in)
+
+  // the Q2 subgrids, in increasing Q2, each storing x*f(x,Q2) for the 9
+  // PDF_t entries at each knot as [ix][iq][flavour] in contiguous memory
+  vector< vector<double> > fLogX;   ///< log(x) knots, per subgrid
+  vector< vector<double> > fLogQ2;  ///< log(Q2) knots, per subgrid
+  vector< vector<double> > fXfx;    ///< PDF_t values at the knots, per subgrid
+};
+
+}         // genie namespace
+
+#endif    // _PDF_GRID_H_
@@ -10,6 +10,8 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 17, 2026 - agent
+   Added a batched AllPDFs() method.
 
 */
 //____________________________________________________________________________
@@ -42,6 +44,11 @@ PDFModelI::~PDFModelI()
 
 }
 //____________________________________________________________________________
-
-
-
+void PDFModelI::AllPDFs(
+    int n, const double * x, const double * q2, PDF_t * pdfs) const
+{
+  for(int i = 0; i < n; i++) {
+    pdfs[i] = this->AllPDFs(x[i], q2[i]);
+  }
+}
+//____________________________________________________________________________
@@ -49,6 +49,11 @@ public:
   virtual double Gluon       (double x, double q2) const = 0;
   virtual PDF_t  AllPDFs     (double x, double q2) const = 0;
 
+  //-- all PDFs at the n points (x[i],q2[i]). The default implementation
+  //   calls AllPDFs(x,q2) for each point
+
+  virtual void   AllPDFs     (int n, const double * x, const double * q2, PDF_t * pdfs) const;
+
 protected:
 
   PDFModelI();
@@ -0,0 +1,361 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <sstream>
+#include <iomanip>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TMath.h>
+#include <TSystem.h>
+#include <TLorentzVector.h>
+
+#include "Conventions/GBuild.h"
+#include "Messenger/Messenger.h"
+#include "PartonModel/DISStrucFuncGrid.h"
+#include "Utils/Cache.h"
+
+using std::ostringstream;
+using std::hex;
+using std::setw;
+using std::setfill;
+
+using namespace genie;
+
+//____________________________________________________________________________
+// Catmull-Rom cubic interpolation weights for the nodes i-1, i, i+1, i+2 at
+// the fractional position t in [i, i+1]
+static void CubicWeights(double t, double * w)
+{
+  double t2 = t*t;
+  double t3 = t2*t;
+  w[0] = 0.5 * (    -t + 2*t2 -   t3);
+  w[1] = 0.5 * ( 2     - 5*t2 + 3*t3);
+  w[2] = 0.5 * (     t + 4*t2 - 3*t3);
+  w[3] = 0.5 * (         - t2 +   t3);
+}
+//____________________________________________________________________________
+DISStrucFuncGrid::DISStrucFuncGrid() :
+DISStructureFuncModelI("genie::DISStrucFuncGrid")
+{
+  fSFModel = 0;
+}
+//____________________________________________________________________________
+DISStrucFuncGrid::DISStrucFuncGrid(string config) :
+DISStructureFuncModelI("genie::DISStrucFuncGrid", config)
+{
+  fSFModel = 0;
+}
+//____________________________________________________________________________
+DISStrucFuncGrid::~DISStrucFuncGrid()
+{
+  this->DeleteGrids();
+}
+//____________________________________________________________________________
+void DISStrucFuncGrid::Calculate(const Interaction * interaction) const
+{
+  fF1 = 0;
+  fF2 = 0;
+  fF3 = 0;
+  fF4 = 0;
+  fF5 = 0;
+  fF6 = 0;
+
+  double x  = interaction->Kine().x();
+  double Q2 = this->Q2(interaction);
+
+  // find the grid position
+  const double * grid = 0;
+  double tx = -1, tq = -1;
+  if(x > 0 && Q2 > 0) {
+    double dlx = (fLogXmax  - fLogXmin ) / (fNLogX  - 1);
+    double dlq = (fLogQ2max - fLogQ2min) / (fNLogQ2 - 1);
+    tx = (TMath::Log10(x)  - fLogXmin ) / dlx;
+    tq = (TMath::Log10(Q2) - fLogQ2min) / dlq;
+    bool inside = (tx >= 0 && tx <= fNLogX-1 && tq >= 0 && tq <= fNLogQ2-1);
+    if(inside) grid = this->Grid(interaction);
+  }
+
+  // outside the grid: use the wrapped model
+  if(!grid) {
+    fSFModel->Calculate(interaction);
+    fF1 = fSFModel->F1();
+    fF2 = fSFModel->F2();
+    fF3 = fSFModel->F3();
+    fF4 = fSFModel->F4();
+    fF5 = fSFModel->F5();
+    fF6 = fSFModel->F6();
+    return;
+  }
+
+  // bicubic interpolation
+  int ix = TMath::Min((int)tx, fNLogX  - 2);
+  int iq = TMath::Min((int)tq, fNLogQ2 - 2);
+  double wx[4], wq[4];
+  CubicWeights(tx - ix, wx);
+  CubicWeights(tq - iq, wq);
+
+  double F[6] = { 0., 0., 0., 0., 0., 0. };
+  for(int a = 0; a < 4; a++) {
+    int jx = TMath::Min(TMath::Max(ix - 1 + a, 0), fNLogX - 1);
+    for(int b = 0; b < 4; b++) {
+      int jq = TMath::Min(TMath::Max(iq - 1 + b, 0), fNLogQ2 - 1);
+      double w = wx[a] * wq[b];
+      const double * node = grid + 6*(jx*fNLogQ2 + jq);
+      for(int k = 0; k < 6; k++) F[k] += w * node[k];
+    }
+  }
+  fF1 = F[0];
+  fF2 = F[1];
+  fF3 = F[2];
+  fF4 = F[3];
+  fF5 = F[4];
+  fF6 = F[5];
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("DISSF", pDEBUG) 
+     << "F1-F6 (x = " << x << ", Q2 = " << Q2 << ") = " << fF1 << ", " 
+     << fF2 << ", " << fF3 << ", " << fF4 << ", " << fF5 << ", " << fF6;
+#endif
+}
+//____________________________________________________________________________
+double DISStrucFuncGrid::Q2(const Interaction * interaction) const
+{
+// Q2 as computed by QPMDISStrucFuncBase::Q2(): Taken from the kinematics if
+// set, otherwise computed from x,y
+
+  const Kinematics & kinematics = interaction->Kine();
+
+  if (kinematics.KVSet(kKVQ2) || kinematics.KVSet(kKVq2)) {
+    return kinematics.Q2();
+  }
+  if (kinematics.KVSet(kKVy)) {
+    const InitialState & init_state = interaction->InitState();
+    double Mn = init_state.Tgt().HitNucP4Ptr()->M();
+    double x  = kinematics.x();
+    double y  = kinematics.y();
+    double Ev = init_state.ProbeE(kRfHitNucRest);
+    return 2*Mn*Ev*x*y;
+  }
+  return 0;
+}
+//____________________________________________________________________________
+const double * DISStrucFuncGrid::Grid(const Interaction * interaction) const
+{
+// Returns the F1-F6 grid for the input interaction, loading or building it
+// if needed
+
+  // the nuclear modification factor may be switched off per interaction
+  int bits = 
+     (interaction->TestBit(kIAssumeFreeNucleon)   ? 1 : 0) +
+     (interaction->TestBit(kINoNuclearCorrection) ? 2 : 0);
+  GridKey_t key(interaction->Key(), bits);
+
+  map<GridKey_t, vector<double> *>::const_iterator iter = fGrids.find(key);
+  if(iter != fGrids.end()) {
+    return (iter->second) ? &(*iter->second)[0] : 0;
+  }
+
+  // grids of interactions that don't fit the Interaction::Key() layout
+  // have job-specific keys and are not saved
+  bool persist = ((key.first >> 63) == 0);
+  string name = this->GridName(key);
+
+  vector<double> * grid = (persist) ? this->LoadGrid(name) : 0;
+  if(!grid) {
+    grid = this->BuildGrid(interaction);
+    if(grid && persist) this->SaveGrid(name, *grid);
+  }
+  fGrids.insert(map<GridKey_t, vector<double> *>::value_type(key, grid));
+
+  return (grid) ? &(*grid)[0] : 0;
+}
+//____________________________________________________________________________
+vector<double> * DISStrucFuncGrid::BuildGrid(
+                                       const Interaction * interaction) const
+{
+  LOG("DISSF", pNOTICE)
+    << "Building the F1-F6 grid (" << fNLogX << " x " << fNLogQ2 
+    << " nodes) for: " << interaction->AsString();
+
+  Interaction * in = new Interaction(*interaction);
+
+  // on-shell hit nucleon at rest
+  Target * tgt = in->InitStatePtr()->TgtPtr();
+  TLorentzVector p4nuc(0, 0, 0, tgt->HitNucMass());
+  tgt->SetHitNucP4(p4nuc);
+
+  double dlx = (fLogXmax  - fLogXmin ) / (fNLogX  - 1);
+  double dlq = (fLogQ2max - fLogQ2min) / (fNLogQ2 - 1);
+
+  vector<double> * grid = new vector<double>(6*fNLogX*fNLogQ2, 0.);
+  for(int ix = 0; ix < fNLogX; ix++) {
+    double x = TMath::Power(10., fLogXmin + ix*dlx);
+    in->KinePtr()->Setx(x);
+    for(int iq = 0; iq < fNLogQ2; iq++) {
+      double Q2 = TMath::Power(10., fLogQ2min + iq*dlq);
+      in->KinePtr()->SetQ2(Q2);
+      fSFModel->Calculate(in);
+      double * node = &(*grid)[6*(ix*fNLogQ2 + iq)];
+      node[0] = fSFModel->F1();
+      node[1] = fSFModel->F2();
+      node[2] = fSFModel->F3();
+      node[3] = fSFModel->F4();
+      node[4] = fSFModel->F5();
+      node[5] = fSFModel->F6();
+    }
+  }
+  delete in;
+
+  return grid;
+}
+//____________________________________________________________________________
+string DISStrucFuncGrid::GridName(const GridKey_t & key) const
+{
+// The grid name includes a digest of the configuration of the wrapped model
+// and the interaction key
+
+  ostringstream name;
+  name << "sf_" << Cache::ConfigDigest(fSFModel) 
+       << "_"   << hex << setw(16) << setfill('0') << key.first
+       << "_"   << key.second;
+  return name.str();
+}
+//____________________________________________________________________________
+vector<double> * DISStrucFuncGrid::LoadGrid(string name) const
+{
+  if(fGridFile.size() == 0) return 0;
+  if(gSystem->AccessPathName(fGridFile.c_str())) return 0;
+
+  TFile file(fGridFile.c_str(), "READ");
+  TTree * tree = dynamic_cast<TTree *> (file.Get(name.c_str()));
+  if(!tree) {
+    file.Close();
+    return 0;
+  }
+
+  int    n = 0, nx = 0, nq = 0;
+  double lxmin = 0, lxmax = 0, lqmin = 0, lqmax = 0;
+  tree->SetBranchAddress("nlogx",    &nx   );
+  tree->SetBranchAddress("logxmin",  &lxmin);
+  tree->SetBranchAddress("logxmax",  &lxmax);
+  tree->SetBranchAddress("nlogq2",   &nq   );
+  tree->SetBranchAddress("logq2min", &lqmin);
+  tree->SetBranchAddress("logq2max", &lqmax);
+  tree->SetBranchAddress("n",        &n    );
+  tree->GetEntry(0);
+
+  bool same_binning = 
+     (nx == fNLogX  && lxmin == fLogXmin  && lxmax == fLogXmax &&
+      nq == fNLogQ2 && lqmin == fLogQ2min && lqmax == fLogQ2max &&
+      n  == 6*fNLogX*fNLogQ2);
+
+  vector<double> * grid = 0;
+  if(same_binning) {
+    grid = new vector<double>(n, 0.);
+    tree->SetBranchAddress("sf", &(*grid)[0]);
+    tree->GetEntry(0);
+    LOG("DISSF", pNOTICE) 
+       << "Loaded F1-F6 grid " << name << " from " << fGridFile;
+  } else {
+    LOG("DISSF", pWARN) 
+       << "F1-F6 grid " << name << " in " << fGridFile 
+       << " has a different binning - Rebuilding it";
+  }
+  file.Close();
+
+  return grid;
+}
+//____________________________________________________________________________
+void DISStrucFuncGrid::SaveGrid(string name, const vector<double> & grid) const
+{
+  if(fGridFile.size() == 0) return;
+
+  TFile file(fGridFile.c_str(), "UPDATE");
+  if(!file.IsOpen() || file.IsZombie()) {
+    LOG("DISSF", pWARN) << "Can not save the F1-F6 grids in " << fGridFile;
+    return;
+  }
+
+  int    n     = grid.size();
+  int    nx    = fNLogX;
+  int    nq    = fNLogQ2;
+  double lxmin = fLogXmin;
+  double lxmax = fLogXmax;
+  double lqmin = fLogQ2min;
+  double lqmax = fLogQ2max;
+  vector<double> sf(grid);
+
+  TTree * tree = new TTree(name.c_str(), "DIS F1-F6 grid");
+  tree->Branch("nlogx",    &nx,     "nlogx/I"   );
+  tree->Branch("logxmin",  &lxmin,  "logxmin/D" );
+  tree->Branch("logxmax",  &lxmax,  "logxmax/D" );
+  tree->Branch("nlogq2",   &nq,     "nlogq2/I"  );
+  tree->Branch("logq2min", &lqmin,  "logq2min/D");
+  tree->Branch("logq2max", &lqmax,  "logq2max/D");
+  tree->Branch("n",        &n,      "n/I"       );
+  tree->Branch("sf",       &sf[0],  "sf[n]/D"   );
+  tree->Fill();
+  tree->Write(name.c_str());
+  file.Close();
+
+  LOG("DISSF", pNOTICE) << "Saved F1-F6 grid " << name << " in " << fGridFile;
+}
+//____________________________________________________________________________
+void DISStrucFuncGrid::DeleteGrids(void)
+{
+  map<GridKey_t, vector<double> *>::iterator iter = fGrids.begin();
+  for( ; iter != fGrids.end(); ++iter) {
+    if(iter->second) delete iter->second;
+  }
+  fGrids.clear();
+}
+//____________________________________________________________________________
+void DISStrucFuncGrid::Configure(const Registry & config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void DISStrucFuncGrid::Configure(string config)
+{
+  Algorithm::Configure(config);
+  this->LoadConfig();
+}
+//____________________________________________________________________________
+void DISStrucFuncGrid::LoadConfig(void)
+{
+  fSFModel = dynamic_cast<const DISStructureFuncModelI *> (this->SubAlg("SFAlg"));
+  assert(fSFModel);
+
+  fNLogX     = fConfig->GetIntDef    ("Grid-NLogX",       121);
+  fLogXmin   = fConfig->GetDoubleDef ("Grid-LogXmin",    -6.0);
+  fLogXmax   = fConfig->GetDoubleDef ("Grid-LogXmax",     0.0);
+  fNLogQ2    = fConfig->GetIntDef    ("Grid-NLogQ2",       91);
+  fLogQ2min  = fConfig->GetDoubleDef ("Grid-LogQ2min",   -4.0);
+  fLogQ2max  = fConfig->GetDoubleDef ("Grid-LogQ2max",    5.0);
+  fGridFile  = fConfig->GetStringDef ("GridFile",          "");
+
+  assert(fNLogX > 1 && fNLogQ2 > 1);
+  assert(fLogXmax > fLogXmin && fLogQ2max > fLogQ2min);
+
+  // environment variables in the grid file name
+  if(fGridFile.size() > 0) {
+    fGridFile = gSystem->ExpandPathName(fGridFile.c_str());
+  }
+
+  this->DeleteGrids();
+}
+//____________________________________________________________________________
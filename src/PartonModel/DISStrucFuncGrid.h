@@ -0,0 +1,108 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::DISStrucFuncGrid
+
+\brief    DIS structure functions F1-F6 interpolated from precomputed grids.
+          Is a concrete implementation of the DISStructureFuncModelI 
+          interface, wrapping any other DISStructureFuncModelI (eg 
+          BYStrucFunc) set as its `SFAlg' sub-algorithm.
+
+          The first time the structure functions are requested for a given
+          interaction (probe, target, hit nucleon, hit quark, process), the
+          wrapped model is evaluated on a grid of log(x) and log(Q^2) nodes
+          and F1-F6 are then obtained by bicubic (Catmull-Rom) interpolation.
+          Points outside the grid are computed by the wrapped model.
+          The grids can be saved in (and loaded from) a ROOT file, so that
+          they are only built once for a given configuration.
+          The grids are computed for an on-shell hit nucleon at rest.
+          Saved grids are identified by the interaction and a digest of the
+          wrapped model configuration (not of its own sub-algorithms, eg the
+          PDF set): Remove the grid file after changing those.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _DIS_STRUC_FUNC_GRID_H_
+#define _DIS_STRUC_FUNC_GRID_H_
+
+#include <map>
+#include <vector>
+#include <string>
+#include <utility>
+
+#include "Base/DISStructureFuncModelI.h"
+
+using std::map;
+using std::vector;
+using std::string;
+using std::pair;
+
+namespace genie {
+
+class DISStrucFuncGrid : public DISStructureFuncModelI {
+
+public:
+  DISStrucFuncGrid();
+  DISStrucFuncGrid(string config);
+  virtual ~DISStrucFuncGrid();
+
+  // implement the DISStructureFuncModelI interface
+  void   Calculate (const Interaction * interaction) const;
+  double F1        (void) const { return fF1; }
+  double F2        (void) const { return fF2; }
+  double F3        (void) const { return fF3; }
+  double F4        (void) const { return fF4; }
+  double F5        (void) const { return fF5; }
+  double F6        (void) const { return fF6; }
+
+  //! the wrapped structure function model
+  const DISStructureFuncModelI * Model (void) const { return fSFModel; }
+
+  // overload the Algorithm::Configure() methods to load private data
+  // members from configuration options
+  void Configure (const Registry & config);
+  void Configure (string config);
+
+private:
+
+  typedef pair<ULong64_t, int> GridKey_t;
+
+  void             LoadConfig  (void);
+  void             DeleteGrids (void);
+  const double *   Grid        (const Interaction * interaction) const;
+  vector<double> * BuildGrid   (const Interaction * interaction) const;
+  vector<double> * LoadGrid    (string name) const;
+  void             SaveGrid    (string name, const vector<double> & grid) const;
+  string           GridName    (const GridKey_t & key) const;
+  double           Q2          (const Interaction * interaction) const;
+
+  const DISStructureFuncModelI * fSFModel; ///< wrapped structure function model
+
+  int    fNLogX;      ///< number of log10(x) nodes
+  double fLogXmin;    ///< min log10(x)
+  double fLogXmax;    ///< max log10(x)
+  int    fNLogQ2;     ///< number of log10(Q2) nodes
+  double fLogQ2min;   ///< min log10(Q2/GeV^2)
+  double fLogQ2max;   ///< max log10(Q2/GeV^2)
+  string fGridFile;   ///< ROOT file to load / save the grids (none if empty)
+
+  mutable map<GridKey_t, vector<double> *> fGrids; ///< F1-F6 at the grid nodes, per interaction
+
+  mutable double fF1;
+  mutable double fF2;
+  mutable double fF3;
+  mutable double fF4;
+  mutable double fF5;
+  mutable double fF6;
+};
+
+}         // genie namespace
+#endif    // _DIS_STRUC_FUNC_GRID_H_
@@ -9,6 +9,7 @@
 #pragma link C++ class genie::QPMDISStrucFuncBase;
 
 #pragma link C++ class genie::QPMDISStrucFunc;
+#pragma link C++ class genie::DISStrucFuncGrid;
 #pragma link C++ class genie::QPMDISPXSec;
 
 #endif
@@ -18,7 +18,9 @@
  @ Jan 29, 2013 - CA
    Don't look-up depreciated $GDISABLECACHING environmental variable.
    Use the RunOpt singleton instead.
-
+ @ Oct 17, 2026 - agent
+   Access the DIS/RES joining scheme cache branches through integer handles.
+   The cache branch key includes a digest of the configuration.
 */
 //____________________________________________________________________________
 
@@ -269,26 +271,36 @@ double QPMDISPXSec::DISRESJoinSuppressionFactor(
     // ** cache to evaluate these factors
 
     // Access the cache branch. The branch key is formed as:
-    // algid/DIS-RES-Join/nu-pdg:N;hit-nuc-pdg:N/inttype
+    // algid#digest/DIS-RES-Join/nu-pdg:N;hit-nuc-pdg:N/inttype
+    // and is only built once: use the corresponding handle afterwards.
     Cache * cache = Cache::Instance();
-    string algkey = this->Id().Key() + "/DIS-RES-Join";
-
-    ostringstream ikey;
-    ikey << "nu-pdgc:" << ist.ProbePdg() 
-         << ";hit-nuc-pdg:"<< ist.Tgt().HitNucPdg() << "/"
-         << pi.InteractionTypeAsString();
 
-    string key = cache->CacheBranchKey(algkey, ikey.str());
+    int channel = ((ist.ProbePdg() + 64) * 4 + 
+                   (pdg::IsProton(ist.Tgt().HitNucPdg()) ? 1 : 0)) * 32 +
+                  (int) pi.InteractionTypeId();
+    int handle = -1;
+    map<int,int>::const_iterator hiter = fCacheHandles.find(channel);
+    if(hiter != fCacheHandles.end()) { handle = hiter->second; }
+    else {
+      ostringstream ikey;
+      ikey << "nu-pdgc:" << ist.ProbePdg() 
+           << ";hit-nuc-pdg:"<< ist.Tgt().HitNucPdg() << "/"
+           << pi.InteractionTypeAsString();
+
+      string key = cache->CacheBranchKey(this, "DIS-RES-Join", ikey.str());
+      handle = cache->CacheBranchHandle(key);
+      fCacheHandles[channel] = handle;
+    }
 
     CacheBranchFx * cbr =
-          dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+          dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
 
     // If it does't exist then create a new one 
     // and cache DIS xsec suppression factors
     bool non_zero=false;
     if(!cbr) {
       LOG("DISXSec", pNOTICE) 
-                        << "\n ** Creating cache branch - key = " << key;
+        << "\n ** Creating cache branch - key = " << cache->CacheBranchKey(handle);
 
       cbr = new CacheBranchFx("DIS Suppr. Factors in DIS/RES Join Scheme");
       Interaction interaction(*in);
@@ -323,7 +335,7 @@ double QPMDISPXSec::DISRESJoinSuppressionFactor(
       }
       cbr->CreateSpline();
 
-      cache->AddCacheBranch(key, cbr);
+      cache->AddCacheBranch(handle, cbr);
       assert(cbr);
     } // cache data
 
@@ -412,11 +424,14 @@ void QPMDISPXSec::LoadConfig(void)
 
   if(!fInInitPhase) {
      Cache * cache = Cache::Instance();
-     string keysubstr = this->Id().Key() + "/DIS-RES-Join";
+     string keysubstr = this->Id().Key() + "#";
      cache->RmMatchedCacheBranches(keysubstr);
   }
   fInInitPhase = false;
 
+  // the cache branch keys depend on the configuration
+  fCacheHandles.clear();
+
   //-- load the differential cross section integrator
   fXSecIntegrator =
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
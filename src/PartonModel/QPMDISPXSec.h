@@ -22,9 +22,13 @@
 #ifndef _DIS_PARTON_MODEL_PARTIAL_XSEC_H_
 #define _DIS_PARTON_MODEL_PARTIAL_XSEC_H_
 
+#include <map>
+
 #include "Base/XSecAlgorithmI.h"
 #include "Base/DISStructureFunc.h"
 
+using std::map;
+
 namespace genie {
 
 class DISStructureFuncModelI;
@@ -66,6 +70,8 @@ private:
   double fWcut;             ///< apply DIS/RES joining scheme < Wcut
   double fScale;            ///< cross section scaling factor
   double fSin48w;           ///< sin^4(Weingberg angle)
+
+  mutable map<int, int> fCacheHandles; ///< (nu, hit nucleon, int. type) -> cache branch handle
 };
 
 }       // genie namespace
@@ -20,6 +20,9 @@
  @ Feb 14, 2013 - CA
    Temporarily disable the kinematical transformation that takes out the
    dipole form from the dsigma/dQ2 p.d.f.
+ @ Oct 17, 2026 - agent
+   Count the cross section evaluations and accepted events of the rejection
+   method (see KineGeneratorWithCache::PrintSamplingStats()).
 */
 //____________________________________________________________________________
 
@@ -155,6 +158,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- Computing cross section for the current kinematics
      xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     fNKineTrials++;
 
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -175,6 +179,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        fNKineEvents++;
         LOG("QELKinematics", pINFO) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -371,6 +376,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
 
      //-- Computing cross section for the current kinematics
      xsec = fXSecModel->XSec(interaction, kPSQ2fE);
+     fNKineTrials++;
 
      //-- Decide whether to accept the current kinematics
 //     if(!fGenerateUniformly) {
@@ -388,6 +394,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {
+        fNKineEvents++;
         LOG("QELKinematics", pNOTICE) << "Selected: Q^2 = " << gQ2;
 
         // reset bits
@@ -22,7 +22,9 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
-
+ @ Oct 17, 2026 - agent
+   Count the cross section evaluations and accepted events of the rejection
+   method (see KineGeneratorWithCache::PrintSamplingStats()).
 */
 //____________________________________________________________________________
 
@@ -231,6 +233,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- Computing cross section for the current kinematics
      xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+     fNKineTrials++;
 
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
@@ -262,6 +265,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- If the generated kinematics are accepted, finish-up module's job
      if(accept) {        
+        fNKineEvents++;
         LOG("RESKinematics", pINFO)
                             << "Selected: W = " << gW << ", Q2 = " << gQ2;
         // reset 'trust' bits
@@ -21,10 +21,23 @@
    calculator to include. Weight calculators are owned by GReWeight and are 
    identified by a name. Weight calculators can be retrieved via the 
    WghtCalc(string) method and their reweighting options can be fine-tuned.
+ @ Oct 17, 2026 - agent
+   Added CalcWeights() for computing the weights of an event sample for many
+   universes in one go, optionally using several worker processes.
 */
 //____________________________________________________________________________
 
 #include <vector>
+#include <iostream>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+#include <unistd.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
 
 #include <TMath.h>
 #include <TString.h>
@@ -42,6 +55,8 @@ using namespace genie::rew;
 //____________________________________________________________________________
 GReWeight::GReWeight()
 {
+  fNWorkers = 1;
+
   // Disable cacheing that interferes with event reweighting
   RunOpt::Instance()->EnableBareXSecPreCalc(false);
 }
@@ -161,3 +176,178 @@ void GReWeight::Print()
 //____________________________________________________________________________
 
 
+void GReWeight::CalcWeights(
+  const vector<EventRecord *> & events, const vector<GSyst_t> & systs, 
+  const vector< vector<double> > & dials, vector<double> & weights)
+{
+// Calculate the weights of all input events for each input universe.
+// The weight calculators that don't handle any of the input systematic params
+// are unaffected by the universes, so their weight is calculated only once per
+// event. The remaining ones are reconfigured once per universe and then called
+// for all events. Universes are shared out to fNWorkers worker processes.
+// The current systematic param values are restored at the end.
+
+  int nev   = events.size();
+  int nuniv = dials.size();
+  int nsyst = systs.size();
+
+  weights.assign(nev*nuniv, 1.);
+  if(nev == 0 || nuniv == 0) return;
+
+  for(int iu = 0; iu < nuniv; iu++) {
+    if((int)dials[iu].size() != nsyst) {
+      LOG("ReW", pFATAL) 
+        << "Universe " << iu << " has " << dials[iu].size() 
+        << " dial values but " << nsyst << " systematic params were given";
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+
+  // include all params in the systematics set & keep their current values
+  vector<double> current(nsyst, 0.);
+  for(int is = 0; is < nsyst; is++) {
+    if(!fSystSet.Added(systs[is])) fSystSet.Init(systs[is]);
+    current[is] = fSystSet.Info(systs[is])->CurValue;
+  }
+
+  // find the weight calculators affected by the universes
+  vector<GReWeightI *> active;
+  vector<GReWeightI *> fixed;
+  map<string, GReWeightI *>::iterator it = fWghtCalc.begin();
+  for( ; it != fWghtCalc.end(); ++it) {
+    GReWeightI * wcalc = it->second;
+    bool handled = false;
+    for(int is = 0; is < nsyst; is++) {
+      handled = handled || wcalc->IsHandled(systs[is]);
+    }
+    if(handled) active.push_back(wcalc);
+    else        fixed .push_back(wcalc);
+  }
+
+  // weights from the unaffected weight calculators
+  vector<double> fixed_weights(nev, 1.);
+  for(int iev = 0; iev < nev; iev++) {
+    for(unsigned int ic = 0; ic < fixed.size(); ic++) {
+      fixed_weights[iev] *= fixed[ic]->CalcWeight(*events[iev]);
+    }
+  }
+
+  int nworkers = TMath::Min(fNWorkers, nuniv);
+
+  LOG("ReW", pNOTICE) 
+    << "Calculating weights for " << nev << " events in " << nuniv 
+    << " universes (" << active.size() << " of " << fWghtCalc.size() 
+    << " weight calculators affected) using " << nworkers << " process(es)";
+
+  void * shared = MAP_FAILED;
+  size_t size   = nev * nuniv * sizeof(double);
+  if(nworkers > 1) {
+    shared = mmap(0, size, 
+               PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(shared == MAP_FAILED) {
+      LOG("ReW", pERROR) 
+        << "Couldn't allocate shared memory - Using a single process";
+    }
+  }
+
+  if(shared == MAP_FAILED) {
+    this->CalcUniverses(
+       events, systs, dials, fixed_weights, active, 0, 1, &weights[0]);
+  } else {
+    double * wshared = (double *) shared;
+
+    // flush all output before forking so that it is not duplicated
+    std::cout.flush();
+    std::cerr.flush();
+    fflush(0);
+
+    vector<pid_t> pids;
+    for(int iw = 0; iw < nworkers; iw++) {
+      pid_t pid = fork();
+      if(pid < 0) {
+        LOG("ReW", pFATAL) << "Failed to fork reweighting worker: " << iw;
+        gAbortingInErr = true;
+        exit(1);
+      }
+      if(pid == 0) {
+        this->CalcUniverses(
+           events, systs, dials, fixed_weights, active, iw, nworkers, wshared);
+        std::cout.flush();
+        std::cerr.flush();
+        fflush(0);
+        // skip static destructors: singletons are owned by the parent
+        _exit(0);
+      }
+      pids.push_back(pid);
+    }
+
+    bool ok = true;
+    for(int nrunning = nworkers; nrunning > 0; nrunning--) {
+      int status = 0;
+      pid_t pid = waitpid(-1, &status, 0);
+      if(pid < 0) { ok = false; break; }
+      ok = ok && WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+    }
+    if(!ok) {
+      LOG("ReW", pFATAL) << "A reweighting worker failed!";
+      for(int iw = 0; iw < nworkers; iw++) kill(pids[iw], SIGKILL);
+      munmap(shared, size);
+      gAbortingInErr = true;
+      exit(1);
+    }
+    std::copy(wshared, wshared + nev*nuniv, weights.begin());
+    munmap(shared, size);
+  }
+
+  // restore the current systematic param values
+  this->SetUniverse(active, systs, current);
+}
+//____________________________________________________________________________
+void GReWeight::CalcUniverses(
+  const vector<EventRecord *> & events, const vector<GSyst_t> & systs, 
+  const vector< vector<double> > & dials, const vector<double> & fixed_weights,
+  const vector<GReWeightI *> & active, int first, int stride, double * weights)
+{
+// Calculate the weights for universes first, first+stride, first+2*stride,...
+
+  int nev   = events.size();
+  int nuniv = dials.size();
+
+  for(int iu = first; iu < nuniv; iu += stride) {
+    this->SetUniverse(active, systs, dials[iu]);
+    for(int iev = 0; iev < nev; iev++) {
+      double weight = fixed_weights[iev];
+      for(unsigned int ic = 0; ic < active.size(); ic++) {
+        weight *= active[ic]->CalcWeight(*events[iev]);
+      }
+      weights[iev*nuniv + iu] = weight;
+    }
+    LOG("ReW", pINFO) << "Done with universe " << iu;
+  }
+}
+//____________________________________________________________________________
+void GReWeight::SetUniverse(
+  const vector<GReWeightI *> & wcalcs, 
+  const vector<GSyst_t> & systs, const vector<double> & values)
+{
+// Set the input systematic param values and reconfigure the input weight
+// calculators (as in Reconfigure())
+
+  for(unsigned int is = 0; is < systs.size(); is++) {
+    fSystSet.Set(systs[is], values[is]);
+  }
+
+  vector<genie::rew::GSyst_t> svec = fSystSet.AllIncluded();
+
+  for(unsigned int ic = 0; ic < wcalcs.size(); ic++) {
+    GReWeightI * wcalc = wcalcs[ic];
+    vector<genie::rew::GSyst_t>::const_iterator parm_iter = svec.begin();
+    for( ; parm_iter != svec.end(); ++parm_iter) {
+      GSyst_t syst = *parm_iter;
+      wcalc->SetSystematic(syst, fSystSet.Info(syst)->CurValue);
+    }
+    wcalc->Reconfigure();
+  }
+}
+//____________________________________________________________________________
@@ -5,6 +5,15 @@
 
 \brief    Interface to the GENIE event reweighting engines
 
+          Besides computing the weight of an event for the current values of
+          the systematic params (CalcWeight()), it can compute in one go the
+          weights of a sample of events for many sets of values of a number
+          of systematic params ("universes"; CalcWeights()). The weight
+          calculators not affected by the varied params are called only once
+          per event and the affected ones are only reconfigured once per
+          universe. Universes can be shared out to several worker processes
+          (see SetNWorkers()).
+
 \author   Jim Dobson <J.Dobson07 \at imperial.ac.uk>
           Imperial College London
 
@@ -24,12 +33,14 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "ReWeight/GSystSet.h"
 #include "ReWeight/GReWeightI.h"
 
 using std::string;
 using std::map;
+using std::vector;
 
 namespace genie {
 
@@ -51,12 +62,27 @@ namespace rew   {
    double      CalcChisq     (void);                             ///< calculate penalty chisq for current values of tweaking dials
    void        Print         (void);                             ///< print
 
+   //! calculate the weights of all input events for each of the input universes:
+   //! dials[iuniv][isyst] is the value of systs[isyst] in universe iuniv and
+   //! the weights are returned as weights[ievent * n_universes + iuniv]
+   void        CalcWeights   (const vector<EventRecord *> & events,
+                              const vector<GSyst_t> & systs,
+                              const vector< vector<double> > & dials,
+                              vector<double> & weights);
+   void        SetNWorkers   (int n) { fNWorkers = (n>1) ? n : 1; } ///< number of worker processes used by CalcWeights()
+   int         NWorkers      (void) const { return fNWorkers; }
+
   private:
 
-   void CleanUp (void);
+   void CleanUp       (void);
+   void SetUniverse   (const vector<GReWeightI *> & wcalcs, const vector<GSyst_t> & systs, const vector<double> & values);
+   void CalcUniverses (const vector<EventRecord *> & events, const vector<GSyst_t> & systs,
+                       const vector< vector<double> > & dials, const vector<double> & fixed_weights,
+                       const vector<GReWeightI *> & active, int first, int stride, double * weights);
 
    GSystSet                  fSystSet;   ///< set of enabled nuisance parameters
    map<string, GReWeightI *> fWghtCalc;  ///< concrete weight calculators
+   int                       fNWorkers;  ///< number of worker processes used by CalcWeights()
  };
 
 } // rew   namespace
@@ -0,0 +1,121 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <TMath.h>
+
+#include "ReWeight/GReWeightResponse.h"
+
+using namespace genie;
+using namespace genie::rew;
+
+//____________________________________________________________________________
+GReWeightResponse::GReWeightResponse()
+{
+
+}
+//____________________________________________________________________________
+GReWeightResponse::GReWeightResponse(
+   int n, const double * dials, const double * weights)
+{
+  this->Set(n, dials, weights);
+}
+//____________________________________________________________________________
+GReWeightResponse::~GReWeightResponse()
+{
+
+}
+//____________________________________________________________________________
+void GReWeightResponse::Set(int n, const double * dials, const double * weights)
+{
+// Build the natural cubic spline through the input knots
+
+  fX.assign(dials,   dials   + n);
+  fY.assign(weights, weights + n);
+  fB.assign(n, 0.);
+  fC.assign(n, 0.);
+  fD.assign(n, 0.);
+
+  if(n < 2) return;
+
+  if(n == 2) {
+    fB[0] = fB[1] = (fY[1]-fY[0]) / (fX[1]-fX[0]);
+    return;
+  }
+
+  // solve the tridiagonal system for the 2nd derivatives (c = y''/2), with
+  // c = 0 at both ends
+  vector<double> h(n-1), diag(n, 1.), rhs(n, 0.);
+  for(int i = 0; i < n-1; i++) h[i] = fX[i+1] - fX[i];
+  for(int i = 1; i < n-1; i++) {
+    diag[i] = 2.*(h[i-1] + h[i]);
+    rhs [i] = 3.*((fY[i+1]-fY[i])/h[i] - (fY[i]-fY[i-1])/h[i-1]);
+  }
+  for(int i = 2; i < n-1; i++) {
+    double m = h[i-1] / diag[i-1];
+    diag[i] -= m * h[i-1];
+    rhs [i] -= m * rhs[i-1];
+  }
+  for(int i = n-2; i >= 1; i--) {
+    fC[i] = (rhs[i] - ((i < n-2) ? h[i]*fC[i+1] : 0.)) / diag[i];
+  }
+
+  for(int i = 0; i < n-1; i++) {
+    fB[i] = (fY[i+1]-fY[i])/h[i] - h[i]*(fC[i+1] + 2.*fC[i])/3.;
+    fD[i] = (fC[i+1]-fC[i]) / (3.*h[i]);
+  }
+  // slope at the last knot, for extrapolating beyond it
+  double hl = h[n-2];
+  fB[n-1] = fB[n-2] + 2.*fC[n-2]*hl + 3.*fD[n-2]*hl*hl;
+}
+//____________________________________________________________________________
+double GReWeightResponse::Evaluate(double dial) const
+{
+  int n = fX.size();
+  if(n == 0) return 1.;
+  if(n == 1) return fY[0];
+
+  // linear beyond the end knots
+  if(dial <= fX[0]  ) return fY[0]   + fB[0]  *(dial - fX[0]  );
+  if(dial >= fX[n-1]) return fY[n-1] + fB[n-1]*(dial - fX[n-1]);
+
+  int i = TMath::BinarySearch(n, &fX[0], dial);
+  i = TMath::Min(TMath::Max(i, 0), n-2);
+
+  double dx = dial - fX[i];
+  return fY[i] + dx*(fB[i] + dx*(fC[i] + dx*fD[i]));
+}
+//____________________________________________________________________________
+double GReWeightResponse::LeaveOneOutError(void) const
+{
+  int n = fX.size();
+  if(n < 3) return 0.;
+
+  double max_err = 0;
+
+  vector<double> x(n-1), y(n-1);
+  for(int k = 1; k < n-1; k++) {
+    for(int i = 0, j = 0; i < n; i++) {
+      if(i == k) continue;
+      x[j] = fX[i];
+      y[j] = fY[i];
+      j++;
+    }
+    GReWeightResponse reduced(n-1, &x[0], &y[0]);
+    double err = TMath::Abs(reduced.Evaluate(fX[k]) - fY[k]);
+    max_err = TMath::Max(max_err, err);
+  }
+  return max_err;
+}
+//____________________________________________________________________________
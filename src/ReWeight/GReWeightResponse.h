@@ -0,0 +1,60 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::rew::GReWeightResponse
+
+\brief    Response function of an event weight to a single tweaking dial.
+          It is built from the weights computed at a handful of dial values
+          (knots) and is a natural cubic spline in the dial value (linear
+          beyond the end knots). Once built, a weight for any dial value is
+          obtained in closed form, without recomputing any cross section.
+          LeaveOneOutError() estimates the interpolation error by comparing,
+          at each interior knot, the computed weight with the one predicted
+          by the response built without that knot. As the knot spacing is
+          locally doubled, this overestimates the actual interpolation error.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_REWEIGHT_RESPONSE_H_
+#define _G_REWEIGHT_RESPONSE_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+namespace rew   {
+
+ class GReWeightResponse
+ {
+ public:
+   GReWeightResponse();
+   GReWeightResponse(int n, const double * dials, const double * weights);
+  ~GReWeightResponse();
+
+   void   Set              (int n, const double * dials, const double * weights); ///< build from n (dial, weight) knots, in increasing dial value
+   double Evaluate         (double dial) const;                                    ///< weight at the input dial value
+   double LeaveOneOutError (void) const;                                           ///< estimate of the max interpolation error
+   int    NKnots           (void) const { return fX.size(); }
+
+ private:
+
+   vector<double> fX;  ///< knot dial values
+   vector<double> fY;  ///< knot weights
+   vector<double> fB;  ///< spline coefficients: w = y + b*dx + c*dx^2 + d*dx^3
+   vector<double> fC;  ///<
+   vector<double> fD;  ///<
+ };
+
+} // rew   namespace
+} // genie namespace
+
+#endif
@@ -22,6 +22,11 @@
    Update INUKE fates. Mean free path is now function of Z too.   
  @ Feb 08, 2013 - CA
    Adjust formation zone reweighting. Mean free path is function of Z too.
+ @ Oct 17, 2026 - agent
+   The survival probabilities used in MeanFreePathWeight() and FZoneWeight()
+   are served by INukeSurvivalTable rather than computed by stepping. The
+   nominal and tweaked probabilities in MeanFreePathWeight() are obtained from
+   the same optical depth.
 */
 //____________________________________________________________________________
 
@@ -34,6 +39,7 @@
 #include "GHEP/GHepParticle.h"
 #include "HadronTransport/INukeHadroData.h"
 #include "HadronTransport/INukeHadroFates.h"
+#include "HadronTransport/INukeSurvivalTable.h"
 #include "HadronTransport/INukeUtils.h"
 #include "Messenger/Messenger.h"
 #include "Numerical/Spline.h"
@@ -60,15 +66,16 @@ double genie::utils::rew::MeanFreePathWeight(
      << "nR_pion = " << nRpi << ", nR_nucleon = " << nRnuc 
      << ", NR = " << NR << ", R0 = " << R0;
 
-   // Get the nominal survival probability
-   double pdef = utils::intranuke::ProbSurvival(
-      pdgc,x4,p4,A,Z,1.,nRpi,nRnuc,NR,R0);
+   // Get the nominal survival probability and the one for the tweaked mean
+   // free path (mfp -> mfp*scale), from the same optical depth
+   INukeSurvivalTable * surv = INukeSurvivalTable::Instance();
+   double depth = surv->OpticalDepth(pdgc,x4,p4,A,Z,nRpi,nRnuc,NR,R0);
+
+   double pdef = TMath::Exp(-depth);
    LOG("ReW", pINFO)  << "Probability(default mfp) = " << pdef;      
    if(pdef<=0) return 1.;
 
-   // Get the survival probability for the tweaked mean free path
-   double ptwk = utils::intranuke::ProbSurvival(
-      pdgc,x4,p4,A,Z,mfp_scale_factor,nRpi,nRnuc,NR,R0);
+   double ptwk = (mfp_scale_factor > 0) ? TMath::Exp(-depth/mfp_scale_factor) : 0.;
    LOG("ReW", pINFO)  << "Probability(tweaked mfp) = " << ptwk;      
    if(ptwk<=0) return 1.;
 
@@ -91,8 +98,10 @@ double genie::utils::rew::FZoneWeight(
 
    LOG("ReW", pDEBUG)  << "Formation zone = "<< fz.Vect().Mag() << " fm";
 
+   INukeSurvivalTable * surv = INukeSurvivalTable::Instance();
+
    // Get nominal survival probability.
-   double pdef = utils::intranuke::ProbSurvival(
+   double pdef = surv->ProbSurvival(
       pdgc,x4,p4,A,Z,1.,nRpi,nRnuc,NR,R0);
    LOG("ReW", pDEBUG)  << "Survival probability (nominal) = "<< pdef;
    if(pdef<=0) return 1.; 
@@ -104,7 +113,7 @@ double genie::utils::rew::FZoneWeight(
    }
 
    // Get tweaked survival probability.
-   double ptwk = utils::intranuke::ProbSurvival(
+   double ptwk = surv->ProbSurvival(
       pdgc,x4twk,p4,A,Z,1.,nRpi,nRnuc,NR,R0);
    if(ptwk<=0) return 1.;
    LOG("ReW", pDEBUG)  << "Survival probability (tweaked) = "<< ptwk;
@@ -127,7 +136,8 @@ double genie::utils::rew::MeanFreePathWeight(
 //   ptwk : survival probability for the tweaked mean free path
 //   interacted : flag indicating whether the hadron interacted or escaped
 //
-// See utils::intranuke::ProbSurvival() for the calculation of probabilities.
+// See utils::intranuke::ProbSurvival() for the calculation of probabilities
+// (served by INukeSurvivalTable::ProbSurvival()).
 //
   double w_mfp = 1.;
 
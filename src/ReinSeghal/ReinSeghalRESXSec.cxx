@@ -15,6 +15,8 @@
  @ Jan 29, 2013 - CA
    Don't look-up depreciated $GDISABLECACHING environmental variable.
    Use the RunOpt singleton instead.
+ @ Oct 17, 2026 - agent
+   Access the free nucleon cache branches through integer handles.
 */
 //____________________________________________________________________________
 
@@ -131,11 +133,9 @@ double ReinSeghalRESXSec::Integrate(
   bool bare_xsec_pre_calc = RunOpt::Instance()->BareXSecPreCalc();
   if(bare_xsec_pre_calc) {
      Cache * cache = Cache::Instance();
-     string key = this->CacheBranchName(res, it, nu_pdgc, nucleon_pdgc);
-     LOG("ReinSeghalResT", pINFO) 
-         << "Finding cache branch with key: " << key;
+     int handle = this->CacheBranchHandle(res, it, nu_pdgc, nucleon_pdgc);
      CacheBranchFx * cache_branch =
-         dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+         dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
      if(!cache_branch) {
         LOG("ReinSeghalResT", pWARN)  
            << "No cached RES v-production data for input neutrino"
@@ -147,9 +147,10 @@ double ReinSeghalRESXSec::Integrate(
 
         LOG("ReinSeghalResT", pINFO) << "Done caching resonance xsec data";
         LOG("ReinSeghalResT", pINFO) 
-               << "Finding newly created cache branch with key: " << key;
+               << "Finding newly created cache branch with key: " 
+               << cache->CacheBranchKey(handle);
         cache_branch =
-              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
         assert(cache_branch);
      }
      const CacheBranchFx & cbranch = (*cache_branch);
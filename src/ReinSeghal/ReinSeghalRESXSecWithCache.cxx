@@ -19,6 +19,9 @@
    accurately (see also XSecSplineList.cxx).
  @ Sep 07, 2009 - CA
    Integrated with GNU Numerical Library (GSL) via ROOT's MathMore library.
+ @ Oct 17, 2026 - agent
+   Added CacheBranchHandle() so that the cache branch name is only built
+   once per channel. The name includes a digest of the model configuration.
 
 */
 //____________________________________________________________________________
@@ -115,19 +118,20 @@ void ReinSeghalRESXSecWithCache::CacheResExcitationXSec(
 
          interaction->ExclTagPtr()->SetResonance(res);
 
-         // Get a unique cache branch name
-         string key = this->CacheBranchName(res, wkcur, nu_code, nuc_code);
+         // Get a unique cache branch
+         int handle = this->CacheBranchHandle(res, wkcur, nu_code, nuc_code);
 
          // Make sure the cache branch does not already exists
          CacheBranchFx * cache_branch =
-             dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+             dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
          assert(!cache_branch);
 
          // Create the new cache branch
          LOG("ReinSeghalResC", pNOTICE) 
-                        << "\n ** Creating cache branch - key = " << key;
+           << "\n ** Creating cache branch - key = " 
+           << cache->CacheBranchKey(handle);
          cache_branch = new CacheBranchFx("RES Excitation XSec");
-         cache->AddCacheBranch(key, cache_branch);
+         cache->AddCacheBranch(handle, cache_branch);
          assert(cache_branch);
 
          const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -230,10 +234,31 @@ string ReinSeghalRESXSecWithCache::CacheBranchName(
   intk << "ResExcitationXSec/R:" << res_name << ";nu:"  << nupdgc
            << ";int:" << it_name << nc_nuc;
       
-  string algkey = fSingleResXSecModel->Id().Key();
   string ikey   = intk.str();
-  string key    = cache->CacheBranchKey(algkey, ikey);
+  string key    = cache->CacheBranchKey(fSingleResXSecModel, ikey);
 
   return key;
 }
 //____________________________________________________________________________
+int ReinSeghalRESXSecWithCache::CacheBranchHandle(
+     Resonance_t res, InteractionType_t it, int nupdgc, int nucleonpdgc) const
+{
+// Get the cache branch handle for the current single resonance model and
+// the input channel. The cache branch name is only built at the first call.
+
+  int channel = 
+    ((((int)res * 32 + (int)it) * 128 + (nupdgc + 64)) * 2) + 
+    ((nucleonpdgc==kPdgProton) ? 1 : 0);
+  pair<const XSecAlgorithmI *, int> hkey(fSingleResXSecModel, channel);
+
+  map<pair<const XSecAlgorithmI *, int>, int>::const_iterator 
+                                        iter = fCacheHandles.find(hkey);
+  if(iter != fCacheHandles.end()) return iter->second;
+
+  string key = this->CacheBranchName(res, it, nupdgc, nucleonpdgc);
+  int handle = Cache::Instance()->CacheBranchHandle(key);
+  fCacheHandles[hkey] = handle;
+
+  return handle;
+}
+//____________________________________________________________________________
@@ -25,11 +25,16 @@
 #ifndef _REIN_SEGHAL_RES_XSEC_WITH_CACHE_H_
 #define _REIN_SEGHAL_RES_XSEC_WITH_CACHE_H_
 
+#include <map>
+
 #include "Base/XSecIntegratorI.h"
 #include "BaryonResonance/BaryonResList.h"
 #include "BaryonResonance/BaryonResonance.h"
 #include "Utils/Range1.h"
 
+using std::map;
+using std::pair;
+
 namespace genie {
 
 class ReinSeghalRESXSecWithCache : public XSecIntegratorI {
@@ -44,6 +49,7 @@ protected:
   // subclasses. Just define utility methods and data
   void   CacheResExcitationXSec (const Interaction * interaction) const;
   string CacheBranchName(Resonance_t r, InteractionType_t it, int nu, int nuc) const;
+  int    CacheBranchHandle(Resonance_t r, InteractionType_t it, int nu, int nuc) const;
 
   bool   fUsingDisResJoin;
   double fWcut;
@@ -51,6 +57,8 @@ protected:
 
   mutable const XSecAlgorithmI * fSingleResXSecModel;
   BaryonResList fResList;
+
+  mutable map<pair<const XSecAlgorithmI *, int>, int> fCacheHandles; ///< (model, channel) -> cache branch handle
 };
 
 }       // genie namespace
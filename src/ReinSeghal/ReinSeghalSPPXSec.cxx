@@ -10,7 +10,8 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
-
+ @ Oct 17, 2026 - agent
+   Access the free nucleon cache branches through integer handles.
 */
 //____________________________________________________________________________
 
@@ -88,12 +89,10 @@ double ReinSeghalSPPXSec::Integrate(
      //-- Get next resonance from the resonance list
      Resonance_t res = fResList.ResonanceId(ires);
 
-     //-- Build a unique name for the cache branch
-     string key = this->CacheBranchName(res, it, nu_pdgc, nucleon_pdgc);
-     LOG("ReinSeghalSpp", pINFO) 
-                            << "Finding cache branch with key: " << key;
+     //-- Get the cache branch handle for this resonance
+     int handle = this->CacheBranchHandle(res, it, nu_pdgc, nucleon_pdgc);
      CacheBranchFx * cache_branch =
-            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+            dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
 
      if(!cache_branch) {
        LOG("ReinSeghalSpp", pWARN)  
@@ -106,9 +105,10 @@ double ReinSeghalSPPXSec::Integrate(
 
        LOG("ReinSeghalSpp", pINFO) << "Done caching resonance xsec data";
        LOG("ReinSeghalSpp", pINFO) 
-               << "Finding newly created cache branch with key: " << key;
+               << "Finding newly created cache branch with key: " 
+               << cache->CacheBranchKey(handle);
        cache_branch =
-              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(handle));
        assert(cache_branch);
      }
      const CacheBranchFx & cbranch = (*cache_branch);
@@ -12,6 +12,9 @@
  Important revisions after version 2.0.0 :
  @ Jan 31, 2013 - CA
    Added in preparation for v2.8.0
+ @ Oct 17, 2026 - agent
+   XSecTable() also accepts binary spline archives (see gspl2bin).
+   Added MaxXSecTables().
 
 */
 //____________________________________________________________________________
@@ -23,6 +26,7 @@
 #include "Messenger/Messenger.h"
 #include "Numerical/RandomGen.h"
 #include "Utils/Cache.h"
+#include "Utils/MaxXSecTable.h"
 #include "Utils/XSecSplineList.h"
 #include "Utils/SystemUtils.h"
 #include "Utils/AppInit.h"
@@ -48,7 +52,8 @@ void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
   // file was specified & exists - load table
   if(utils::system::FileExists(inpfile)) {
     XSecSplineList * xspl = XSecSplineList::Instance();
-    XmlParserStatus_t status = xspl->LoadFromXml(inpfile);
+    XmlParserStatus_t status = XSecSplineList::IsBinary(inpfile) ?
+        xspl->LoadFromBinary(inpfile) : xspl->LoadFromXml(inpfile);
     if(status != kXmlOK) {
       LOG("AppInit", pFATAL)
          << "Problem reading file: " << inpfile;
@@ -104,4 +109,26 @@ void genie::utils::app_init::CacheFile(string inp_file)
   }
 }
 //___________________________________________________________________________
+void genie::utils::app_init::MaxXSecTables(string inp_file)
+{
+  // Load precomputed max differential cross-section tables, if a file was
+  // specified at the command-line.
+
+  if(inp_file.size() == 0) return;
+
+  if(!utils::system::FileExists(inp_file)) {
+     LOG("AppInit", pFATAL)
+        << "Input max xsec table file [" << inp_file << "] does not exist!";
+     gAbortingInErr = true;
+     exit(1);
+  }
+  XmlParserStatus_t status = MaxXSecTable::Instance()->LoadFromXml(inp_file);
+  if(status != kXmlOK) {
+     LOG("AppInit", pFATAL)
+        << "Problem reading file: " << inp_file;
+     gAbortingInErr = true;
+     exit(1);
+  }
+}
+//___________________________________________________________________________
 
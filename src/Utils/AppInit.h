@@ -30,6 +30,7 @@ namespace app_init
   void XSecTable      (string inpfile, bool require_table);
   void MesgThresholds (string inpfile);
   void CacheFile      (string inpfile);
+  void MaxXSecTables  (string inpfile);
 
 } // app_init namespace
 } // utils namespace
@@ -14,23 +14,45 @@
    Cache is not autoloaded and use of variables $GCACHEFILE is no longer
    supported. Instead, call Cache::OpenCacheFile(string filename) explicitly.
    Now cached data are stored in the top-level 'directory'.
+ @ Oct 17, 2026 - agent
+   Cache branches can be accessed through integer handles. Added keys which
+   include a digest of the algorithm configuration (including that of its
+   sub-algorithms and of the global parameter list). The cache file is no
+   longer kept open in 'update' mode: It is read when opened and rewritten
+   (under a lock, merging in branches saved by other jobs, and atomically
+   replaced) when the cache is deleted, so that it can be shared by many
+   concurrent jobs. Implemented RmCacheBranch() and RmMatchedCacheBranches().
 */
 //____________________________________________________________________________
 
 #include <sstream>
 #include <iostream>
+#include <iomanip>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
 
 #include <TSystem.h>
+#include <TFile.h>
 #include <TDirectory.h>
 #include <TList.h>
 #include <TObjString.h>
 
+#include "Algorithm/Algorithm.h"
+#include "Algorithm/AlgConfigPool.h"
 #include "Messenger/Messenger.h"
+#include "Registry/Registry.h"
 #include "Utils/Cache.h"
 #include "Utils/CacheBranchI.h"
 
 using std::ostringstream;
 using std::endl;
+using std::hex;
+using std::setw;
+using std::setfill;
+using std::setprecision;
 
 namespace genie {
 
@@ -45,31 +67,24 @@ Cache * Cache::fInstance = 0;
 //____________________________________________________________________________
 Cache::Cache()
 {
-  fInstance  = 0;
-  fCacheMap  = 0;
-  fCacheFile = 0;
+  fInstance       = 0;
+  fCacheFileName  = "";
 }
 //____________________________________________________________________________
 Cache::~Cache()
 {
   this->Save();
 
-  if(fCacheMap) {
-    map<string, CacheBranchI * >::iterator citer;
-    for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
-      CacheBranchI * branch = citer->second;
-      if(branch) {
-        delete branch;
-        branch = 0;
-      }
+  for(unsigned int ib = 0; ib < fBranches.size(); ib++) {
+    if(fBranches[ib]) {
+      delete fBranches[ib];
+      fBranches[ib] = 0;
     }
-    fCacheMap->clear();
-    delete fCacheMap;
-  }
-  if(fCacheFile) {
-    fCacheFile->Close();
-    delete fCacheFile;
   }
+  fBranches.clear();
+  fKeys.clear();
+  fHandleMap.clear();
+
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -80,23 +95,45 @@ Cache * Cache::Instance()
     cleaner.DummyMethodAndSilentCompiler();
 
     fInstance = new Cache;
-
-    fInstance->fCacheMap = new map<string, CacheBranchI * >;
   }
   return fInstance;
 }
 //____________________________________________________________________________
 CacheBranchI * Cache::FindCacheBranch(string key)
 {
-  map<string, CacheBranchI *>::const_iterator map_iter = fCacheMap->find(key);
+  map<string, int>::const_iterator map_iter = fHandleMap.find(key);
 
-  if (map_iter == fCacheMap->end()) return 0;
-  return map_iter->second;
+  if (map_iter == fHandleMap.end()) return 0;
+  return fBranches[map_iter->second];
 }
 //____________________________________________________________________________
 void Cache::AddCacheBranch(string key, CacheBranchI * branch)
 {
-  fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,branch) );
+  this->AddCacheBranch(this->CacheBranchHandle(key), branch);
+}
+//____________________________________________________________________________
+int Cache::CacheBranchHandle(string key)
+{
+// Returns the handle for the input key. A handle is assigned to the key at
+// the first call, even if no branch has been added yet. Handles remain valid
+// even if the branch is removed from the cache.
+
+  map<string, int>::const_iterator map_iter = fHandleMap.find(key);
+  if (map_iter != fHandleMap.end()) return map_iter->second;
+
+  int handle = fKeys.size();
+  fKeys    .push_back(key);
+  fBranches.push_back(0);
+  fHandleMap.insert(map<string, int>::value_type(key,handle));
+
+  return handle;
+}
+//____________________________________________________________________________
+void Cache::AddCacheBranch(int handle, CacheBranchI * branch)
+{
+  // keep an existing branch (as was done when inserting in a map)
+  if(fBranches[handle]) return;
+  fBranches[handle] = branch;
 }
 //____________________________________________________________________________
 string Cache::CacheBranchKey(string k0, string k1, string k2) const
@@ -110,26 +147,107 @@ string Cache::CacheBranchKey(string k0, string k1, string k2) const
   return key.str();
 }
 //____________________________________________________________________________
+string Cache::CacheBranchKey(const Algorithm * alg, string k1, string k2) const
+{
+// Build a key as: namespace::algorithm/config#digest/k1/k2
+
+  string k0 = alg->Id().Key() + "#" + Cache::ConfigDigest(alg);
+  return this->CacheBranchKey(k0, k1, k2);
+}
+//____________________________________________________________________________
+string Cache::ConfigDigest(const Algorithm * alg)
+{
+// Returns a 64-bit FNV-1a hash (as a hex string) of all the items of the
+// algorithm configuration registry (names, types & values), of the registries
+// of all the sub-algorithms it refers to (recursively, as found in the
+// AlgConfigPool) and of the global parameter list.
+// This is not meant to be called for every event: Cache the key or, better,
+// the corresponding handle.
+
+  ostringstream config;
+  config << setprecision(17);
+
+  set<string> algs;
+  algs.insert(alg->Id().Key());
+  Cache::PrintConfig(alg->GetConfig(), config, algs);
+
+  Registry * gc = AlgConfigPool::Instance()->GlobalParameterList();
+  if(gc) {
+    config << "GlobalParameterList{";
+    Cache::PrintConfig(*gc, config, algs);
+    config << "}";
+  }
+
+  string sconfig = config.str();
+  ULong64_t hash = 14695981039346656037ULL;
+  for(unsigned int i = 0; i < sconfig.size(); i++) {
+    hash ^= (unsigned char) sconfig[i];
+    hash *= 1099511628211ULL;
+  }
+
+  ostringstream digest;
+  digest << hex << setw(16) << setfill('0') << hash;
+  return digest.str();
+}
+//____________________________________________________________________________
+void Cache::PrintConfig(
+       const Registry & config, ostringstream & out, set<string> & algs)
+{
+// Print all the items of the input registry (names, types & values). The
+// configuration of each sub-algorithm is printed, once, after its name.
+
+  const RgIMap & items = config.GetItemMap();
+  RgIMapConstIter iter = items.begin();
+  for( ; iter != items.end(); ++iter) {
+    RegistryItemI * ritem = iter->second;
+    if(!ritem) continue;
+    ostringstream value;
+    value << setprecision(17);
+    ritem->Print(value);
+    // drop the lock / local status printed before the value
+    string svalue = value.str();
+    string::size_type pos = svalue.find(" : ");
+    if(pos != string::npos) svalue = svalue.substr(pos+3);
+    out << iter->first << ";" << RgType::AsString(ritem->TypeInfo())
+        << ";" << svalue << ";";
+
+    if(ritem->TypeInfo() != kRgAlg) continue;
+    const RgAlg & subalg = 
+         dynamic_cast<const RegistryItem<RgAlg> *> (ritem)->Data();
+    AlgId id(subalg.name, subalg.config);
+    if(algs.count(id.Key()) > 0) continue;
+    algs.insert(id.Key());
+    Registry * subconfig = AlgConfigPool::Instance()->FindRegistry(id);
+    if(!subconfig) continue;
+    out << "{";
+    Cache::PrintConfig(*subconfig, out, algs);
+    out << "}";
+  }
+}
+//____________________________________________________________________________
 void Cache::RmCacheBranch(string key)
 {
   LOG("Cache", pNOTICE) << "Removing cache branch: " << key;
 
+  map<string, int>::const_iterator map_iter = fHandleMap.find(key);
+  if (map_iter == fHandleMap.end()) return;
+
+  int handle = map_iter->second;
+  if(fBranches[handle]) {
+    delete fBranches[handle];
+    fBranches[handle] = 0;
+  }
 }
 //____________________________________________________________________________
 void Cache::RmAllCacheBranches(void)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches";
 
-  if(fCacheMap) {
-    map<string, CacheBranchI * >::iterator citer;
-    for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
-      CacheBranchI * branch = citer->second;
-      if(branch) {
-        delete branch;
-        branch = 0;
-      }
+  for(unsigned int ib = 0; ib < fBranches.size(); ib++) {
+    if(fBranches[ib]) {
+      delete fBranches[ib];
+      fBranches[ib] = 0;
     }
-    fCacheMap->clear();
   }
 }
 //____________________________________________________________________________
@@ -137,14 +255,33 @@ void Cache::RmMatchedCacheBranches(string key_substring)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches: *"<< key_substring<< "*";
 
+  for(unsigned int ib = 0; ib < fBranches.size(); ib++) {
+    if(!fBranches[ib]) continue;
+    if(fKeys[ib].find(key_substring) == string::npos) continue;
+    delete fBranches[ib];
+    fBranches[ib] = 0;
+  }
 }
 //____________________________________________________________________________
 void Cache::Load(void)
 {
   LOG("Cache", pNOTICE) << "Loading cache";
 
-  if(!fCacheFile) return;
-  TList * keys = (TList*) fCacheFile->Get("key_list");
+  if(fCacheFileName.size() == 0) return;
+  if(gSystem->AccessPathName(fCacheFileName.c_str())) {
+    LOG("Cache", pNOTICE)
+      << "Cache file: " << fCacheFileName << " doesn't exist yet";
+    return;
+  }
+
+  TFile * file = TFile::Open(fCacheFileName.c_str(), "read");
+  if(!file || !file->IsOpen()) {
+    LOG("Cache", pWARN) << "Could not read cache file: " << fCacheFileName;
+    if(file) delete file;
+    return;
+  }
+
+  TList * keys = (TList*) file->Get("key_list");
   TIter kiter(keys);
   TObjString * keyobj = 0;
   int ib=0;
@@ -152,62 +289,132 @@ void Cache::Load(void)
     string key = string(keyobj->GetString().Data());
     ostringstream bname;
     bname << "buffer_" << ib++;
-    CacheBranchI * buffer = (CacheBranchI*) fCacheFile->Get(bname.str().c_str());
+    CacheBranchI * buffer = (CacheBranchI*) file->Get(bname.str().c_str());
     if(buffer) {
-     fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,buffer) );
+      this->AddCacheBranch(key, buffer);
     }
   }
+  if(keys) {
+    keys->SetOwner(true);
+    delete keys;
+  }
+
+  file->Close();
+  delete file;
+
   LOG("Cache", pNOTICE) << "Cache loaded...";
   LOG("Cache", pNOTICE) << *this;
 }
 //____________________________________________________________________________
 void Cache::Save(void)
 {
-  if(!fCacheFile) {
+// Writes all cache branches in a temporary file, adds any branches found
+// in the current cache file (eg written by another job since this one was
+// started) and then renames the temporary file to the cache file.
+// Saving is serialized across jobs using a lock file.
+
+  if(fCacheFileName.size() == 0) return;
+
+  string lock_file = fCacheFileName + ".lock";
+  int lock_fd = open(lock_file.c_str(), O_RDWR | O_CREAT, 0644);
+  if(lock_fd < 0 || flock(lock_fd, LOCK_EX) != 0) {
+    LOG("Cache", pERROR)
+      << "Could not lock cache file: " << fCacheFileName << " - Not saved";
+    if(lock_fd >= 0) close(lock_fd);
+    return;
+  }
+
+  ostringstream tmp_file;
+  tmp_file << fCacheFileName << ".tmp." << getpid();
+
+  TDirectory * cwd = gDirectory;
+
+  TFile * outf = new TFile(tmp_file.str().c_str(), "recreate");
+  if(!outf->IsOpen()) {
+    LOG("Cache", pERROR)
+      << "Could not create file: " << tmp_file.str() << " - Cache not saved";
+    delete outf;
+    flock(lock_fd, LOCK_UN);
+    close(lock_fd);
     return;
   }
-  fCacheFile->cd();
 
   int ib=0;
   TList * keys = new TList;
   keys->SetOwner(true);
 
-  map<string, CacheBranchI * >::iterator citer;
-  for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
-    string key = citer->first;
-    CacheBranchI * branch = citer->second;
+  for(unsigned int ih = 0; ih < fBranches.size(); ih++) {
+    CacheBranchI * branch = fBranches[ih];
     if(branch) {
       ostringstream bname;
       bname << "buffer_" << ib++;
-      keys->Add(new TObjString(key.c_str()));
+      keys->Add(new TObjString(fKeys[ih].c_str()));
+      outf->cd();
       branch->Write(bname.str().c_str(), TObject::kOverwrite);
     }
   }
-  keys->Write("key_list", TObject::kSingleKey&&TObject::kOverwrite);
+
+  // merge branches saved in the cache file and not present in this job
+  if(!gSystem->AccessPathName(fCacheFileName.c_str())) {
+    TFile * inpf = TFile::Open(fCacheFileName.c_str(), "read");
+    if(inpf && inpf->IsOpen()) {
+      TList * inp_keys = (TList*) inpf->Get("key_list");
+      TIter kiter(inp_keys);
+      TObjString * keyobj = 0;
+      int jb=0;
+      while ((keyobj = (TObjString *)kiter.Next())) {
+        string key = string(keyobj->GetString().Data());
+        ostringstream inp_bname;
+        inp_bname << "buffer_" << jb++;
+        if(this->FindCacheBranch(key)) continue;
+        TObject * buffer = inpf->Get(inp_bname.str().c_str());
+        if(!buffer) continue;
+        ostringstream bname;
+        bname << "buffer_" << ib++;
+        keys->Add(new TObjString(key.c_str()));
+        outf->cd();
+        buffer->Write(bname.str().c_str(), TObject::kOverwrite);
+        delete buffer;
+      }
+      if(inp_keys) {
+        inp_keys->SetOwner(true);
+        delete inp_keys;
+      }
+      inpf->Close();
+    }
+    if(inpf) delete inpf;
+  }
+
+  outf->cd();
+  keys->Write("key_list", TObject::kSingleKey);
+  outf->Close();
+  delete outf;
 
   keys->Clear();
   delete keys;
+
+  if(cwd) cwd->cd();
+
+  if(rename(tmp_file.str().c_str(), fCacheFileName.c_str()) != 0) {
+    LOG("Cache", pERROR)
+      << "Could not rename " << tmp_file.str() << " to " << fCacheFileName;
+    unlink(tmp_file.str().c_str());
+  } else {
+    LOG("Cache", pNOTICE)
+      << "Saved " << ib << " cache branches in: " << fCacheFileName;
+  }
+
+  flock(lock_fd, LOCK_UN);
+  close(lock_fd);
 }
 //____________________________________________________________________________
 void Cache::OpenCacheFile(string filename)
 {
   if(filename.size() == 0) return;
 
-  if(fCacheFile) {
-    if(fCacheFile->IsOpen()) {
-       delete fCacheFile;
-       fCacheFile = 0;
-    }
-  }
-
   LOG("Cache", pNOTICE) << "Using cache file: " << filename;
 
-  fCacheFile = new TFile(filename.c_str(),"update");
-  if(!fCacheFile->IsOpen()) {
-     delete fCacheFile;
-     fCacheFile = 0;
-     LOG("Cache", pWARN) << "Could not open cache file: " << filename;
-  }
+  fCacheFileName = filename;
 
   this->Load();
 }
@@ -216,12 +423,9 @@ void Cache::Print(ostream & stream) const
 {
   stream << "\n [-] GENIE Cache Buffers:";
   stream << "\n  |";
-  map<string, CacheBranchI * >::iterator citer;
-  for(citer = fCacheMap->begin(); citer != fCacheMap->end(); ++citer) {
-    string key = citer->first;
-    CacheBranchI * branch = citer->second;
-    stream << "\n  |--o  " << key;
-    if(!branch) {
+  for(unsigned int ih = 0; ih < fKeys.size(); ih++) {
+    stream << "\n  |--o  " << fKeys[ih];
+    if(!fBranches[ih]) {
       stream << " *** NULL *** ";
     }
   }
@@ -231,4 +435,3 @@ void Cache::Print(ostream & stream) const
 
 } // genie namespace
 
-
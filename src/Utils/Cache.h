@@ -5,6 +5,21 @@
 
 \brief    GENIE Cache Memory
 
+          Cache branches are identified by a string key. Keys built with
+          CacheBranchKey(const Algorithm*,...) include a digest of the
+          algorithm configuration (including the configuration of all its
+          sub-algorithms and the global parameter list), so that a cache file
+          can be safely reused by any job: data computed with a different
+          configuration are simply stored under a different key.
+          Frequent look-ups should use the integer handle returned by
+          CacheBranchHandle() rather than the string key.
+
+          The cache file is read once, when opened, and is rewritten when the
+          cache is deleted. Many jobs may share the same cache file: The file
+          is rewritten under an exclusive lock, merging in any branches saved
+          by other jobs in the meantime, and is replaced atomically so that
+          readers never see a partially written file.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
 
@@ -20,18 +35,24 @@
 #define _CACHE_H_
 
 #include <map>
+#include <set>
+#include <vector>
 #include <string>
 #include <ostream>
-
-#include <TFile.h>
+#include <sstream>
 
 using std::map;
+using std::set;
+using std::vector;
 using std::string;
 using std::ostream;
+using std::ostringstream;
 
 namespace genie {
 
 class CacheBranchI;
+class Algorithm;
+class Registry;
 
 class Cache
 {
@@ -46,6 +67,16 @@ public:
   CacheBranchI * FindCacheBranch (string key);
   void           AddCacheBranch  (string key, CacheBranchI * branch);
   string         CacheBranchKey  (string k0, string k1="", string k2="") const;
+  string         CacheBranchKey  (const Algorithm * alg, string k1="", string k2="") const;
+
+  //! integer handles for fast look-ups (valid for the lifetime of the cache)
+  int            CacheBranchHandle (string key);
+  CacheBranchI * FindCacheBranch   (int handle) const { return fBranches[handle]; }
+  void           AddCacheBranch    (int handle, CacheBranchI * branch);
+  const string & CacheBranchKey    (int handle) const { return fKeys[handle];     }
+
+  //! digest of the algorithm configuration (used in cache branch keys)
+  static string ConfigDigest (const Algorithm * alg);
 
   //! removing cache branches
   void RmCacheBranch         (string key);
@@ -62,12 +93,17 @@ private:
   void Load (void);
   void Save (void);
 
+  //! print a configuration registry (& the ones of its sub-algorithms) for ConfigDigest()
+  static void PrintConfig (const Registry & config, ostringstream & out, set<string> & algs);
+
   //! singleton instance
   static Cache * fInstance;
 
-  //! map of cache buffers & cache file
-  map<string, CacheBranchI * > * fCacheMap;
-  TFile *                        fCacheFile;
+  //! cache buffers & cache file
+  map<string, int>      fHandleMap;     ///< key -> handle
+  vector<string>        fKeys;          ///< key, per handle
+  vector<CacheBranchI*> fBranches;      ///< cache branch (owned), per handle
+  string                fCacheFileName; ///< cache file (empty if none)
 
   //! singleton class: constructors are private
   Cache();
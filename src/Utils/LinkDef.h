@@ -30,6 +30,7 @@
 #pragma link C++ class genie::CacheBranchFx;
 #pragma link C++ class genie::CmdLnArgParser;
 #pragma link C++ class genie::XSecSplineList;
+#pragma link C++ class genie::MaxXSecTable;
 #pragma link C++ class genie::NaturalIsotopeElementData;
 #pragma link C++ class genie::NaturalIsotopes;
 #pragma link C++ class genie::Range1D_t;
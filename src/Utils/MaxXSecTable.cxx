@@ -0,0 +1,256 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: agent <agent \at local>
+
+ For the class documentation see the corresponding header file.
+
+ Important revisions after version 2.0.0 :
+
+*/
+//____________________________________________________________________________
+
+#include <fstream>
+#include <iomanip>
+#include <cstdlib>
+#include <algorithm>
+#include <cassert>
+
+#include "libxml/parser.h"
+#include "libxml/xmlmemory.h"
+#include "libxml/xmlreader.h"
+
+#include <TMath.h>
+
+#include "Messenger/Messenger.h"
+#include "Utils/MaxXSecTable.h"
+#include "Utils/StringUtils.h"
+
+using std::ofstream;
+using std::endl;
+using std::setprecision;
+using std::scientific;
+
+namespace genie {
+
+//____________________________________________________________________________
+ostream & operator << (ostream & stream, const MaxXSecTable & table)
+{
+  table.Print(stream);
+  return stream;
+}
+//____________________________________________________________________________
+MaxXSecTable * MaxXSecTable::fInstance = 0;
+//____________________________________________________________________________
+MaxXSecTable::MaxXSecTable()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+MaxXSecTable::~MaxXSecTable()
+{
+  fTableMap.clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+MaxXSecTable * MaxXSecTable::Instance()
+{
+  if(fInstance == 0) {
+    static MaxXSecTable::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+
+    fInstance = new MaxXSecTable;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+bool MaxXSecTable::TableExists(string key) const
+{
+  return (fTableMap.count(key) == 1);
+}
+//____________________________________________________________________________
+double MaxXSecTable::Evaluate(string key, double E) const
+{
+  map<string, pair< vector<double>, vector<double> > >::const_iterator
+     iter = fTableMap.find(key);
+  if(iter == fTableMap.end()) return -1;
+
+  const vector<double> & vE    = iter->second.first;
+  const vector<double> & vxsec = iter->second.second;
+
+  if(vE.size() == 0 || E < vE.front() || E > vE.back()) return -1;
+
+  // first tabulated energy > E
+  int i = std::upper_bound(vE.begin(), vE.end(), E) - vE.begin();
+  if(i == (int)vE.size()) return vxsec.back(); // E == Emax
+  if(i == 0) return vxsec.front();
+
+  return TMath::Max(vxsec[i-1], vxsec[i]);
+}
+//____________________________________________________________________________
+void MaxXSecTable::AddTable(
+   string key, const vector<double> & E, const vector<double> & max_xsec)
+{
+  assert(E.size() == max_xsec.size());
+
+  LOG("MaxXSecTable", pINFO)
+     << "Adding max xsec table: " << key << " (" << E.size() << " knots)";
+
+  fTableMap[key] = pair< vector<double>, vector<double> > (E, max_xsec);
+}
+//____________________________________________________________________________
+void MaxXSecTable::SaveAsXml(string filename) const
+{
+  LOG("MaxXSecTable", pNOTICE)
+       << "Saving max xsec tables as XML in file: " << filename;
+
+  ofstream outxml(filename.c_str());
+  if(!outxml.is_open()) {
+    LOG("MaxXSecTable", pERROR) << "Couldn't create file = " << filename;
+    return;
+  }
+  outxml << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
+  outxml << endl << endl;
+  outxml << "<!-- generated by genie::MaxXSecTable::SaveAsXml() -->";
+  outxml << endl << endl;
+
+  outxml << "<genie_max_xsec_tables version=\"" << MaxXSecTable::Version() << "\">";
+  outxml << endl << endl;
+
+  // values are written with enough digits to be read back exactly
+  outxml << scientific << setprecision(17);
+
+  map<string, pair< vector<double>, vector<double> > >::const_iterator iter;
+  for(iter = fTableMap.begin(); iter != fTableMap.end(); ++iter) {
+    const vector<double> & vE    = iter->second.first;
+    const vector<double> & vxsec = iter->second.second;
+    outxml << "<table name=\"" << iter->first
+           << "\" nknots=\"" << vE.size() << "\">" << endl;
+    for(unsigned int i = 0; i < vE.size(); i++) {
+      outxml << "\t<knot> <E> " << vE[i] << " </E> <max_xsec> "
+             << vxsec[i] << " </max_xsec> </knot>" << endl;
+    }
+    outxml << "</table>" << endl;
+  }
+  outxml << "</genie_max_xsec_tables>";
+  outxml << endl;
+
+  outxml.close();
+}
+//____________________________________________________________________________
+XmlParserStatus_t MaxXSecTable::LoadFromXml(string filename, bool keep)
+{
+// Load max xsec tables from XML file. If keep = true, then the loaded tables
+// are added to the existing ones. If false, then the existing tables are
+// removed before loading.
+// Files written using a different version of the table format are rejected.
+
+  LOG("MaxXSecTable", pNOTICE) << "Loading max xsec tables from: " << filename;
+
+  if(!keep) fTableMap.clear();
+
+  const int kNodeTypeStartElement = 1;
+  const int kNodeTypeEndElement   = 15;
+  const int kKnotX                = 0;
+  const int kKnotY                = 1;
+
+  xmlTextReaderPtr reader;
+
+  int ret = 0, val_type = -1;
+  vector<double> E, max_xsec;
+  string table_name = "";
+
+  reader = xmlNewTextReaderFilename(filename.c_str());
+  if (reader == NULL) {
+    LOG("MaxXSecTable", pERROR)
+          << "\nXML file could not be found! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+
+  ret = xmlTextReaderRead(reader);
+  while (ret == 1) {
+      xmlChar * name  = xmlTextReaderName     (reader);
+      xmlChar * value = xmlTextReaderValue    (reader);
+      int       type  = xmlTextReaderNodeType (reader);
+      int       depth = xmlTextReaderDepth    (reader);
+
+      if(depth==0 && type==kNodeTypeStartElement) {
+         bool valid_root =
+            !xmlStrcmp(name, (const xmlChar *) "genie_max_xsec_tables");
+         string svrs = "";
+         if(valid_root) {
+           xmlChar * xvrs = xmlTextReaderGetAttribute(reader,(const xmlChar*)"version");
+           if(xvrs) svrs = utils::str::TrimSpaces((const char *)xvrs);
+           xmlFree(xvrs);
+         }
+         if(!valid_root || svrs != MaxXSecTable::Version()) {
+           LOG("MaxXSecTable", pERROR)
+             << "\nXML doc. has invalid root element or unsupported version ("
+             << svrs << ", expected: " << MaxXSecTable::Version()
+             << ")! [filename: " << filename << "]";
+           xmlFree(name);
+           xmlFree(value);
+           xmlFreeTextReader(reader);
+           return kXmlInvalidRoot;
+         }
+      }
+
+      if( (!xmlStrcmp(name, (const xmlChar *) "table")) && type==kNodeTypeStartElement) {
+         xmlChar * xname = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
+         table_name = utils::str::TrimSpaces((const char *)xname);
+         xmlFree(xname);
+         E.clear();
+         max_xsec.clear();
+      }
+      if( (!xmlStrcmp(name, (const xmlChar *) "E"))        && type==kNodeTypeStartElement) { val_type = kKnotX; }
+      if( (!xmlStrcmp(name, (const xmlChar *) "max_xsec")) && type==kNodeTypeStartElement) { val_type = kKnotY; }
+
+      if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==4) {
+          if      (val_type==kKnotX) E       .push_back( atof((const char *)value) );
+          else if (val_type==kKnotY) max_xsec.push_back( atof((const char *)value) );
+      }
+      if( (!xmlStrcmp(name, (const xmlChar *) "table")) && type==kNodeTypeEndElement) {
+         if(E.size() == max_xsec.size()) {
+           fTableMap[table_name] =
+               pair< vector<double>, vector<double> > (E, max_xsec);
+         } else {
+           LOG("MaxXSecTable", pWARN) << "Skipping malformed table: " << table_name;
+         }
+      }
+
+      xmlFree(name);
+      xmlFree(value);
+      ret = xmlTextReaderRead(reader);
+  }
+  xmlFreeTextReader(reader);
+  if (ret != 0) {
+    LOG("MaxXSecTable", pERROR)
+      << "\nXML file could not be parsed! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+
+  LOG("MaxXSecTable", pNOTICE) << "Loaded " << fTableMap.size() << " tables";
+
+  return kXmlOK;
+}
+//____________________________________________________________________________
+void MaxXSecTable::Print(ostream & stream) const
+{
+  stream << "\n ******************* MaxXSecTable *************************";
+  stream << "\n [-] Format version: " << MaxXSecTable::Version();
+  stream << "\n [-] Available tables:";
+  stream << "\n  |";
+
+  map<string, pair< vector<double>, vector<double> > >::const_iterator iter;
+  for(iter = fTableMap.begin(); iter != fTableMap.end(); ++iter) {
+    stream << "\n  |-----o  " << iter->first
+           << " (" << iter->second.first.size() << " knots)";
+  }
+  stream << "\n";
+}
+//____________________________________________________________________________
+
+} // genie namespace
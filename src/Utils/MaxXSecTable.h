@@ -0,0 +1,97 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::MaxXSecTable
+
+\brief    Precomputed tables of the maximum differential cross section used
+          by the kinematics generators (see KineGeneratorWithCache) in the
+          rejection method, as a function of energy.
+          Normally, each kinematics generator computes these values on the
+          fly and caches them during the job, so the first events of every
+          job are slow. The tables can be built offline (see gmkmaxxsec),
+          saved in an XML file and loaded at the start of an MC job.
+
+          Tables are keyed by kinematics generator algorithm / configuration,
+          by cross section model / configuration and by interaction (same key
+          as for the cache branches used by KineGeneratorWithCache). Between two tabulated energies the larger
+          of the two tabulated values is returned, so that the envelope is
+          never below the one obtained by linear interpolation.
+
+\author   agent <agent \at local>
+
+\created  October 17, 2026
+
+\cpright  Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _MAX_XSEC_TABLE_H_
+#define _MAX_XSEC_TABLE_H_
+
+#include <ostream>
+#include <map>
+#include <vector>
+#include <string>
+
+#include "Conventions/XmlParserStatus.h"
+
+using std::map;
+using std::pair;
+using std::vector;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class MaxXSecTable {
+
+public:
+
+  static MaxXSecTable * Instance();
+
+  // Query / access / add tables
+  bool   TableExists (string key) const;
+  double Evaluate    (string key, double E) const; ///< returns -1 if no value is tabulated for E
+  void   AddTable    (string key, const vector<double> & E, const vector<double> & max_xsec);
+
+  int    NTables     (void) const { return fTableMap.size();        }
+  bool   IsEmpty     (void) const { return (fTableMap.size() == 0); }
+
+  // Save/load to/from XML file
+  void              SaveAsXml   (string filename) const;
+  XmlParserStatus_t LoadFromXml (string filename, bool keep = false);
+
+  // Print available tables
+  void   Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const MaxXSecTable & table);
+
+  // Version of the XML table file format
+  static string Version (void) { return "1.00"; }
+
+private:
+
+  MaxXSecTable();
+  MaxXSecTable(const MaxXSecTable & table);
+  virtual ~MaxXSecTable();
+
+  static MaxXSecTable * fInstance;
+
+  map<string, pair< vector<double>, vector<double> > > fTableMap; ///< kine_alg_name/param_set/interaction -> (E, max_xsec)
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (MaxXSecTable::fInstance !=0) {
+            delete MaxXSecTable::fInstance;
+            MaxXSecTable::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _MAX_XSEC_TABLE_H_
@@ -28,6 +28,9 @@
    reweighting. 
  @ Jul 15, 2010 - AM
    Added BindEnergy(int nucA, int nucZ), used in Intranuke
+ @ Oct 17, 2026 - agent
+   Added DensityParams(), factored out of Density(), and a Density() variant
+   evaluating the density at many radial positions at once.
 
 */
 //____________________________________________________________________________
@@ -347,6 +350,62 @@ double genie::utils::nuclear::DISNuclFactor(double x, int A)
 double genie::utils::nuclear::Density(double r, int A, double ring)
 {
 // [by S.Dytman]
+//
+  double p1 = 0, p2 = 0;
+  bool woods_saxon = DensityParams(A, p1, p2);
+
+  if(woods_saxon) {
+    LOG("Nuclear",pINFO)
+	<< "r= " << r << ", ring= " << ring;
+    double rho = DensityWoodsSaxon(r,p1,p2,ring);
+    return rho;
+  }
+  else {
+    double rho = DensityGaus(r,p1,p2,ring);
+    return rho;
+  }
+
+  return 0;
+}
+//___________________________________________________________________________
+void genie::utils::nuclear::Density(
+               int n, const double * r, int A, double ring, double * dens)
+{
+// Same as Density(r,A,ring) at n radial positions, with the density profile
+// parameters looked-up once. Used for stepping hadrons in the nucleus.
+// The arithmetic is kept identical to DensityWoodsSaxon() / DensityGaus().
+//
+  double p1 = 0, p2 = 0;
+  bool woods_saxon = DensityParams(A, p1, p2);
+
+  if(woods_saxon) {
+    double c = p1, z = p2;
+    ring = TMath::Min(ring, 0.75*c);
+    double ceval = c + ring;
+    double norm  = (3./(4.*kPi*TMath::Power(c,3)))*1./(1.+TMath::Power((kPi*z/c),2));
+    for(int i = 0; i < n; i++) {
+      dens[i] = norm / (1 + TMath::Exp((r[i]-ceval)/z));
+    }
+  }
+  else {
+    double a = p1, alf = p2;
+    ring = TMath::Min(ring, 0.3*a);
+    double aeval = a + ring;
+    double norm  = 1./((5.568 + alf*8.353)*TMath::Power(a,3.));
+    for(int i = 0; i < n; i++) {
+      double b = TMath::Power(r[i]/aeval, 2.);
+      dens[i]  = norm * (1. + alf*b) * TMath::Exp(-b);
+    }
+  }
+}
+//___________________________________________________________________________
+bool genie::utils::nuclear::DensityParams(int A, double & p1, double & p2)
+{
+// [by S.Dytman]
+//
+// Nuclear density profile parameters used by Density(): Returns true for a
+// Woods-Saxon profile (p1 = c, p2 = z) and false for a modified harmonic
+// oscillator one (p1 = a, p2 = alf)
 //
   if(A>20) {
     double c = 1., z = 1.;
@@ -360,10 +419,8 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
        c = TMath::Power(A,0.35); z = 0.54; 
     } //others
 
-    LOG("Nuclear",pINFO)
-	<< "r= " << r << ", ring= " << ring;
-    double rho = DensityWoodsSaxon(r,c,z,ring);
-    return rho;
+    p1 = c; p2 = z;
+    return true;
   }
   else if (A>4) {
     double ap = 1., alf = 1.;
@@ -376,18 +433,16 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
       ap=1.75; alf=-0.4+.12*A; 
     }  //others- alf=0.08 if A=4
 
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
+    p1 = ap; p2 = alf;
+    return false;
   }
   else {
     // helium
     double ap = 1.9/TMath::Sqrt(2.);  
     double alf=0.;    
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
+    p1 = ap; p2 = alf;
+    return false;
   }
-
-  return 0;
 }
 //___________________________________________________________________________
 double genie::utils::nuclear::DensityGaus(
@@ -55,6 +55,8 @@ namespace nuclear
   double DISNuclFactor (double x, int A);
 
   double Density           (double r, int A, double ring=0.);
+  void   Density           (int n, const double * r, int A, double ring, double * dens);
+  bool   DensityParams     (int A, double & p1, double & p2);
   double DensityGaus       (double r, double ap, double alf, double ring=0.);
   double DensityWoodsSaxon (double r, double c, double z, double ring=0.);
 
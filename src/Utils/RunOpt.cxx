@@ -12,6 +12,8 @@
  Important revisions after version 2.0.0 :
  @ Jan 29, 2013 - CA
    Added in preparartion for v2.8.0, when use of env. vars was phased out.
+ @ Oct 17, 2026 - agent
+   Added the --max-xsec-tables option.
 
 */
 //____________________________________________________________________________
@@ -65,6 +67,7 @@ void RunOpt::Init(void)
 {
   fEnableBareXSecPreCalc = true;
   fCacheFile = "";
+  fMaxXSecTableFile = "";
   fMesgThresholds = "";
   fUnphysEventMask = new TBits(GHepFlags::NFlags());
 //fUnphysEventMask->ResetAllBits(true);
@@ -91,6 +94,10 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
     fCacheFile = parser.ArgAsString("cache-file");
   }
 
+  if( parser.OptionExists("max-xsec-tables") ) {
+    fMaxXSecTableFile = parser.ArgAsString("max-xsec-tables");
+  }
+
   if( parser.OptionExists("message-thresholds") ) {
     fMesgThresholds = parser.ArgAsString("message-thresholds");
   }
@@ -128,6 +135,7 @@ void RunOpt::Print(ostream & stream) const
   stream << "\n Event generator list: " << fEventGeneratorList;
   stream << "\n User-specified message thresholds : " << fMesgThresholds;
   stream << "\n Cache file : " << fCacheFile;
+  stream << "\n Max differential xsec tables : " << fMaxXSecTableFile;
   stream << "\n Unphysical event mask (bits: "
          << GHepFlags::NFlags()-1 << " -> 0) : " << *fUnphysEventMask;
   stream << "\n Event record print level : " << fEventRecordPrintLevel;
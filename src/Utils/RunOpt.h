@@ -39,6 +39,7 @@ public:
   // Get options set.
   string EventGeneratorList     (void) const { return fEventGeneratorList;     }
   string CacheFile              (void) const { return fCacheFile;              }
+  string MaxXSecTableFile       (void) const { return fMaxXSecTableFile;       }
   string MesgThresholdFiles     (void) const { return fMesgThresholds;         }
   TBits* UnphysEventMask        (void) const { return fUnphysEventMask;        }
   int    EventRecordPrintLevel  (void) const { return fEventRecordPrintLevel;  }
@@ -61,6 +62,7 @@ private:
   // options
   string fEventGeneratorList;        ///< Name of event generator list to be loaded by the event generation drivers. This used to be set by $GEVGL.
   string fCacheFile;                 ///< Name of cache file, is cache is to be re-used. This used to be set by the $GCACHEFILE.
+  string fMaxXSecTableFile;          ///< Name of XML file with precomputed max differential xsec tables (see MaxXSecTable).
   string fMesgThresholds;            ///< List of files (delimited with : if more than one) with custom mesg stream thresholds. This used to be set by $GMSGCONF.
   TBits* fUnphysEventMask;           ///< Unphysical event mask. This used to be set by $GUNPHYSMASK.
   int    fEventRecordPrintLevel;     ///< GHEP event r ecord print level. This used to be set by $GHEPPRINTLEVEL
@@ -35,12 +35,25 @@
    Demote a few messages.
  @ Jan 24, 2013 - CA
    Use of variables $GSPLOAD and $GSPSAVE is no longer supported.
+ @ Oct 17, 2026 - agent
+   Added SaveAsBinary() and LoadFromBinary() for binary spline archives.
+   Archives are memory-mapped and each spline is only built the first time
+   it is requested.
+   GetSpline(alg,interaction) looks-up splines using the algorithm address
+   and the 64-bit interaction code (see Interaction::Key()), building the
+   string spline key only the first time a spline is requested.
 
 */
 //____________________________________________________________________________
 
 #include <fstream>
 #include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -61,10 +74,42 @@
 #include "Utils/XmlParserUtils.h"
 
 using std::ofstream;
+using std::ifstream;
 using std::endl;
+using std::ios;
 
 namespace genie {
 
+//____________________________________________________________________________
+// Binary spline archive layout (all numbers in the native byte order):
+// - header (see XSecSplArchiveHeader)
+// - index: one entry per spline, sorted by spline key (see XSecSplArchiveEntry)
+// - keys : all spline keys, concatenated (not null-terminated)
+// - knots: for each spline, the knot energies followed by the knot xsecs
+//
+namespace {
+  const char   kXSecSplArchiveMagic[8] = {'G','E','N','I','E','X','S','B'};
+  const UInt_t kXSecSplArchiveVersion  = 1;
+  const UInt_t kXSecSplArchiveBOM      = 0x01020304;
+
+  struct XSecSplArchiveHeader {
+    char      magic[8];      // kXSecSplArchiveMagic
+    UInt_t    version;       // kXSecSplArchiveVersion
+    UInt_t    bom;           // kXSecSplArchiveBOM, to catch byte order mismatches
+    UInt_t    uselog;        // XSecSplineList::UseLogE()
+    UInt_t    nsplines;      // number of splines
+    ULong64_t index_offset;  // position of the index in the file
+    ULong64_t keys_offset;   // position of the keys in the file
+    ULong64_t knots_offset;  // position of the knot data in the file
+  };
+  struct XSecSplArchiveEntry {
+    ULong64_t key_offset;    // relative to keys_offset
+    UInt_t    key_length;
+    UInt_t    nknots;
+    ULong64_t knots_offset;  // relative to knots_offset
+  };
+}
+
 //____________________________________________________________________________
 ostream & operator << (ostream & stream, const XSecSplineList & list)
 {
@@ -81,6 +126,13 @@ XSecSplineList::XSecSplineList()
   fNKnots      = 100;
   fEmin        =   0.01; // GeV
   fEmax        = 100.00; // GeV
+
+  fArchiveFile = "";
+  fArchiveData = 0;
+  fArchiveSize = 0;
+  fArchiveNSpl = 0;
+
+  fNResets     = 0;
 }
 //____________________________________________________________________________
 XSecSplineList::~XSecSplineList()
@@ -97,6 +149,7 @@ XSecSplineList::~XSecSplineList()
       spline = 0;
     }
   }
+  this->CloseArchive();
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -114,6 +167,9 @@ XSecSplineList * XSecSplineList::Instance()
 bool XSecSplineList::SplineExists(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
+  if(fSplineCache.count(SplineCacheKey(alg, interaction->Key())) == 1) {
+    return true;
+  }
   string key = this->BuildSplineKey(alg,interaction);
   return this->SplineExists(key);
 }
@@ -122,7 +178,8 @@ bool XSecSplineList::SplineExists(string key) const
 {
   SLOG("XSecSplLst", pDEBUG) << "Checking for spline with key = " << key;
 
-  bool exists = (fSplineMap.count(key) == 1);
+  bool exists = (fSplineMap.count(key) == 1) || 
+                (this->FindInArchive(key) >= 0);
   SLOG("XSecSplLst", pDEBUG)
     << "Spline found?...." << utils::print::BoolAsYNString(exists);
   return exists;
@@ -131,22 +188,50 @@ bool XSecSplineList::SplineExists(string key) const
 const Spline * XSecSplineList::GetSpline(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
+// Look-up the spline using the algorithm address and the interaction code.
+// The string spline key is only built the first time a spline is requested.
+
+  SplineCacheKey ckey(alg, interaction->Key());
+  map<SplineCacheKey, const Spline *>::const_iterator 
+                                         iter = fSplineCache.find(ckey);
+  if(iter != fSplineCache.end()) return iter->second;
+
   string key = this->BuildSplineKey(alg,interaction);
-  return this->GetSpline(key);
+  const Spline * spline = this->GetSpline(key);
+  if(spline) {
+    fSplineCache.insert( 
+        map<SplineCacheKey, const Spline *>::value_type(ckey, spline) );
+  }
+  return spline;
 }
 //____________________________________________________________________________
 const Spline * XSecSplineList::GetSpline(string key) const
 {
-  if ( this->SplineExists(key) ) {
-     map<string, Spline *>::const_iterator iter = fSplineMap.find(key);
-     return iter->second;
-  } else {
-    SLOG("XSecSplLst", pWARN) << "Couldn't find spline for key = " << key;
-    return 0;
+  map<string, Spline *>::const_iterator iter = fSplineMap.find(key);
+  if(iter != fSplineMap.end()) return iter->second;
+
+  // not built yet? - build it from the binary archive
+  int ispl = this->FindInArchive(key);
+  if(ispl >= 0) {
+    Spline * spline = this->BuildFromArchive(ispl);
+    fSplineMap.insert( map<string, Spline *>::value_type(key, spline) );
+    return spline;
   }
+
+  SLOG("XSecSplLst", pWARN) << "Couldn't find spline for key = " << key;
   return 0;
 }
 //____________________________________________________________________________
+const int XSecSplineList::NSplines(void) const
+{
+  int n = fArchiveNSpl;
+  map<string, Spline *>::const_iterator mapiter;
+  for(mapiter = fSplineMap.begin(); mapiter != fSplineMap.end(); ++mapiter) {
+    if(this->FindInArchive(mapiter->first) < 0) n++;
+  }
+  return n;
+}
+//____________________________________________________________________________
 void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
         const Interaction * interaction, int nknots, double Emin, double Emax)
 {
@@ -155,14 +240,54 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
 // For building this specific entry of the spline list, the user is allowed
 // to override the list-wide nknots,Emin,Emax
 
-  double xsec[nknots];
-  double E   [nknots];
-
   SLOG("XSecSplLst", pNOTICE)
      << "Creating cross section spline using the algorithm: " << *alg;
 
+  vector<double> E;
+  this->SplineKnots(interaction, nknots, Emin, Emax, E);
+  nknots = E.size();
+
+  // Compute cross sections for the input interaction at the selected
+  // set of energies
+  //
+  vector<double> xsec(nknots);
+  for (int i = 0; i < nknots; i++) {
+    TLorentzVector p4(0,0,E[i],E[i]);
+    interaction->InitStatePtr()->SetProbeP4(p4);
+    xsec[i] = alg->Integral(interaction);
+    SLOG("XSecSplLst", pNOTICE)
+            << "xsec(E = " << E[i] << ") = " 
+                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
+  }
+
+  // Build & save the spline
+  //
+  this->CreateSpline(alg, interaction, E, xsec);
+}
+//____________________________________________________________________________
+void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
+        const Interaction * interaction, 
+        const vector<double> & E, const vector<double> & xsec)
+{
+// Store a cross section spline for the input interaction using cross section
+// values that were computed elsewhere (eg by GSplineWorkerPool) at the knots
+// returned by SplineKnots()
+
+  assert(E.size() == xsec.size() && E.size() > 0);
+
   string key = this->BuildSplineKey(alg,interaction);
 
+  int nknots = E.size();
+  Spline * spline = new Spline(
+      nknots, const_cast<double *>(&E[0]), const_cast<double *>(&xsec[0]));
+  fSplineMap.insert( map<string, Spline *>::value_type(key, spline) );
+}
+//____________________________________________________________________________
+void XSecSplineList::SplineKnots(const Interaction * interaction, 
+    int nknots, double Emin, double Emax, vector<double> & E) const
+{
+// Energies of the knots of the cross section spline for the input interaction
+
   // If any of the nknots,Emin,Emax was not set or its value is not acceptable
   // use the list values
   //
@@ -171,6 +296,8 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   if (nknots <= 2) nknots = this->NKnots();
   assert(Emin < Emax);
 
+  E.resize(nknots);
+
   // Distribute the knots in the energy range (Emin,Emax) :
   // - Will use 5 knots linearly spaced below the energy thresholds so that the
   //   spline behaves correctly in (Emin,Ethr)
@@ -206,23 +333,6 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
      else  
        E[i+nkb] = E0 + i * dEa;
   }
-
-  // Compute cross sections for the input interaction at the selected
-  // set of energies
-  //
-  for (int i = 0; i < nknots; i++) {
-    TLorentzVector p4(0,0,E[i],E[i]);
-    interaction->InitStatePtr()->SetProbeP4(p4);
-    xsec[i] = alg->Integral(interaction);
-    SLOG("XSecSplLst", pNOTICE)
-            << "xsec(E = " << E[i] << ") = " 
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
-  }
-
-  // Build & save the spline
-  //
-  Spline * spline = new Spline(nknots, E, xsec);
-  fSplineMap.insert( map<string, Spline *>::value_type(key, spline) );
 }
 //____________________________________________________________________________
 void XSecSplineList::SetLogE(bool on)
@@ -253,6 +363,8 @@ void XSecSplineList::SaveAsXml(string filename) const
   SLOG("XSecSplLst", pNOTICE)
        << "Saving XSecSplineList as XML in file: " << filename;
 
+  this->LoadAllFromArchive();
+
   ofstream outxml(filename.c_str());
   if(!outxml.is_open()) {
     SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
@@ -294,7 +406,14 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(string filename, bool keep)
         << "Option to keep pre-existing splines is switched "
         << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
+  if(!keep) {
+    this->ClearSplines();
+  } else {
+    // splines loaded earlier from a binary archive take precedence, as do
+    // all pre-existing splines
+    this->LoadAllFromArchive();
+    this->CloseArchive();
+  }
 
   const int kNodeTypeStartElement = 1;
   const int kNodeTypeEndElement   = 15;
@@ -417,7 +536,10 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(string filename, bool keep)
      << "Option to keep pre-existing splines is switched "
      << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
+  if(!keep) {
+    fSplineMap.clear();
+    fSplineCache.clear();
+  }
 
   xmlDocPtr xml_doc = xmlParseFile(filename.c_str() );
 
@@ -532,6 +654,284 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(string filename, bool keep)
   return kXmlOK;
 }*/
 //____________________________________________________________________________
+bool XSecSplineList::SaveAsBinary(string filename) const
+{
+// Save XSecSplineList to a binary spline archive.
+// The knots are stored exactly (as doubles), so a list loaded from the
+// archive is identical to the list that was saved.
+
+  SLOG("XSecSplLst", pNOTICE)
+       << "Saving XSecSplineList as binary archive in file: " << filename;
+
+  this->LoadAllFromArchive();
+
+  ofstream out(filename.c_str(), ios::out | ios::binary);
+  if(!out.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
+    return false;
+  }
+
+  UInt_t nspl = fSplineMap.size();
+
+  // work out the index (map is sorted by key)
+  vector<XSecSplArchiveEntry> index(nspl);
+  ULong64_t key_offset   = 0;
+  ULong64_t knots_offset = 0;
+  map<string, Spline *>::const_iterator mapiter;
+  unsigned int ispl = 0;
+  for(mapiter = fSplineMap.begin(); mapiter != fSplineMap.end(); ++mapiter, ++ispl) {
+    index[ispl].key_offset   = key_offset;
+    index[ispl].key_length   = mapiter->first.size();
+    index[ispl].nknots       = mapiter->second->NKnots();
+    index[ispl].knots_offset = knots_offset;
+    key_offset   += index[ispl].key_length;
+    knots_offset += 2 * index[ispl].nknots * sizeof(double);
+  }
+
+  XSecSplArchiveHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kXSecSplArchiveMagic, sizeof(header.magic));
+  header.version      = kXSecSplArchiveVersion;
+  header.bom          = kXSecSplArchiveBOM;
+  header.uselog       = (fUseLogE ? 1 : 0);
+  header.nsplines     = nspl;
+  header.index_offset = sizeof(header);
+  header.keys_offset  = header.index_offset + nspl * sizeof(XSecSplArchiveEntry);
+  header.knots_offset = header.keys_offset  + key_offset;
+  // align knot data 
+  ULong64_t npad = (8 - header.knots_offset % 8) % 8;
+  header.knots_offset += npad;
+
+  out.write((const char *) &header, sizeof(header));
+  if(nspl > 0) {
+    out.write((const char *) &index[0], nspl * sizeof(XSecSplArchiveEntry));
+  }
+  for(mapiter = fSplineMap.begin(); mapiter != fSplineMap.end(); ++mapiter) {
+    out.write(mapiter->first.data(), mapiter->first.size());
+  }
+  const char pad[8] = {0,0,0,0,0,0,0,0};
+  out.write(pad, npad);
+  for(mapiter = fSplineMap.begin(); mapiter != fSplineMap.end(); ++mapiter) {
+    const Spline * spline = mapiter->second;
+    int nknots = spline->NKnots();
+    vector<double> E(nknots), xsec(nknots);
+    for(int i = 0; i < nknots; i++) {
+      spline->GetKnot(i, E[i], xsec[i]);
+    }
+    if(nknots > 0) {
+      out.write((const char *) &E[0],    nknots * sizeof(double));
+      out.write((const char *) &xsec[0], nknots * sizeof(double));
+    }
+  }
+  bool ok = out.good();
+  out.close();
+
+  if(!ok) {
+    SLOG("XSecSplLst", pERROR) << "Error writing file = " << filename;
+  }
+  return ok;
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromBinary(string filename, bool keep)
+{
+// Load XSecSplineList from a binary spline archive. If keep = true, then the
+// loaded splines are added to the existing list (pre-existing splines take
+// precedence). If false, then the existing list is reseted before loading.
+// The archive is memory-mapped and splines are built only when requested.
+
+  SLOG("XSecSplLst", pNOTICE) << "Loading splines from: " << filename;
+  SLOG("XSecSplLst", pINFO)
+        << "Option to keep pre-existing splines is switched "
+        << ( (keep) ? "ON" : "OFF" );
+
+  if(!keep) {
+    this->ClearSplines();
+  } else {
+    // only one archive is mapped at a time: build the pre-existing splines
+    this->LoadAllFromArchive();
+    this->CloseArchive();
+  }
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary spline file could not be opened! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(XSecSplArchiveHeader)) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary spline file is empty or truncated! [filename: " << filename << "]";
+    close(fd);
+    return kXmlEmpty;
+  }
+  void * addr = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary spline file could not be mapped! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+
+  const char * data = (const char *) addr;
+  long int     size = (long int) st.st_size;
+
+  const XSecSplArchiveHeader * header = (const XSecSplArchiveHeader *) data;
+  bool valid = 
+     memcmp(header->magic, kXSecSplArchiveMagic, sizeof(header->magic)) == 0 &&
+     header->version == kXSecSplArchiveVersion &&
+     header->bom     == kXSecSplArchiveBOM;
+  if(!valid) {
+    LOG("XSecSplLst", pERROR)
+      << "\nNot a binary spline archive, or one written by an incompatible "
+      << "version or on a machine with different byte order! [filename: " << filename << "]";
+    munmap(addr, size);
+    return kXmlInvalidRoot;
+  }
+
+  // check that all the index entries point within the file
+  ULong64_t nspl = header->nsplines;
+  bool ok = header->index_offset + nspl * sizeof(XSecSplArchiveEntry) <= (ULong64_t) size &&
+            header->keys_offset  <= (ULong64_t) size &&
+            header->knots_offset <= (ULong64_t) size && 
+            header->knots_offset % 8 == 0;
+  const XSecSplArchiveEntry * index = 
+     (const XSecSplArchiveEntry *) (data + header->index_offset);
+  for(ULong64_t ispl = 0; ok && ispl < nspl; ispl++) {
+     ok = (header->keys_offset + index[ispl].key_offset + 
+              index[ispl].key_length <= (ULong64_t) size) &&
+          (header->knots_offset + index[ispl].knots_offset + 
+              2 * index[ispl].nknots * sizeof(double) <= (ULong64_t) size);
+  }
+  if(!ok) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary spline file is corrupted! [filename: " << filename << "]";
+    munmap(addr, size);
+    return kXmlNotParsed;
+  }
+
+  this->SetLogE(header->uselog == 1);
+
+  fArchiveFile = filename;
+  fArchiveData = data;
+  fArchiveSize = size;
+  fArchiveNSpl = (int) nspl;
+
+  SLOG("XSecSplLst", pNOTICE) 
+     << "Mapped binary archive with " << fArchiveNSpl << " splines";
+
+  return kXmlOK;
+}
+//____________________________________________________________________________
+bool XSecSplineList::IsBinary(string filename)
+{
+// Check whether the input file is a binary spline archive
+
+  ifstream inp(filename.c_str(), ios::in | ios::binary);
+  if(!inp.is_open()) return false;
+  char magic[8];
+  inp.read(magic, sizeof(magic));
+  if(!inp.good()) return false;
+  return (memcmp(magic, kXSecSplArchiveMagic, sizeof(magic)) == 0);
+}
+//____________________________________________________________________________
+int XSecSplineList::FindInArchive(string key) const
+{
+// Binary search for the input key in the (sorted) archive index.
+// Returns the spline position in the archive or -1 if not found.
+
+  if(!fArchiveData) return -1;
+
+  const XSecSplArchiveHeader * header = 
+     (const XSecSplArchiveHeader *) fArchiveData;
+  const XSecSplArchiveEntry * index = 
+     (const XSecSplArchiveEntry *) (fArchiveData + header->index_offset);
+  const char * keys = fArchiveData + header->keys_offset;
+
+  int ilow = 0, ihigh = fArchiveNSpl-1;
+  while(ilow <= ihigh) {
+    int imid = (ilow+ihigh)/2;
+    const char * ikey = keys + index[imid].key_offset;
+    int cmp = key.compare(0, key.size(), ikey, index[imid].key_length);
+    if      (cmp == 0) return imid;
+    else if (cmp  < 0) ihigh = imid-1;
+    else               ilow  = imid+1;
+  }
+  return -1;
+}
+//____________________________________________________________________________
+string XSecSplineList::ArchiveKey(int ispl) const
+{
+  if(!fArchiveData || ispl < 0 || ispl >= fArchiveNSpl) return "";
+
+  const XSecSplArchiveHeader * header = 
+     (const XSecSplArchiveHeader *) fArchiveData;
+  const XSecSplArchiveEntry * index = 
+     (const XSecSplArchiveEntry *) (fArchiveData + header->index_offset);
+
+  return string(fArchiveData + header->keys_offset + index[ispl].key_offset,
+                index[ispl].key_length);
+}
+//____________________________________________________________________________
+Spline * XSecSplineList::BuildFromArchive(int ispl) const
+{
+  const XSecSplArchiveHeader * header = 
+     (const XSecSplArchiveHeader *) fArchiveData;
+  const XSecSplArchiveEntry * index = 
+     (const XSecSplArchiveEntry *) (fArchiveData + header->index_offset);
+
+  int nknots = index[ispl].nknots;
+  const double * E = (const double *) 
+     (fArchiveData + header->knots_offset + index[ispl].knots_offset);
+  const double * xsec = E + nknots;
+
+  SLOG("XSecSplLst", pINFO) 
+     << "Building spline: " << this->ArchiveKey(ispl) << " from binary archive";
+
+  // the knots are copied by the Spline (TSpline3)
+  return new Spline(nknots, const_cast<double *>(E), const_cast<double *>(xsec));
+}
+//____________________________________________________________________________
+void XSecSplineList::LoadAllFromArchive(void) const
+{
+// Build all the splines in the binary archive that were not requested yet
+
+  for(int ispl = 0; ispl < fArchiveNSpl; ispl++) {
+    string key = this->ArchiveKey(ispl);
+    if(fSplineMap.count(key) == 1) continue;
+    Spline * spline = this->BuildFromArchive(ispl);
+    fSplineMap.insert( map<string, Spline *>::value_type(key, spline) );
+  }
+}
+//____________________________________________________________________________
+void XSecSplineList::CloseArchive(void)
+{
+  if(fArchiveData) {
+    munmap((void *) fArchiveData, fArchiveSize);
+  }
+  fArchiveFile = "";
+  fArchiveData = 0;
+  fArchiveSize = 0;
+  fArchiveNSpl = 0;
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearSplines(void)
+{
+// Delete all the loaded splines and unmap the binary archive (without
+// building the splines that were not requested yet)
+
+  map<string, Spline *>::iterator spliter;
+  for(spliter = fSplineMap.begin(); spliter != fSplineMap.end(); ++spliter) {
+    Spline * spline = spliter->second;
+    if(spline) delete spline;
+  }
+  fSplineMap.clear();
+  fSplineCache.clear();
+  fNResets++;
+
+  this->CloseArchive();
+}
+//____________________________________________________________________________
 string XSecSplineList::BuildSplineKey(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
@@ -617,6 +1017,11 @@ const vector<string> * XSecSplineList::GetSplineKeys(void) const
     string key = mapiter->first;
     (*keyv)[i++]=key;
   }
+  // add the keys of splines in the binary archive that were not built yet
+  for(int ispl = 0; ispl < fArchiveNSpl; ispl++) {
+    string key = this->ArchiveKey(ispl);
+    if(fSplineMap.count(key) == 0) keyv->push_back(key);
+  }
   return keyv;
 }
 //____________________________________________________________________________
@@ -652,11 +1057,12 @@ void XSecSplineList::Print(ostream & stream) const
   stream << "\n [-] Available Splines:";
   stream << "\n  |";
 
-  map<string, Spline *>::const_iterator mapiter;
-  for(mapiter = fSplineMap.begin(); mapiter != fSplineMap.end(); ++mapiter) {
-    string key = mapiter->first;
-    stream << "\n  |-----o  " << key;
+  const vector<string> * keyv = this->GetSplineKeys();
+  vector<string>::const_iterator keyiter;
+  for(keyiter = keyv->begin(); keyiter != keyv->end(); ++keyiter) {
+    stream << "\n  |-----o  " << *keyiter;
   }
+  delete keyv;
   stream << "\n";
 }
 //___________________________________________________________________________
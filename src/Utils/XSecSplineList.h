@@ -5,6 +5,12 @@
 
 \brief    List of cross section vs energy splines
 
+          Splines can be loaded from XML files or from binary spline archives
+          (see SaveAsBinary()). A binary archive is memory-mapped and splines
+          are only built when they are first requested, so loading is nearly
+          instantaneous and the archive pages are shared by all processes
+          using the same file.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           STFC, Rutherford Appleton Laboratory
 
@@ -24,6 +30,8 @@
 #include <vector>
 #include <string>
 
+#include <Rtypes.h>
+
 #include "Conventions/XmlParserStatus.h"
 
 using std::map;
@@ -51,9 +59,19 @@ public:
   const Spline * GetSpline    (string spline_key) const;
   void           CreateSpline (const XSecAlgorithmI * alg, const Interaction * i,
                                    int nknots = -1, double Emin = -1, double Emax = -1);
+  void           CreateSpline (const XSecAlgorithmI * alg, const Interaction * i,
+                                   const vector<double> & E, const vector<double> & xsec);
 
-  const int  NSplines (void) const { return fSplineMap.size();        }
-  const bool IsEmpty  (void) const { return (fSplineMap.size() == 0); }
+  // Knots used for the spline of the input interaction
+  void           SplineKnots  (const Interaction * i, int nknots, double Emin, double Emax,
+                                   vector<double> & E) const;
+
+  const int  NSplines (void) const;
+  const bool IsEmpty  (void) const { return (fSplineMap.size() == 0 && fArchiveNSpl == 0); }
+
+  // Number of times the list was reset by loading splines with keep = false
+  // (Spline pointers obtained earlier are no longer valid after a reset)
+  unsigned int NResets (void) const { return fNResets; }
 
   // Set XSecSplineList options
   void   SetLogE   (bool   on); ///< set opt to build splines as f(E) or as f(logE)
@@ -71,6 +89,11 @@ public:
   void               SaveAsXml   (string filename) const;
   XmlParserStatus_t  LoadFromXml (string filename, bool keep = false);
 
+  // Save/load to/from binary spline archive
+  bool               SaveAsBinary   (string filename) const;
+  XmlParserStatus_t  LoadFromBinary (string filename, bool keep = false);
+  static bool        IsBinary       (string filename);
+
   // Autosave/autoload
   bool AutoLoad (void);
   void AutoSave (void);
@@ -90,6 +113,15 @@ private:
   XSecSplineList(const XSecSplineList & spline_list);
   virtual ~XSecSplineList();
 
+  // binary spline archive access
+  int      FindInArchive     (string key) const;
+  string   ArchiveKey        (int ispl)   const;
+  Spline * BuildFromArchive  (int ispl)   const;
+  void     LoadAllFromArchive(void)       const;
+  void     CloseArchive      (void);
+
+  void     ClearSplines      (void);
+
   static XSecSplineList * fInstance;
 
   bool   fUseLogE;
@@ -97,7 +129,17 @@ private:
   double fEmin;
   double fEmax;
 
-  map<string, Spline *> fSplineMap; ///< xsec_alg_name/param_set/interaction -> Spline
+  mutable map<string, Spline *> fSplineMap; ///< xsec_alg_name/param_set/interaction -> Spline (inc. splines built from the archive)
+
+  typedef pair<const XSecAlgorithmI *, ULong64_t> SplineCacheKey;
+  mutable map<SplineCacheKey, const Spline *> fSplineCache; ///< (xsec_alg, interaction code) -> Spline, for fast look-ups
+
+  string       fArchiveFile;  ///< memory-mapped binary spline archive
+  const char * fArchiveData;  ///< start of mapped archive
+  long int     fArchiveSize;  ///< size of mapped archive (bytes)
+  int          fArchiveNSpl;  ///< number of splines in archive
+
+  unsigned int fNResets;      ///< number of times the splines were deleted
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -32,6 +32,9 @@
                   [--event-record-print-level level]
                   [--mc-job-status-refresh-rate  rate]
                   [--cache-file root_file]
+                  [--max-xsec-tables xml_file]
+                  [--workers n]
+                  [--event-format format]
 
          Options :
            [] Denotes an optional argument.
@@ -96,7 +99,29 @@
               Allows users to customize the refresh rate of the status file.
            --cache-file                  
               Allows users to specify a cache file so that the cache can be
-              re-used in subsequent MC jobs.
+              re-used in subsequent MC jobs. The same cache file can be used
+              by many concurrent jobs (the cached data of all jobs are merged
+              at the end of each job).
+           --max-xsec-tables
+              Allows users to specify an XML file with precomputed max
+              differential cross-section tables (see gmkmaxxsec), so that the
+              kinematics generators run at full speed from the first event.
+           --workers
+              Number of worker processes to split event generation into.
+              This option is relevant only if a neutrino flux or a target mix
+              is specified. The workers are started after the MC job driver
+              has been configured, so that cross-section splines and probability
+              scales are shared rather than re-computed. The GENIE random number
+              streams are positioned by event number, so the generated events
+              do not depend on the number of workers (only ROOT's gRandom and
+              PYTHIA6 get a worker seed derived from the job seed). The events
+              generated by all workers are merged in a single output file.
+              [default: 1]
+           --event-format
+              Format of the output event tree: `ghep' (full GHEP event records)
+              or `flat' (flat, columnar event records; smaller and much faster
+              to read, but without the interaction summary - see NtpMCFlatEvent).
+              [default: ghep]
 
 	***  See the User Manual for more details and examples. ***
 
@@ -124,6 +149,7 @@
 #include <TVector3.h>
 #include <TH1.h>
 #include <TF1.h>
+#include <TMath.h>
 
 #include "Conventions/XmlParserStatus.h"
 #include "Conventions/GBuild.h"
@@ -133,6 +159,7 @@
 #include "EVGDrivers/GEVGDriver.h"
 #include "EVGDrivers/GMCJDriver.h"
 #include "EVGDrivers/GMCJMonitor.h"
+#include "EVGDrivers/GMCJWorkerPool.h"
 #include "Interaction/Interaction.h"
 #include "Messenger/Messenger.h"
 #include "Ntuple/NtpWriter.h"
@@ -172,6 +199,7 @@ void PrintSyntax        (void);
 
 #ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
 void            GenerateEventsUsingFluxOrTgtMix();
+void            GenerateEventsUsingMCJDriver (int iworker, int nworkers, string filename);
 GeomAnalyzerI * GeomDriver              (void);
 GFluxI *        FluxDriver              (void);
 GFluxI *        MonoEnergeticFluxDriver (void);
@@ -197,6 +225,12 @@ bool            gOptWeighted;     //
 bool            gOptUsingFluxOrTgtMix = false;
 long int        gOptRanSeed;      // random number seed
 string          gOptInpXSecFile;  // cross-section splines
+int             gOptNWorkers;     // number of event generation worker processes
+NtpMCFormat_t   gOptNtpFormat;    // output event tree format
+
+#ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
+GMCJDriver *    gMCJDriver = 0;   // configured MC job driver, shared by all workers
+#endif
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -229,6 +263,7 @@ void Initialize()
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTables(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
 
@@ -253,7 +288,7 @@ void GenerateEventsAtFixedInitState(void)
   evg_driver.Configure(init_state);
 
   // Initialize an Ntuple Writer
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
   ntpw.Initialize();
 
   // Create an MC Job Monitor
@@ -270,7 +305,8 @@ void GenerateEventsAtFixedInitState(void)
      LOG("gevgen", pNOTICE) 
         << " *** Generating event............ " << ievent;
 
-     // generate a single event
+     // key the random number streams to the current event & generate it
+     RandomGen::Instance()->SetEvent(gOptRunNu, ievent);
      EventRecord * event = evg_driver.GenerateEvent(nu_p4);
 
      if(!event) {
@@ -313,38 +349,72 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if(!gOptWeighted) 
 	mcj_driver->ForceSingleProbScale();
 
+  gMCJDriver = mcj_driver;
+
+  if(gOptNWorkers > 1) {
+    // Split event generation between several worker processes, each
+    // writing its own event file, and merge all events into a single tree
+    GMCJWorkerPool workers(gOptNWorkers);
+    bool ok = workers.Run(GenerateEventsUsingMCJDriver);
+    if(!ok) {
+      LOG("gevgen", pFATAL) << "Event generation failed in worker process";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
+    ntpw.Initialize();
+    workers.MergeOutputs(ntpw);
+    ntpw.Save();
+  } else {
+    GenerateEventsUsingMCJDriver(0, 1, "");
+  }
+
+  gMCJDriver = 0;
+
+  delete flux_driver;
+  delete geom_driver;
+  delete mcj_driver;;
+}
+//____________________________________________________________________________
+void GenerateEventsUsingMCJDriver(int iworker, int nworkers, string filename)
+{
+// Generate this worker's share of events using the configured MC job driver.
+// If no filename is given, the default ntuple filename is used.
+
+  int nev   = GMCJWorkerPool::NEvents    (gOptNevents, iworker, nworkers);
+  int first = GMCJWorkerPool::FirstEvent (gOptNevents, iworker, nworkers);
+
   // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  NtpWriter ntpw(gOptNtpFormat, gOptRunNu);
+  if(filename.size() > 0) ntpw.CustomizeFilename(filename);
   ntpw.Initialize();
 
   // Create an MC Job Monitor
+  // (only the first worker updates the job status file)
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
 
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
-  while ( ievent < gOptNevents) {
+  int ievent = first;
+  while ( ievent < first + nev) {
 
      LOG("gevgen", pNOTICE) << " *** Generating event............ " << ievent;
 
      // generate a single event for neutrinos coming from the specified flux
-     EventRecord * event = mcj_driver->GenerateEvent();
+     RandomGen::Instance()->SetEvent(gOptRunNu, ievent);
+     EventRecord * event = gMCJDriver->GenerateEvent();
 
      LOG("gevgen", pNOTICE) << "Generated Event GHEP Record: " << *event;
 
      // add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
+     if(iworker == 0) mcjmonitor.Update(ievent,event);
      ievent++;
      delete event;
   }
 
   // Save the generated MC events
   ntpw.Save();
-
-  delete flux_driver;
-  delete geom_driver;
-  delete mcj_driver;;
 }
 //____________________________________________________________________________
 GeomAnalyzerI * GeomDriver(void)
@@ -653,6 +723,31 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  } else {
+    LOG("gevgen", pINFO) << "Unspecified number of worker processes - Using default";
+    gOptNWorkers = 1;
+  }
+
+  // output event tree format
+  gOptNtpFormat = kDefOptNtpFormat;
+  if( parser.OptionExists("event-format") ) {
+    LOG("gevgen", pINFO) << "Reading output event tree format";
+    string fmt = parser.ArgAsString("event-format");
+    if      (fmt == "ghep") gOptNtpFormat = kNFGHEP;
+    else if (fmt == "flat") gOptNtpFormat = kNFFlat;
+    else {
+      LOG("gevgen", pFATAL) << "Unknown output event tree format: " << fmt;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    LOG("gevgen", pINFO) << "Unspecified event tree format - Using default";
+  }
+
   //
   // print-out the command line options
   //
@@ -670,6 +765,10 @@ void GetCommandLineArgs(int argc, char ** argv)
   }
   LOG("gevgen", pNOTICE) 
        << "Number of events requested: " << gOptNevents;
+  LOG("gevgen", pNOTICE) 
+       << "Number of worker processes: " << gOptNWorkers;
+  LOG("gevgen", pNOTICE) 
+       << "Output event tree format: " << NtpMCFormat::AsString(gOptNtpFormat);
   if(gOptInpXSecFile.size() > 0) {
      LOG("gevgen", pNOTICE) 
        << "Using cross-section splines read from: " << gOptInpXSecFile;
@@ -726,6 +825,9 @@ void PrintSyntax(void)
     << "\n              [--event-record-print-level level]"
     << "\n              [--mc-job-status-refresh-rate  rate]"
     << "\n              [--cache-file root_file]"
+    << "\n              [--max-xsec-tables xml_file]"
+    << "\n              [--workers n]"
+    << "\n              [--event-format format]"
     << "\n";
 }
 //____________________________________________________________________________
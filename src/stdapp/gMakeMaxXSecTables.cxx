@@ -0,0 +1,318 @@
+//____________________________________________________________________________
+/*!
+
+\program gmkmaxxsec
+
+\brief   GENIE utility program tabulating, as a function of energy, the
+         maximum differential cross section used by the kinematics generators
+         in the rejection method (see KineGeneratorWithCache).
+         Normally these values are computed on the fly and cached during each
+         MC job. The tables built by gmkmaxxsec can be loaded in gevgen (and
+         the experiment-specific event generation drivers) using the
+         --max-xsec-tables option, so that the kinematics generators do not
+         have to compute them at the start of every job.
+         Tables depend on the kinematics generator configuration so they must
+         be rebuilt whenever the physics configuration is modified.
+
+         Syntax :
+           gmkmaxxsec -p nupdg -t target_pdg_codes
+                      [-o output_xml_file]
+                      [-n nknots] [-e max_energy]
+                      [--event-generator-list list_name]
+                      [--message-thresholds xml_file]
+
+         Note :
+           [] marks optional arguments.
+           <> marks a list of arguments out of which only one can be
+              selected at any given time.
+
+         Options :
+           -p
+               A comma separated list of nu PDG codes.
+           -t
+               A comma separated list of tgt PDG codes.
+               PDG code format: 10LZZZAAAI
+           -o
+               Name of output XML file.
+               Default: `max_xsec_tables.xml'.
+           -n
+               Number of energies per table.
+               Default: 15 energies per decade of energy range with a minimum
+               of 30 energies totally (as for the cross section splines).
+           -e
+               Maximum energy in table.
+               Default: The max energy in the validity range of the event
+               generation thread.
+          --event-generator-list
+              List of event generators to load in event generation drivers.
+              [default: "Default"].
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+
+#include "EVGCore/EventGenerator.h"
+#include "EVGCore/EventGeneratorList.h"
+#include "EVGCore/InteractionList.h"
+#include "EVGCore/InteractionListGeneratorI.h"
+#include "EVGCore/RunningThreadInfo.h"
+#include "EVGDrivers/GEVGDriver.h"
+#include "EVGModules/KineGeneratorWithCache.h"
+#include "Interaction/Interaction.h"
+#include "Messenger/Messenger.h"
+#include "PDG/PDGCodeList.h"
+#include "Utils/RunOpt.h"
+#include "Utils/AppInit.h"
+#include "Utils/StringUtils.h"
+#include "Utils/PrintUtils.h"
+#include "Utils/MaxXSecTable.h"
+#include "Utils/XSecSplineList.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// Prototypes:
+void          GetCommandLineArgs (int argc, char ** argv);
+void          PrintSyntax        (void);
+PDGCodeList * GetCodes           (string codes);
+void          Tabulate           (const InitialState & init_state);
+
+// User-specified options:
+string   gOptNuPdgCodeList  = "";
+string   gOptTgtPdgCodeList = "";
+int      gOptNKnots         = -1;
+double   gOptMaxE           = -1.;
+string   gOptOutFile        = "";   // output max xsec table file
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  // Parse command line arguments
+  GetCommandLineArgs(argc,argv);
+
+  // Init
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  // Get list of neutrinos and nuclear targets
+  PDGCodeList * neutrinos = GetCodes(gOptNuPdgCodeList);
+  PDGCodeList * targets   = GetCodes(gOptTgtPdgCodeList);
+
+  if(neutrinos->size() == 0 ) {
+     LOG("gmkmaxxsec", pFATAL) << "Empty neutrino PDG code list";
+     PrintSyntax();
+     exit(2);
+  }
+  if(targets->size() == 0 ) {
+     LOG("gmkmaxxsec", pFATAL) << "Empty target PDG code list";
+     PrintSyntax();
+     exit(3);
+  }
+
+  LOG("gmkmaxxsec", pINFO) << "Neutrinos: " << *neutrinos;
+  LOG("gmkmaxxsec", pINFO) << "Targets: "   << *targets;
+
+  // Loop over all possible input init states and tabulate the max xsec
+  // for all the interactions and kinematics generators of all the event
+  // generators loaded for that initial state
+  PDGCodeList::const_iterator nuiter;
+  PDGCodeList::const_iterator tgtiter;
+  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
+    for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
+      InitialState init_state(*tgtiter, *nuiter);
+      Tabulate(init_state);
+    }
+  }
+
+  // Save the tables at the requested XML file
+  MaxXSecTable * mxt = MaxXSecTable::Instance();
+  LOG("gmkmaxxsec", pNOTICE) << *mxt;
+  mxt->SaveAsXml(gOptOutFile);
+
+  delete neutrinos;
+  delete targets;
+
+  return 0;
+}
+//____________________________________________________________________________
+void Tabulate(const InitialState & init_state)
+{
+  GEVGDriver driver;
+  driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  driver.Configure(init_state);
+
+  const EventGeneratorList * evgl = driver.EventGenerators();
+
+  EventGeneratorList::const_iterator evgliter;
+  for(evgliter = evgl->begin(); evgliter != evgl->end(); ++evgliter) {
+
+     const EventGenerator * evgen = dynamic_cast<const EventGenerator *> (*evgliter);
+     if(!evgen) continue;
+
+     InteractionList * ilst =
+         evgen->IntListGenerator()->CreateInteractionList(init_state);
+     if(!ilst) continue;
+
+     // energy range: same as for the cross section splines
+     // (see GEVGDriver::CreateSplines())
+     double Emin = TMath::Max(0.01,evgen->ValidityContext().Emin());
+     double Emax = evgen->ValidityContext().Emax();
+     if(gOptMaxE > 0) Emax = TMath::Min(gOptMaxE, Emax);
+     if(Emax <= Emin) {
+       LOG("gmkmaxxsec", pWARN)
+         << "Empty energy range for " << evgen->Id().Key() << " - Skipping";
+       delete ilst;
+       continue;
+     }
+
+     int nknots = gOptNKnots;
+     if(nknots < 0) {
+       nknots = (int) (15 * TMath::Log10(Emax-Emin));
+     }
+     nknots = TMath::Max(nknots,30);
+
+     RunningThreadInfo::Instance()->UpdateRunningThread(evgen);
+
+     for(int imod = 0; imod < evgen->NModules(); imod++) {
+        const KineGeneratorWithCache * kinegen =
+           dynamic_cast<const KineGeneratorWithCache *> (evgen->Module(imod));
+        if(!kinegen) continue;
+
+        LOG("gmkmaxxsec", pNOTICE)
+          << "Tabulating max xsec for " << kinegen->Id().Key()
+          << " in event generator " << evgen->Id().Key();
+
+        InteractionList::const_iterator intliter;
+        for(intliter = ilst->begin(); intliter != ilst->end(); ++intliter) {
+          Interaction * interaction = *intliter;
+          vector<double> E;
+          XSecSplineList::Instance()->SplineKnots(
+                                       interaction, nknots, Emin, Emax, E);
+          kinegen->TabulateMaxXSec(evgen->CrossSectionAlg(), interaction, E);
+        }
+     }
+     delete ilst;
+  }
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmkmaxxsec", pINFO) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // output XML file name
+  if( parser.OptionExists('o') ) {
+    LOG("gmkmaxxsec", pINFO) << "Reading output filename";
+    gOptOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gmkmaxxsec", pINFO) << "Unspecified filename - Using default";
+    gOptOutFile = "max_xsec_tables.xml";
+  }
+
+  // number of knots
+  if( parser.OptionExists('n') ) {
+    LOG("gmkmaxxsec", pINFO) << "Reading number of energies/table";
+    gOptNKnots = parser.ArgAsInt('n');
+  } else {
+    LOG("gmkmaxxsec", pINFO)
+      << "Unspecified number of energies - Using default";
+    gOptNKnots = -1;
+  }
+
+  // max table energy (if < max of validity range)
+  if( parser.OptionExists('e') ) {
+    LOG("gmkmaxxsec", pINFO) << "Reading maximum table energy";
+    gOptMaxE = parser.ArgAsDouble('e');
+  } else {
+    LOG("gmkmaxxsec", pINFO)
+       << "Unspecified maximum table energy - Using default";
+    gOptMaxE = -1;
+  }
+
+  // comma-separated neutrino PDG code list
+  if( parser.OptionExists('p') ) {
+    LOG("gmkmaxxsec", pINFO) << "Reading neutrino PDG codes";
+    gOptNuPdgCodeList = parser.ArgAsString('p');
+  } else {
+    LOG("gmkmaxxsec", pFATAL)
+       << "Unspecified neutrino PDG code list - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // comma-separated target PDG code list
+  if( parser.OptionExists('t') ) {
+    LOG("gmkmaxxsec", pINFO) << "Reading target nuclei PDG codes";
+    gOptTgtPdgCodeList = parser.ArgAsString('t');
+  } else {
+    LOG("gmkmaxxsec", pFATAL)
+       << "Unspecified target PDG code list - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  //
+  // print the command-line options
+  //
+  LOG("gmkmaxxsec", pNOTICE)
+     << "\n"
+     << utils::print::PrintFramedMesg("gmkmaxxsec job configuration")
+     << "\n Neutrino PDG codes : " << gOptNuPdgCodeList
+     << "\n Target PDG codes : " << gOptTgtPdgCodeList
+     << "\n Output max xsec table file : " << gOptOutFile
+     << "\n Number of energies / table : " << gOptNKnots
+     << "\n Maximum energy : " << gOptMaxE
+     << "\n";
+
+  LOG("gmkmaxxsec", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gmkmaxxsec", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gmkmaxxsec -p nupdg -t tgtpdg"
+    << " [-o xml_file_name]"
+    << " [-n nknots] [-e max_energy] "
+    << " [--event-generator-list list_name]"
+    << " [--message-thresholds xml_file]\n\n";
+}
+//____________________________________________________________________________
+PDGCodeList * GetCodes(string codes)
+{
+  // split the comma separated list
+  vector<string> vec = utils::str::Split(codes, ",");
+
+  // fill in the PDG code list
+  PDGCodeList * list = new PDGCodeList;
+  vector<string>::const_iterator iter;
+  for(iter = vec.begin(); iter != vec.end(); ++iter) {
+    list->push_back( atoi(iter->c_str()) );
+  }
+  return list;
+}
+//____________________________________________________________________________
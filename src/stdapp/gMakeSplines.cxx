@@ -16,6 +16,7 @@
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
                   [--message-thresholds xml_file]
+                  [--workers n]
 
          Note :
            [] marks optional arguments.
@@ -54,6 +55,13 @@
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
               See $GENIE/config/Messenger.xml for the XML schema.
+           --workers
+              Number of worker processes used for computing the splines.
+              The work is shared out one spline knot at a time and the
+              output is identical to the one obtained with a single worker.
+              The CPU time spent on each spline is reported at the end of
+              the job.
+              [default: 1]
 
         ***  See the User Manual for more details and examples. ***
 
@@ -71,13 +79,16 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "Conventions/GBuild.h"
 #include "EVGDrivers/GEVGDriver.h"
+#include "EVGDrivers/GSplineWorkerPool.h"
 #include "Interaction/Interaction.h"
 #include "Messenger/Messenger.h"
 #include "Numerical/RandomGen.h"
@@ -96,6 +107,7 @@
 
 using std::string;
 using std::vector;
+using std::ostringstream;
 
 using namespace genie;
 
@@ -118,6 +130,7 @@ double   gOptMaxE           = -1.;
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
+int      gOptNWorkers       = 1;    // number of worker processes
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -150,8 +163,12 @@ int main(int argc, char ** argv)
   LOG("gmkspl", pINFO) << "Targets: "   << *targets;
 
   // Loop over all possible input init states and ask the GEVGDriver
-  // to build splines for all the interactions that its loaded list
-  // of event generators can generate.
+  // to queue splines for all the interactions that its loaded list
+  // of event generators can generate. 
+  // The drivers are kept alive until all splines have been computed.
+
+  GSplineWorkerPool workers(gOptNWorkers);
+  vector<GEVGDriver *> drivers;
 
   PDGCodeList::const_iterator nuiter;
   PDGCodeList::const_iterator tgtiter;
@@ -160,17 +177,33 @@ int main(int argc, char ** argv)
       int nupdgc  = *nuiter;
       int tgtpdgc = *tgtiter;
       InitialState init_state(tgtpdgc, nupdgc);
-      GEVGDriver driver;
-      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-      driver.Configure(init_state);
-      driver.CreateSplines(gOptNKnots, gOptMaxE);
+      GEVGDriver * driver = new GEVGDriver;
+      driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver->Configure(init_state);
+      driver->QueueSplines(workers, gOptNKnots, gOptMaxE);
+      drivers.push_back(driver);
     }
   }
 
+  // Compute all queued splines
+  bool ok = workers.Run();
+  if(!ok) {
+     LOG("gmkspl", pFATAL) << "Failed to compute the cross section splines";
+     gAbortingInErr = true;
+     exit(1);
+  }
+  ostringstream timing;
+  workers.PrintTiming(timing);
+  LOG("gmkspl", pNOTICE) << timing.str();
+
   // Save the splines at the requested XML file
   XSecSplineList * xspl = XSecSplineList::Instance();
   xspl->SaveAsXml(gOptOutXSecFile);
 
+  vector<GEVGDriver *>::iterator diter;
+  for(diter = drivers.begin(); diter != drivers.end(); ++diter) {
+    delete *diter;
+  }
   delete neutrinos;
   delete targets;
 
@@ -289,6 +322,15 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gmkspl", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  } else {
+    LOG("gmkspl", pINFO) << "Unspecified number of worker processes - Using default";
+    gOptNWorkers = 1;
+  }
+
   //
   // print the command-line options 
   //
@@ -301,6 +343,7 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
      << "\n Random number seed : " << gOptRanSeed
+     << "\n Number of worker processes : " << gOptNWorkers
      << "\n";
 
   LOG("gmkspl", pNOTICE) << *RunOpt::Instance();
@@ -316,7 +359,8 @@ void PrintSyntax(void)
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
-    << " [--message-thresholds xml_file]\n\n";
+    << " [--message-thresholds xml_file]"
+    << " [--workers n]\n\n";
 }
 //____________________________________________________________________________
 PDGCodeList * GetNeutrinoCodes(void)
@@ -21,6 +21,8 @@
            gmxpl -f geom_file [-L length_units] [-D density_units] 
                  [-t top_vol_name] [-o output_xml_file] [-n np] [-r nr]
                  [-seed random_number_seed]
+                 [--workers n] [--resume input_xml_file]
+                 [--voxel-map voxel_map_file [--voxels nx,ny,nz[,nsub]]]
                  [--message-thresholds xml_file]
 
          Options :
@@ -40,6 +42,33 @@
                Name of output XML file [ default: maxpl.xml ]
            --seed 
                Random number seed.
+           --workers
+               Number of worker processes scanning the geometry. Each worker
+               follows its share of the scanning rays through its own copy of
+               the geometry and the results are merged at the end of the job.
+               The results are identical to the ones obtained with a single
+               process [ default: 1 ]
+           --resume
+               An XML file with max path lengths from a previous gmxpl job.
+               The max path lengths found in the current job are merged with
+               the ones in that file, so that the scan can be refined by
+               adding more rays. Use a different random number seed than in
+               the previous job(s), otherwise the same rays are scanned again.
+           --voxel-map
+               A binary file with a voxelized map of the geometry materials
+               (see genie::geometry::GeomVoxelMap). If the --voxels option is
+               set, the map is built and saved in that file. Otherwise, the
+               map is loaded from that file. In both cases, the path lengths
+               computed using the voxel map are compared with the ones
+               obtained by swimming through the geometry for all scanning
+               rays and the differences are reported at the end of the job.
+               The map can be input to the event generation drivers (see
+               gevgen_t2k --geom-voxel-map) to speed up the path length
+               computation for each flux neutrino.
+           --voxels
+               Number of voxels along x,y,z of the top volume bounding box,
+               and optionally number of points per voxel dimension used for
+               finding the voxel material [ default nsub: 1 ]
           --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -70,7 +99,9 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
 #include <string>
+#include <vector>
 
 #include <TMath.h>
 
@@ -79,12 +110,14 @@
 #include "Messenger/Messenger.h"
 #include "Numerical/RandomGen.h"
 #include "Utils/CmdLnArgParser.h"
+#include "Utils/StringUtils.h"
 #include "Utils/UnitUtils.h"
 #include "Utils/PrintUtils.h"
 #include "Utils/AppInit.h"
 #include "Utils/RunOpt.h"
 
 using std::string;
+using std::vector;
 
 using namespace genie;
 using namespace genie::geometry;
@@ -107,6 +140,10 @@ double    gOptGeomDUnits      = 0;           // input geometry density units
 int       gOptNPoints         = -1;          // input number of points / surf
 int       gOptNRays           = -1;          // input number of rays / point
 long int  gOptRanSeed         = -1;          // random number seed
+int       gOptNWorkers        = 1;           // number of worker processes
+string    gOptResumeXMLFilename = "";        // max path lengths from previous job
+string    gOptVoxelMapFilename= "";          // voxel map file
+vector<int> gOptVoxels;                      // number of voxels along x,y,z (& points/voxel dimension)
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -131,11 +168,52 @@ int main(int argc, char ** argv)
 
   if(gOptNPoints > 0) geom->SetScannerNPoints(gOptNPoints);
   if(gOptNRays   > 0) geom->SetScannerNRays  (gOptNRays);
+  geom->SetScannerNWorkers(gOptNWorkers);
+
+  // Build & save or load the voxel map, and compare the path lengths
+  // computed with the voxel map with the ones obtained by swimming
+  if(gOptVoxelMapFilename.size() > 0) {
+    if(gOptVoxels.size() > 0) {
+      int nsub = (gOptVoxels.size() > 3) ? gOptVoxels[3] : 1;
+      geom->BuildVoxelMap(gOptVoxels[0], gOptVoxels[1], gOptVoxels[2], nsub);
+      if(!geom->SaveVoxelMap(gOptVoxelMapFilename)) {
+        LOG("gmxpl", pFATAL) 
+          << "Couldn't save the voxel map in " << gOptVoxelMapFilename;
+        exit(1);
+      }
+    } else {
+      if(!geom->LoadVoxelMap(gOptVoxelMapFilename)) {
+        LOG("gmxpl", pFATAL) 
+          << "Couldn't load the voxel map from " << gOptVoxelMapFilename;
+        exit(1);
+      }
+    }
+    geom->SetValidateVoxelMap(true);
+  }
 
   // Compute the maximum path lengths
   LOG("gmxpl", pINFO)
       << "Asking input GeomAnalyzerI for the max path-lengths";
-  const PathLengthList & plmax = geom->ComputeMaxPathLengths();
+  PathLengthList plmax(geom->ComputeMaxPathLengths());
+
+  // Merge with the results of previous jobs
+  if(gOptResumeXMLFilename.size() > 0) {
+    PathLengthList plprev;
+    XmlParserStatus_t status = plprev.LoadFromXml(gOptResumeXMLFilename);
+    if(status != kXmlOK) {
+      LOG("gmxpl", pFATAL)
+        << "Couldn't read max path lengths from " << gOptResumeXMLFilename;
+      exit(1);
+    }
+    LOG("gmxpl", pINFO)
+        << "Max path lengths from previous job(s): " << plprev;
+    PathLengthList::const_iterator pliter;
+    for(pliter = plprev.begin(); pliter != plprev.end(); ++pliter) {
+      int    pdgc = pliter->first;
+      double pl   = TMath::Max(pliter->second, plmax.PathLength(pdgc));
+      plmax.SetPathLength(pdgc, pl);
+    }
+  }
 
   // Print & save the maximum path lengths in XML format
   LOG("gmxpl", pINFO)
@@ -239,6 +317,45 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gmxpl", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt("workers"));
+  } else {
+    LOG("gmxpl", pINFO) 
+      << "Unspecified number of worker processes - Using default";
+    gOptNWorkers = 1;
+  }
+
+  // max path lengths from a previous job
+  if( parser.OptionExists("resume") ) {
+    LOG("gmxpl", pINFO) << "Reading max path lengths file to resume from";
+    gOptResumeXMLFilename = parser.ArgAsString("resume");
+  }
+
+  // voxel map
+  if( parser.OptionExists("voxel-map") ) {
+    LOG("gmxpl", pINFO) << "Reading voxel map filename";
+    gOptVoxelMapFilename = parser.ArgAsString("voxel-map");
+  }
+  if( parser.OptionExists("voxels") ) {
+    LOG("gmxpl", pINFO) << "Reading number of voxels";
+    vector<string> nvox = utils::str::Split(parser.ArgAsString("voxels"), ",");
+    for(unsigned int i = 0; i < nvox.size(); i++) {
+      gOptVoxels.push_back(atoi(nvox[i].c_str()));
+    }
+    bool ok = (gOptVoxels.size() == 3 || gOptVoxels.size() == 4);
+    for(unsigned int i = 0; ok && i < gOptVoxels.size(); i++) {
+      ok = (gOptVoxels[i] > 0);
+    }
+    if(!ok || gOptVoxelMapFilename.size() == 0) {
+      LOG("gmxpl", pFATAL) 
+        << "Invalid --voxels option or no --voxel-map file - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+  }
+
   // print the command line arguments
   LOG("gmxpl", pNOTICE)
      << "\n"
@@ -251,6 +368,13 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gmxpl", pNOTICE) << "Scanner points/surface  : " << gOptNPoints;
   LOG("gmxpl", pNOTICE) << "Scanner rays/point      : " << gOptNRays;
   LOG("gmxpl", pNOTICE) << "Random number seed      : " << gOptRanSeed;
+  LOG("gmxpl", pNOTICE) << "Worker processes        : " << gOptNWorkers;
+  LOG("gmxpl", pNOTICE) << "Resume from XML file    : " << gOptResumeXMLFilename;
+  LOG("gmxpl", pNOTICE) << "Voxel map file          : " << gOptVoxelMapFilename;
+  if(gOptVoxels.size() > 0) {
+    LOG("gmxpl", pNOTICE) << "Number of voxels        : " 
+       << gOptVoxels[0] << " x " << gOptVoxels[1] << " x " << gOptVoxels[2];
+  }
 
   LOG("gmxpl", pNOTICE) << "\n";
   LOG("gmxpl", pNOTICE) << *RunOpt::Instance();
@@ -267,6 +391,9 @@ void PrintSyntax(void)
       << " [-t top_volume_name]"
       << " [-o output_xml_file]"
       << " [-seed random_number_seed]"
+      << " [--workers n]"
+      << " [--resume input_xml_file]"
+      << " [--voxel-map voxel_map_file [--voxels nx,ny,nz[,nsub]]]"
       << " [--message-thresholds xml_file]\n";
 
 }
@@ -37,6 +37,11 @@
    	       * `ghep_mock_data': 
                      Output file has the same format as the input file (GHEP) but
                      all information other than final state particles is hidden
+   	       * `gflat': 
+                     GENIE flat event format: the GHEP particle list and event
+                     weights stored as flat, columnar arrays (see NtpMCFlatEvent).
+                     Smaller and much faster to read than GHEP, but it doesn't
+                     include the interaction summary.
    	       * `rootracker': 
                      A bare-ROOT STDHEP-like GENIE event tree.
    	       * `rootracker_mock_data': 
@@ -81,6 +86,7 @@
                `gst'                  -> *.gst.root
                `gxml'                 -> *.gxml 
                `ghep_mock_data'       -> *.mockd.ghep.root
+               `gflat'                -> *.gflat.root
                `rootracker'           -> *.gtrac.root
                `rootracker_mock_data' -> *.mockd.gtrac.root
                `t2k_rootracker'       -> *.gtrac.root
@@ -182,6 +188,7 @@ using namespace genie::constants;
 void   ConvertToGST              (void);
 void   ConvertToGXML             (void);
 void   ConvertToGHepMock         (void);
+void   ConvertToGFlat            (void);
 void   ConvertToGTracker         (void);
 void   ConvertToGRooTracker      (void);
 void   ConvertToGHad             (void);
@@ -205,7 +212,8 @@ typedef enum EGNtpcFmt {
   kConvFmt_t2k_tracker,
   kConvFmt_nuance_tracker,
   kConvFmt_ghad,
-  kConvFmt_ginuke
+  kConvFmt_ginuke,
+  kConvFmt_gflat
 } GNtpcFmt_t;
 
 //input options (from command line arguments):
@@ -252,6 +260,11 @@ int main(int argc, char ** argv)
 	ConvertToGHepMock();         
 	break;
 
+   case (kConvFmt_gflat) :  
+
+	ConvertToGFlat();         
+	break;
+
    case (kConvFmt_rootracker          ) :  
    case (kConvFmt_rootracker_mock_data) :  
    case (kConvFmt_t2k_rootracker      ) :  
@@ -1197,6 +1210,59 @@ void ConvertToGHepMock(void)
   LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
 }
 //____________________________________________________________________________________
+// GENIE GHEP EVENT TREE FORMAT -> GENIE FLAT EVENT TREE FORMAT
+//____________________________________________________________________________________
+void ConvertToGFlat(void)
+{
+  //-- open the ROOT file and get the TTree & its header
+  TFile fin(gOptInpFileName.c_str(),"READ");
+  TTree *           tree = 0;
+  NtpMCTreeHeader * thdr = 0;
+  tree = dynamic_cast <TTree *>           ( fin.Get("gtree")  );
+  thdr = dynamic_cast <NtpMCTreeHeader *> ( fin.Get("header") );
+
+  LOG("gntpc", pINFO) << "Input tree header: " << *thdr;
+
+  //-- get mc record
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+
+  //-- figure out how many events to analyze
+  Long64_t nmax = (gOptN<0) ?
+       tree->GetEntries() : TMath::Min(tree->GetEntries(), gOptN);
+  if (nmax<0) {
+    LOG("gntpc", pERROR) << "Number of events = 0";
+    return;
+  }
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+
+  //-- initialize an Ntuple Writer for the flat event format
+  NtpWriter ntpw(kNFFlat, thdr->runnu);
+  ntpw.CustomizeFilename(gOptOutFileName);
+  ntpw.Initialize();
+
+  //-- event loop
+  for(Long64_t iev = 0; iev < nmax; iev++) {
+    tree->GetEntry(iev);
+    NtpMCRecHeader rec_header = mcrec->hdr;
+    EventRecord &  event      = *(mcrec->event);
+
+    LOG("gntpc", pINFO) << rec_header;
+    LOG("gntpc", pINFO) << event;
+
+    ntpw.AddEventRecord(rec_header.ievent, &event);
+
+    mcrec->Clear();
+  } // event loop
+
+  //-- save the converted events
+  ntpw.Save();
+
+  fin.Close();
+
+  LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+}
+//____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> TRACKER FORMATS
 //____________________________________________________________________________________
 void ConvertToGTracker(void)
@@ -2908,6 +2974,7 @@ void GetCommandLineArgs(int argc, char ** argv)
     else if (fmt == "nuance_tracker" )       { gOptOutFileFormat = kConvFmt_nuance_tracker;        }
     else if (fmt == "ghad")                  { gOptOutFileFormat = kConvFmt_ghad;                  }
     else if (fmt == "ginuke")                { gOptOutFileFormat = kConvFmt_ginuke;                }
+    else if (fmt == "gflat")                 { gOptOutFileFormat = kConvFmt_gflat;                 }
     else                                     { gOptOutFileFormat = kConvFmt_undef;                 }
 
     if(gOptOutFileFormat == kConvFmt_undef) {
@@ -2994,6 +3061,7 @@ string DefaultOutputFile(void)
   else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) { ext = "gtrac_legacy.dat"; }
   else if (gOptOutFileFormat == kConvFmt_ghad                 ) { ext = "ghad.dat";         }
   else if (gOptOutFileFormat == kConvFmt_ginuke               ) { ext = "ginuke.root";      }
+  else if (gOptOutFileFormat == kConvFmt_gflat                ) { ext = "gflat.root";       }
 
   string inpname = gOptInpFileName;
   unsigned int L = inpname.length();
@@ -3029,6 +3097,7 @@ int LatestFormatVersionNumber(void)
   else if (gOptOutFileFormat == kConvFmt_nuance_tracker       ) return 1;
   else if (gOptOutFileFormat == kConvFmt_ghad                 ) return 1;
   else if (gOptOutFileFormat == kConvFmt_ginuke               ) return 1;
+  else if (gOptOutFileFormat == kConvFmt_gflat                ) return 1;
 
   return -1;
 }
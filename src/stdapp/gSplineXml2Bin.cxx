@@ -0,0 +1,148 @@
+//____________________________________________________________________________
+/*!
+
+\program gspl2bin
+
+\brief   Converts an XML file containing GENIE cross section splines into a
+         binary spline archive.
+         Binary archives can be used in place of XML files in all GENIE apps
+         reading cross section splines (eg gevgen --cross-sections). They are
+         memory-mapped rather than parsed, so loading takes no time regardless
+         of the number of splines, and only the splines actually needed by a
+         job are built. The knots are stored exactly, so event generation is
+         identical whichever format is used.
+         Archives are written in the native byte order and can only be read
+         on machines with the same byte order.
+
+         Syntax :
+           gspl2bin -f input.xml -o output.bin
+                    [--message-thresholds xml_file]
+
+         Options :
+           -f 
+              input xml cross-section file
+           -o 
+              output binary spline archive
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Example :
+
+           shell% gspl2bin -f xsec.xml -o xsec.bin
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include "Conventions/XmlParserStatus.h"
+#include "Messenger/Messenger.h"
+#include "Utils/RunOpt.h"
+#include "Utils/AppInit.h"
+#include "Utils/XSecSplineList.h"
+#include "Utils/SystemUtils.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+string gInpFile;   ///< input XML file
+string gOutFile;   ///< output binary spline archive
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  LOG("gspl2bin", pNOTICE) << " ---- >> Loading file : " << gInpFile;
+  XmlParserStatus_t ist = xspl->LoadFromXml(gInpFile);
+  if(ist != kXmlOK) {
+    LOG("gspl2bin", pFATAL) << "Problem reading file: " << gInpFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  int nspl = xspl->NSplines();
+
+  LOG("gspl2bin", pNOTICE) 
+     << " ****** Saving " << nspl << " splines into : " << gOutFile;
+  if(!xspl->SaveAsBinary(gOutFile)) {
+    LOG("gspl2bin", pFATAL) << "Problem writing file: " << gOutFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // read back the archive & check it
+  ist = xspl->LoadFromBinary(gOutFile);
+  if(ist != kXmlOK || xspl->NSplines() != nspl) {
+    LOG("gspl2bin", pFATAL) 
+      << "The binary spline archive: " << gOutFile << " can not be read back!";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gspl2bin", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. 
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('f') ) {
+    LOG("gspl2bin", pINFO) << "Reading input file name";
+    gInpFile = parser.ArgAsString('f');
+  } else {
+    LOG("gspl2bin", pFATAL) << "You must specify an input file name";
+    PrintSyntax();
+    exit(1);
+  }
+  if(!utils::system::FileExists(gInpFile)) {
+    LOG("gspl2bin", pFATAL) 
+      << "Input cross-section file [" << gInpFile << "] does not exist!";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('o') ) {
+    LOG("gspl2bin", pINFO) << "Reading output file name";
+    gOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gspl2bin", pFATAL) << "You must specify an output file name";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gspl2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gspl2bin  -f input.xml -o output.bin\n"
+    << "             [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
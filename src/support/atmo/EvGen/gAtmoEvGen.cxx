@@ -28,6 +28,7 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--max-xsec-tables xml_file]
 
          *** Options :
 
@@ -162,6 +163,10 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --max-xsec-tables
+              Allows users to specify an XML file with precomputed max
+              differential cross-section tables (see gmkmaxxsec), so that the
+              kinematics generators run at full speed from the first event.
 
          *** Examples:
 
@@ -303,6 +308,7 @@ int main(int argc, char** argv)
   // Iinitialization of random number generators, cross-section table, messenger, cache etc...
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTables(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, true);
 
@@ -337,6 +343,7 @@ int main(int argc, char** argv)
   for(int iev = 0; iev < gOptNev; iev++) {
 
     // generate next event
+    RandomGen::Instance()->SetEvent(gOptRunNu, iev);
     EventRecord* event = mcj_driver->GenerateEvent();
 
     // set weight (if using a weighted flux)
@@ -952,6 +959,7 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--max-xsec-tables xml_file]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << "\n";
@@ -42,6 +42,7 @@
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
                        [--cache-file root_file]
+                       [--max-xsec-tables xml_file]
 
          *** Options :
 
@@ -209,6 +210,10 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --max-xsec-tables
+              Allows users to specify an XML file with precomputed max
+              differential cross-section tables (see gmkmaxxsec), so that the
+              kinematics generators run at full speed from the first event.
 
          *** Examples:
         
@@ -359,6 +364,7 @@ int main(int argc, char ** argv)
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTables(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
 
@@ -574,6 +580,7 @@ int main(int argc, char ** argv)
 
      // Generate a single event using neutrinos coming from the specified flux
      // and hitting the specified geometry or target mix
+     RandomGen::Instance()->SetEvent(gOptRunNu, ievent);
      EventRecord * event = mcj_driver->GenerateEvent();
 
      // Check whether a null event was returned due to the flux driver reaching
@@ -1151,6 +1158,7 @@ void PrintSyntax(void)
    << "\n            [--event-record-print-level level]"
    << "\n            [--mc-job-status-refresh-rate  rate]"
    << "\n            [--cache-file root_file]"
+   << "\n            [--max-xsec-tables xml_file]"
    << "\n"
    << " Please also read the detailed documentation at "
    << "$GENIE//src/support/numi/EvGen/gNuMIExptEvGen.cxx"
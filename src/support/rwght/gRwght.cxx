@@ -0,0 +1,617 @@
+//____________________________________________________________________________
+/*!
+
+\program grwght
+
+\brief   Generates weights given an input GHEP event file, a set of systematic
+         parameters (supported by the ReWeight package) and many sets of
+         values for these parameters ("universes"), eg random throws used for
+         building covariance matrices.
+         The events are read once, in blocks kept in memory, and the weights
+         of each block of events are computed for all universes in one go
+         (see GReWeight::CalcWeights()), optionally using several worker
+         processes.
+         It outputs a ROOT file containing a flat tree with an entry for every
+         input event (tree `gweights', branches `eventnum' and `weights', a
+         fixed-size array with one weight per universe) and a tree with an
+         entry for every universe (tree `universes', with a branch holding
+         the value of each systematic param).
+
+\syntax  grwght \
+           -f input_event_file
+          [-n n1[,n2]]
+           -s systematic1[,systematic2,...]
+           -u n_universes | -d dial_values_file
+          [-p neutrino_codes]
+          [-o output_weights_file]
+          [-b events_per_block]
+          [--workers n]
+          [--seed random_number_seed]
+          [--message-thresholds xml_file]
+          [--event-record-print-level level]
+
+         where
+         [] is an optional argument.
+
+         -f
+            Specifies a GHEP input file.
+         -n
+            Specifies an event range (see grwght1scan).
+         -s
+            Specifies a comma-separated list of systematic params to tweak.
+            See $GENIE/src/ReWeight/GSyst.h for a list of parameters and
+            their corresponding label, which is what should be input here.
+         -u
+            Specifies the number of universes. In each universe the tweaking
+            dial of each systematic param is thrown from a normal distribution
+            (the tweaking dials are expressed in units of 1 sigma).
+         -d
+            Rather than throwing random universes, read the tweaking dial
+            values from the input text file: One line per universe, listing
+            the tweaking dial values for all systematic params (in the order
+            given with -s). Lines starting with # are ignored.
+         -p
+            If set, grwght reweights *only* the specified neutrino species
+            (other events get a weight of 1). The input is a comma separated
+            list of PDG codes.
+            By default GENIE will reweight all neutrino species.
+         -o
+            Specifies the filename of the output weight file.
+            By default filename is weights_universes.root.
+         -b
+            Number of events kept in memory and reweighted together.
+            Default: 10000.
+         --workers
+            Number of worker processes the universes are shared out to.
+            Default: 1.
+         --seed
+            Random number seed.
+         --message-thresholds
+            Allows users to customize the message stream thresholds.
+            The thresholds are specified using an XML file.
+            See $GENIE/config/Messenger.xml for the XML schema.
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <cassert>
+
+#include <TSystem.h>
+#include <TFile.h>
+#include <TTree.h>
+#include <TMath.h>
+#include <TStopwatch.h>
+
+#include "EVGCore/EventRecord.h"
+#include "GHEP/GHepParticle.h"
+#include "Ntuple/NtpMCFormat.h"
+#include "Ntuple/NtpMCTreeHeader.h"
+#include "Ntuple/NtpMCEventRecord.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/RandomGen.h"
+#include "PDG/PDGCodes.h"
+#include "PDG/PDGCodeList.h"
+#include "ReWeight/GReWeightI.h"
+#include "ReWeight/GSystSet.h"
+#include "ReWeight/GSyst.h"
+#include "ReWeight/GReWeight.h"
+#include "ReWeight/GReWeightNuXSecNCEL.h"
+#include "ReWeight/GReWeightNuXSecCCQE.h"
+#include "ReWeight/GReWeightNuXSecCCRES.h"
+#include "ReWeight/GReWeightNuXSecCOH.h"
+#include "ReWeight/GReWeightNonResonanceBkg.h"
+#include "ReWeight/GReWeightFGM.h"
+#include "ReWeight/GReWeightDISNuclMod.h"
+#include "ReWeight/GReWeightResonanceDecay.h"
+#include "ReWeight/GReWeightFZone.h"
+#include "ReWeight/GReWeightINuke.h"
+#include "ReWeight/GReWeightAGKY.h"
+#include "ReWeight/GReWeightNuXSecCCQEvec.h"
+#include "ReWeight/GReWeightNuXSecNCRES.h"
+#include "ReWeight/GReWeightNuXSecDIS.h"
+#include "Utils/AppInit.h"
+#include "Utils/RunOpt.h"
+#include "Utils/CmdLnArgParser.h"
+#include "Utils/StringUtils.h"
+
+using std::string;
+using std::ostringstream;
+using std::ifstream;
+using std::vector;
+
+using namespace genie;
+using namespace genie::rew;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+void GetEventRange      (Long64_t nev_in_file, Long64_t & nfirst, Long64_t & nlast);
+void GetUniverses       (vector< vector<double> > & dials);
+void SetWghtCalcModes   (GReWeight & rw);
+
+string          gOptInpFilename; ///< name for input file (contains input event tree)
+string          gOptOutFilename; ///< name for output file (contains the output weight trees)
+string          gOptDialFilename;///< name for input file with dial values (if any)
+Long64_t        gOptNEvt1;       ///< range of events to process (1st input, if any)
+Long64_t        gOptNEvt2;       ///< range of events to process (2nd input, if any)
+vector<GSyst_t> gOptSyst;        ///< input systematic params
+int             gOptNUniv;       ///< number of random universes
+int             gOptBlockSize;   ///< number of events reweighted together
+int             gOptNWorkers;    ///< number of worker processes
+PDGCodeList     gOptNu(false);   ///< neutrinos to consider
+long int        gOptRanSeed;     ///< random number seed
+
+//___________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs (argc, argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+
+  // Get the input event sample
+  TTree *           tree = 0;
+  NtpMCTreeHeader * thdr = 0;
+  TFile file(gOptInpFilename.c_str(),"READ");
+  tree = dynamic_cast <TTree *>           ( file.Get("gtree")  );
+  thdr = dynamic_cast <NtpMCTreeHeader *> ( file.Get("header") );
+  if(!tree){
+    LOG("grwght", pFATAL)
+      << "Can't find a GHEP tree in input file: "<< file.GetName();
+    gAbortingInErr = true;
+    PrintSyntax();
+    exit(1);
+  }
+  if(thdr) {
+    LOG("grwght", pNOTICE) << "Input tree header: " << *thdr;
+  }
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+
+  Long64_t nev_in_file = tree->GetEntries();
+
+  // Work-out the range of events to process
+  Long64_t nfirst = 0;
+  Long64_t nlast  = 0;
+  GetEventRange(nev_in_file, nfirst, nlast);
+
+  Long64_t nev = (nlast - nfirst + 1);
+
+  // Get the universes
+  vector< vector<double> > dials;
+  GetUniverses(dials);
+  const int nuniv = dials.size();
+  const int nsyst = gOptSyst.size();
+
+  //
+  // Summarize
+  //
+
+  ostringstream systs;
+  for(int is = 0; is < nsyst; is++) {
+    systs << GSyst::AsString(gOptSyst[is]) << " ";
+  }
+  LOG("grwght", pNOTICE)
+    << "\n"
+    << "\n** grwght: Will start processing events promptly."
+    << "\nHere is a summary of inputs: "
+    << "\n - Input event file: " << gOptInpFilename
+    << "\n - Processing: " << nev << " events in the range [" << nfirst << ", " << nlast << "]"
+    << "\n - Systematic parameters to tweak: " << systs.str()
+    << "\n - Number of universes : " << nuniv
+    << ((gOptDialFilename.size()>0) ? (" (from " + gOptDialFilename + ")") : " (random)")
+    << "\n - Neutrino species to reweight : " << gOptNu
+    << "\n - Events reweighted together : " << gOptBlockSize
+    << "\n - Number of worker processes : " << gOptNWorkers
+    << "\n - Output weights to be saved in : " << gOptOutFilename
+    << "\n - Specified random number seed : " << gOptRanSeed
+    << "\n\n";
+
+  // Create a GReWeight object and add to it a set of weight calculators
+
+  GReWeight rw;
+  rw.AdoptWghtCalc( "xsec_ncel",       new GReWeightNuXSecNCEL      );
+  rw.AdoptWghtCalc( "xsec_ccqe",       new GReWeightNuXSecCCQE      );
+  rw.AdoptWghtCalc( "xsec_ccqe_vec",   new GReWeightNuXSecCCQEvec   );
+  rw.AdoptWghtCalc( "xsec_ccres",      new GReWeightNuXSecCCRES     );
+  rw.AdoptWghtCalc( "xsec_ncres",      new GReWeightNuXSecNCRES     );
+  rw.AdoptWghtCalc( "xsec_nonresbkg",  new GReWeightNonResonanceBkg );
+  rw.AdoptWghtCalc( "xsec_coh",        new GReWeightNuXSecCOH       );
+  rw.AdoptWghtCalc( "xsec_dis",        new GReWeightNuXSecDIS       );
+  rw.AdoptWghtCalc( "nuclear_qe",      new GReWeightFGM             );
+  rw.AdoptWghtCalc( "nuclear_dis",     new GReWeightDISNuclMod      );
+  rw.AdoptWghtCalc( "hadro_res_decay", new GReWeightResonanceDecay  );
+  rw.AdoptWghtCalc( "hadro_fzone",     new GReWeightFZone           );
+  rw.AdoptWghtCalc( "hadro_intranuke", new GReWeightINuke           );
+  rw.AdoptWghtCalc( "hadro_agky",      new GReWeightAGKY            );
+
+  // Include the input systematic params & fine-tune the weight calculators
+
+  GSystSet & syst = rw.Systematics();
+  for(int is = 0; is < nsyst; is++) {
+    syst.Init(gOptSyst[is]);
+  }
+  SetWghtCalcModes(rw);
+  rw.Reconfigure();
+  rw.SetNWorkers(gOptNWorkers);
+
+  // Make an output tree for saving the weights: one entry per event with
+  // a flat array holding the weight for each universe
+  TFile * wght_file = new TFile(gOptOutFilename.c_str(), "RECREATE");
+  TTree * wght_tree = new TTree("gweights", "GENIE weights tree");
+  int     branch_eventnum = 0;
+  float * branch_weights  = new float[nuniv];
+  ostringstream leaves;
+  leaves << "weights[" << nuniv << "]/F";
+  wght_tree->Branch("eventnum", &branch_eventnum, "eventnum/I");
+  wght_tree->Branch("weights",   branch_weights,  leaves.str().c_str());
+
+  // Event loop, in blocks of events kept in memory
+
+  TStopwatch timer;
+  timer.Start();
+
+  vector<EventRecord *> block;        // events in current block
+  vector<EventRecord *> rw_events;    // events to reweight in current block
+  vector<int>           rw_index;     // their position in the block
+  vector<double>        weights;
+
+  for(Long64_t iblock = nfirst; iblock <= nlast; iblock += gOptBlockSize) {
+
+     Long64_t iblock_last = TMath::Min(nlast, iblock + gOptBlockSize - 1);
+
+     LOG("grwght", pNOTICE)
+        << "***** Reweighting events " << iblock << " - " << iblock_last;
+
+     // Read the events
+     block.clear();
+     rw_events.clear();
+     rw_index.clear();
+     for(Long64_t iev = iblock; iev <= iblock_last; iev++) {
+        tree->GetEntry(iev);
+        EventRecord * event = new EventRecord(*(mcrec->event));
+        LOG("grwght", pINFO) << "Event: " << iev << "\n" << *event;
+        mcrec->Clear();
+
+        int nupdg = event->Probe()->Pdg();
+        if(gOptNu.ExistsInPDGCodeList(nupdg)) {
+           rw_index.push_back(block.size());
+           rw_events.push_back(event);
+        }
+        block.push_back(event);
+     }
+
+     // Calculate the weights in all universes
+     rw.CalcWeights(rw_events, gOptSyst, dials, weights);
+
+     // Store
+     unsigned int irw = 0;
+     for(unsigned int ib = 0; ib < block.size(); ib++) {
+        branch_eventnum = iblock + ib;
+        bool reweighted = (irw < rw_index.size() && rw_index[irw] == (int)ib);
+        for(int iu = 0; iu < nuniv; iu++) {
+          branch_weights[iu] = (reweighted) ? weights[irw*nuniv + iu] : 1.;
+        }
+        if(reweighted) irw++;
+        wght_tree->Fill();
+        delete block[ib];
+     }
+  } // event blocks
+
+  timer.Stop();
+
+  // Close event file
+  file.Close();
+
+  // Make an output tree for saving the tweaking dial values in each universe
+  TTree * univ_tree = new TTree("universes", "GENIE reweighting universes");
+  double * branch_dials = new double[nsyst];
+  for(int is = 0; is < nsyst; is++) {
+    string name = GSyst::AsString(gOptSyst[is]);
+    univ_tree->Branch(name.c_str(), &branch_dials[is], (name + "/D").c_str());
+  }
+  for(int iu = 0; iu < nuniv; iu++) {
+    for(int is = 0; is < nsyst; is++) branch_dials[is] = dials[iu][is];
+    univ_tree->Fill();
+  }
+
+  //
+  // Save weights
+  //
+
+  wght_file->cd();
+  wght_tree->Write();
+  univ_tree->Write();
+  delete wght_tree;
+  delete univ_tree;
+  wght_file->Close();
+  delete wght_file;
+  delete [] branch_weights;
+  delete [] branch_dials;
+
+  LOG("grwght", pNOTICE)
+    << "Reweighted " << nev << " events in " << nuniv << " universes in "
+    << timer.RealTime() << " sec";
+  LOG("grwght", pNOTICE)  << "Done!";
+
+  return 0;
+}
+//___________________________________________________________________
+void SetWghtCalcModes(GReWeight & rw)
+{
+// Switch the weight calculators to the modes appropriate for the input
+// systematic params (as in grwght1scan)
+
+  for(unsigned int is = 0; is < gOptSyst.size(); is++) {
+    GSyst_t s = gOptSyst[is];
+    if(s == kXSecTwkDial_MaCCQE) {
+       GReWeightNuXSecCCQE * rwccqe =
+          dynamic_cast<GReWeightNuXSecCCQE *> (rw.WghtCalc("xsec_ccqe"));
+       rwccqe->SetMode(GReWeightNuXSecCCQE::kModeMa);
+    }
+    if(s == kXSecTwkDial_MaCCRES || s == kXSecTwkDial_MvCCRES) {
+       GReWeightNuXSecCCRES * rwccres =
+          dynamic_cast<GReWeightNuXSecCCRES *> (rw.WghtCalc("xsec_ccres"));
+       rwccres->SetMode(GReWeightNuXSecCCRES::kModeMaMv);
+    }
+    if(s == kXSecTwkDial_MaNCRES || s == kXSecTwkDial_MvNCRES) {
+       GReWeightNuXSecNCRES * rwncres =
+          dynamic_cast<GReWeightNuXSecNCRES *> (rw.WghtCalc("xsec_ncres"));
+       rwncres->SetMode(GReWeightNuXSecNCRES::kModeMaMv);
+    }
+    if(s == kXSecTwkDial_AhtBYshape  || s == kXSecTwkDial_BhtBYshape ||
+       s == kXSecTwkDial_CV1uBYshape || s == kXSecTwkDial_CV2uBYshape ) {
+       GReWeightNuXSecDIS * rwdis =
+          dynamic_cast<GReWeightNuXSecDIS *> (rw.WghtCalc("xsec_dis"));
+       rwdis->SetMode(GReWeightNuXSecDIS::kModeABCV12uShape);
+    }
+  }
+}
+//___________________________________________________________________
+void GetUniverses(vector< vector<double> > & dials)
+{
+  dials.clear();
+  unsigned int nsyst = gOptSyst.size();
+
+  // random universes
+  if(gOptDialFilename.size() == 0) {
+    TRandom & rnd = RandomGen::Instance()->RndGen();
+    for(int iu = 0; iu < gOptNUniv; iu++) {
+      vector<double> values(nsyst, 0.);
+      for(unsigned int is = 0; is < nsyst; is++) values[is] = rnd.Gaus();
+      dials.push_back(values);
+    }
+    return;
+  }
+
+  // universes from an input file
+  ifstream dial_file(gOptDialFilename.c_str());
+  if(!dial_file.good()) {
+    LOG("grwght", pFATAL)
+      << "Can't read tweaking dial values from: " << gOptDialFilename;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  string line;
+  while(std::getline(dial_file, line)) {
+    line = utils::str::TrimSpaces(line);
+    if(line.size() == 0 || line[0] == '#') continue;
+    std::istringstream values_stream(line);
+    vector<double> values;
+    double value = 0;
+    while(values_stream >> value) values.push_back(value);
+    if(values.size() != nsyst) {
+      LOG("grwght", pFATAL)
+        << "Expected " << nsyst << " tweaking dial values per universe. "
+        << "Found " << values.size() << " in line: " << line;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    dials.push_back(values);
+  }
+  if(dials.size() == 0) {
+    LOG("grwght", pFATAL) << "No universes in: " << gOptDialFilename;
+    gAbortingInErr = true;
+    exit(1);
+  }
+}
+//___________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("grwght", pINFO) << "Parsing command line arguments";
+
+  // Common run options. Set defaults and read.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // get GENIE event sample
+  if(parser.OptionExists('f')) {
+    LOG("grwght", pINFO) << "Reading event sample filename";
+    gOptInpFilename = parser.ArgAsString('f');
+  } else {
+    LOG("grwght", pFATAL)
+        << "Unspecified input filename - Exiting";
+    gAbortingInErr = true;
+    PrintSyntax();
+    exit(1);
+  }
+
+  // range of event numbers to process
+  if ( parser.OptionExists('n') ) {
+    LOG("grwght", pINFO) << "Reading number of events to analyze";
+    string nev =  parser.ArgAsString('n');
+    if (nev.find(",") != string::npos) {
+      vector<long> vecn = parser.ArgAsLongTokens('n',",");
+      if(vecn.size()!=2) {
+         LOG("grwght", pFATAL) << "Invalid syntax";
+         gAbortingInErr = true;
+         PrintSyntax();
+         exit(1);
+      }
+      gOptNEvt1 = vecn[0];
+      gOptNEvt2 = vecn[1];
+    } else {
+      gOptNEvt1 = -1;
+      gOptNEvt2 = parser.ArgAsLong('n');
+    }
+  } else {
+    LOG("grwght", pINFO)
+      << "Unspecified number of events to analyze - Use all";
+    gOptNEvt1 = -1;
+    gOptNEvt2 = -1;
+  }
+
+  // get the systematics
+  if(parser.OptionExists('s')) {
+   LOG("grwght", pINFO) << "Reading input systematic parameters";
+   vector<string> systematics = parser.ArgAsStringTokens('s', ",");
+   vector<string>::const_iterator it = systematics.begin();
+   for( ; it != systematics.end(); ++it) {
+     GSyst_t s = GSyst::FromString(utils::str::TrimSpaces(*it));
+     if(s == kNullSystematic) {
+        LOG("grwght", pFATAL) << "Unknown systematic: " << *it;
+        gAbortingInErr = true;
+        PrintSyntax();
+        exit(1);
+     }
+     gOptSyst.push_back(s);
+   }
+  }
+  if(gOptSyst.size() == 0) {
+    LOG("grwght", pFATAL)
+       << "You need to specify the systematic params using -s";
+    gAbortingInErr = true;
+    PrintSyntax();
+    exit(1);
+  }
+
+  // get the universes
+  gOptNUniv = 0;
+  if(parser.OptionExists('d')) {
+    LOG("grwght", pINFO) << "Reading tweaking dial values filename";
+    gOptDialFilename = parser.ArgAsString('d');
+  }
+  else if(parser.OptionExists('u')) {
+    LOG("grwght", pINFO) << "Reading number of universes";
+    gOptNUniv = parser.ArgAsInt('u');
+  }
+  if(gOptDialFilename.size() == 0 && gOptNUniv <= 0) {
+    LOG("grwght", pFATAL)
+       << "You need to specify the number of universes (-u) "
+       << "or a file with tweaking dial values (-d)";
+    gAbortingInErr = true;
+    PrintSyntax();
+    exit(1);
+  }
+
+  // output weight file
+  if(parser.OptionExists('o')) {
+    LOG("grwght", pINFO) << "Reading requested output filename";
+    gOptOutFilename = parser.ArgAsString('o');
+  } else {
+    LOG("grwght", pINFO) << "Setting default output filename";
+    gOptOutFilename = "weights_universes.root";
+  }
+
+  // events reweighted together
+  gOptBlockSize = (parser.OptionExists('b')) ? parser.ArgAsInt('b') : 10000;
+  gOptBlockSize = TMath::Max(1, gOptBlockSize);
+
+  // number of worker processes
+  gOptNWorkers = (parser.OptionExists("workers")) ?
+                  parser.ArgAsInt("workers") : 1;
+  gOptNWorkers = TMath::Max(1, gOptNWorkers);
+
+  // which species to reweight?
+  if(parser.OptionExists('p')) {
+   LOG("grwght", pINFO) << "Reading input list of neutrino codes";
+   vector<int> vecpdg = parser.ArgAsIntTokens('p',",");
+   if(vecpdg.size()==0) {
+      LOG("grwght", pFATAL) << "Empty list of neutrino codes!?";
+      gAbortingInErr = true;
+      PrintSyntax();
+      exit(1);
+   }
+   vector<int>::const_iterator it = vecpdg.begin();
+   for( ; it!=vecpdg.end(); ++it) {
+     gOptNu.push_back(*it);
+   }
+  } else {
+    LOG("grwght", pINFO) << "Considering all neutrino species";
+    gOptNu.push_back (kPdgNuE      );
+    gOptNu.push_back (kPdgAntiNuE  );
+    gOptNu.push_back (kPdgNuMu     );
+    gOptNu.push_back (kPdgAntiNuMu );
+    gOptNu.push_back (kPdgNuTau    );
+    gOptNu.push_back (kPdgAntiNuTau);
+  }
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    LOG("grwght", pINFO) << "Reading random number seed";
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("grwght", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
+}
+//_________________________________________________________________________________
+void GetEventRange(Long64_t nev_in_file, Long64_t & nfirst, Long64_t & nlast)
+{
+  nfirst = 0;
+  nlast  = 0;
+
+  if(gOptNEvt1>=0 && gOptNEvt2>=0) {
+    // Input was `-n N1,N2'. Process events [N1,N2].
+    nfirst = gOptNEvt1;
+    nlast  = TMath::Min(nev_in_file-1, gOptNEvt2);
+  }
+  else
+  if(gOptNEvt1<0 && gOptNEvt2>=0) {
+    // Input was `-n N'. Process first N events [0,N).
+    nfirst = 0;
+    nlast  = TMath::Min(nev_in_file-1, gOptNEvt2-1);
+  }
+  else
+  if(gOptNEvt1<0 && gOptNEvt2<0) {
+    // No input. Process all events.
+    nfirst = 0;
+    nlast  = nev_in_file-1;
+  }
+
+  assert(nfirst <= nlast && nfirst >= 0 && nlast <= nev_in_file-1);
+}
+//_________________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("grwght", pFATAL)
+     << "\n\n"
+     << "grwght                                    \n"
+     << "     -f input_event_file                  \n"
+     << "    [-n n1[,n2]]                          \n"
+     << "     -s systematic1[,systematic2,...]     \n"
+     << "     -u n_universes | -d dial_values_file \n"
+     << "    [-p neutrino_codes]                   \n"
+     << "    [-o output_weights_file]              \n"
+     << "    [-b events_per_block]                 \n"
+     << "    [--workers n]                         \n"
+     << "    [--seed random_number_seed]           \n"
+     << "    [--message-thresholds xml_file]       \n"
+     << "    [--event-record-print-level level]\n\n\n"
+     << " See the GENIE Physics and User manual for more details";
+}
+//_________________________________________________________________________________
@@ -10,8 +10,19 @@
          weights and a TArrayF of all used tweak dial values. 
          Is a RAL/T2K analysis program.
 
+         The weights computed at the tweak dial values of an output weight
+         file can be used as the knots of per-event response functions (see
+         GReWeightResponse): For each event, the output tree also contains
+         an estimate of the interpolation error of its response function
+         (`resperr'). When the full event range is processed, the weight tree
+         can be used as a friend tree of the input event tree.
+         If a weight file is input using -r, no event file is read and no
+         cross section is computed: The weights at the requested tweak dial
+         values are evaluated from the response functions built from the
+         weights stored in the input weight file.
+
 \syntax  grwght1scan \
-           -f input_event_file 
+           -f input_event_file | -r input_response_file
           [-n n1[,n2]] 
            -s systematic 
            -t n_twk_diall_values
@@ -26,6 +37,11 @@
 
          -f 
             Specifies a GHEP input file.
+         -r 
+            Specifies a weight file, output by an earlier grwght1scan job for
+            the same systematic param, whose weights are used as response
+            function knots. Typically computed at a handful (5-9) of tweak
+            dial values, it can then be used for scanning many more.
          -n 
             Specifies an event range.
             Examples:
@@ -81,6 +97,8 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TArrayF.h>
+#include <TMath.h>
+#include <TStopwatch.h>
 
 #include "EVGCore/EventRecord.h"
 #include "GHEP/GHepParticle.h"
@@ -95,6 +113,7 @@
 #include "ReWeight/GSystSet.h"
 #include "ReWeight/GSyst.h"
 #include "ReWeight/GReWeight.h"
+#include "ReWeight/GReWeightResponse.h"
 #include "ReWeight/GReWeightNuXSecNCEL.h"
 #include "ReWeight/GReWeightNuXSecCCQE.h"
 #include "ReWeight/GReWeightNuXSecCCRES.h"
@@ -122,8 +141,10 @@ using namespace genie::rew;
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 void GetEventRange      (Long64_t nev_in_file, Long64_t & nfirst, Long64_t & nlast);
+int  ScanResponses      (void);
 
 string      gOptInpFilename; ///< name for input file (contains input event tree)
+string      gOptRspFilename; ///< name for input response file (contains an earlier output weight tree)
 string      gOptOutFilename; ///< name for output file (contains the output weight tree)
 Long64_t    gOptNEvt1;       ///< range of events to process (1st input, if any)
 Long64_t    gOptNEvt2;       ///< range of events to process (2nd input, if any)
@@ -141,6 +162,11 @@ int main(int argc, char ** argv)
   utils::app_init::RandGen(gOptRanSeed);
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
+  // Scan using the response functions stored in an earlier weight file?
+  if(gOptRspFilename.size() > 0) {
+    return ScanResponses();
+  }
+
   // Get the input event sample
   TTree *           tree = 0;
   NtpMCTreeHeader * thdr = 0;
@@ -315,11 +341,17 @@ int main(int argc, char ** argv)
   TFile * wght_file = new TFile(gOptOutFilename.c_str(), "RECREATE");
   TTree * wght_tree = new TTree(GSyst::AsString(gOptSyst).c_str(), "GENIE weights tree");
   int branch_eventnum = 0;
+  float branch_resperr = 0;
   TArrayF * branch_weight_array   = new TArrayF(n_points);
   TArrayF * branch_twkdials_array = new TArrayF(n_points);  
   wght_tree->Branch("eventnum", &branch_eventnum);
   wght_tree->Branch("weights",  &branch_weight_array);
   wght_tree->Branch("twkdials", &branch_twkdials_array);
+  wght_tree->Branch("resperr",  &branch_resperr, "resperr/F");
+
+  double * knot_dials   = new double[n_points];
+  double * knot_weights = new double[n_points];
+  double   max_resperr  = 0;
 
   for(int iev = nfirst; iev <= nlast; iev++) {
     int idx = iev - nfirst;
@@ -330,9 +362,19 @@ int main(int argc, char ** argv)
           << ", twk dial = "<< twkdials[idx][ith_dial];
        branch_weight_array   -> AddAt (weights [idx][ith_dial], ith_dial);
        branch_twkdials_array -> AddAt (twkdials[idx][ith_dial], ith_dial);
+       knot_dials  [ith_dial] = twkdials[idx][ith_dial];
+       knot_weights[ith_dial] = weights [idx][ith_dial];
     } // twk_dial loop
+    GReWeightResponse response(n_points, knot_dials, knot_weights);
+    branch_resperr = response.LeaveOneOutError();
+    max_resperr = TMath::Max(max_resperr, (double)branch_resperr);
     wght_tree->Fill();
   } 
+  delete [] knot_dials;
+  delete [] knot_weights;
+
+  LOG("grwght1scan", pNOTICE) 
+    << "Max estimated response function interpolation error: " << max_resperr;
 
   wght_file->cd();
   wght_tree->Write();
@@ -359,11 +401,17 @@ void GetCommandLineArgs(int argc, char ** argv)
 
   CmdLnArgParser parser(argc,argv);
 
+  // get input response file
+  if(parser.OptionExists('r')) {
+    LOG("grwght1scan", pINFO) << "Reading response file filename";
+    gOptRspFilename = parser.ArgAsString('r');
+  }
+
   // get GENIE event sample
   if(parser.OptionExists('f')) {
     LOG("grwght1scan", pINFO) << "Reading event sample filename";
     gOptInpFilename = parser.ArgAsString('f');
-  } else {
+  } else if(gOptRspFilename.size() == 0) {
     LOG("grwght1scan", pFATAL) 
         << "Unspecified input filename - Exiting";
     gAbortingInErr = true;
@@ -532,7 +580,7 @@ void PrintSyntax(void)
   LOG("grwght1scan", pFATAL)
      << "\n\n"
      << "grwght1scan                  \n"
-     << "     -f input_event_file     \n"
+     << "     -f input_event_file | -r input_response_file \n"
      << "    [-n n1[,n2]]             \n"
      << "     -s systematic           \n"
      << "     -t n_twk_diall_values   \n"
@@ -545,3 +593,116 @@ void PrintSyntax(void)
 }
 //_________________________________________________________________________________
 
+int ScanResponses(void)
+{
+// Evaluate the weights at the requested tweak dial values from the response
+// functions built from the weights stored in an earlier grwght1scan output
+
+  TFile rsp_file(gOptRspFilename.c_str(), "READ");
+  TTree * rsp_tree = dynamic_cast <TTree *> (
+      rsp_file.Get(GSyst::AsString(gOptSyst).c_str()) );
+  if(!rsp_tree) {
+    LOG("grwght1scan", pFATAL) 
+      << "Can't find a " << GSyst::AsString(gOptSyst) 
+      << " weight tree in input response file: " << gOptRspFilename;
+    gAbortingInErr = true;
+    PrintSyntax();
+    exit(1);
+  }
+  int       rsp_eventnum = 0;
+  float     rsp_resperr  = 0;
+  TArrayF * rsp_weights  = 0;
+  TArrayF * rsp_twkdials = 0;
+  rsp_tree->SetBranchAddress("eventnum", &rsp_eventnum);
+  rsp_tree->SetBranchAddress("weights",  &rsp_weights);
+  rsp_tree->SetBranchAddress("twkdials", &rsp_twkdials);
+  bool has_resperr = (rsp_tree->GetBranch("resperr") != 0);
+  if(has_resperr) {
+    rsp_tree->SetBranchAddress("resperr", &rsp_resperr);
+  }
+
+  Long64_t nfirst = 0;
+  Long64_t nlast  = 0;
+  GetEventRange(rsp_tree->GetEntries(), nfirst, nlast);
+
+  const int   n_points      = gOptInpNTwk;
+  const float twk_dial_min  = -1.0;
+  const float twk_dial_max  =  1.0;
+  const float twk_dial_step = (twk_dial_max - twk_dial_min) / (n_points-1);
+
+  LOG("grwght1scan", pNOTICE) 
+    << "\n"
+    << "\n** grwght1scan: Will scan response functions promptly."
+    << "\n - Input response file: " << gOptRspFilename 
+    << "\n - Processing: " << nlast-nfirst+1 << " entries in the range [" << nfirst << ", " << nlast << "]"
+    << "\n - Systematic parameter to tweak: " << GSyst::AsString(gOptSyst)
+    << "\n - Number of tweak dial values in [-1,1] : " << n_points
+    << "\n - Output weights to be saved in : " << gOptOutFilename 
+    << "\n\n";
+
+  TFile * wght_file = new TFile(gOptOutFilename.c_str(), "RECREATE");
+  TTree * wght_tree = new TTree(GSyst::AsString(gOptSyst).c_str(), "GENIE weights tree");
+  int branch_eventnum = 0;
+  TArrayF * branch_weight_array   = new TArrayF(n_points);
+  TArrayF * branch_twkdials_array = new TArrayF(n_points);  
+  wght_tree->Branch("eventnum", &branch_eventnum);
+  wght_tree->Branch("weights",  &branch_weight_array);
+  wght_tree->Branch("twkdials", &branch_twkdials_array);
+
+  vector<double> knot_dials;
+  vector<double> knot_weights;
+  GReWeightResponse response;
+
+  double   max_resperr = 0;
+  double   sum_resperr = 0;
+  Long64_t nentries    = 0;
+
+  TStopwatch timer;
+  timer.Start();
+
+  for(Long64_t ientry = nfirst; ientry <= nlast; ientry++) {
+    rsp_tree->GetEntry(ientry);
+
+    int nknots = rsp_weights->GetSize();
+    knot_dials  .resize(nknots);
+    knot_weights.resize(nknots);
+    for(int ik = 0; ik < nknots; ik++) {
+      knot_dials  [ik] = rsp_twkdials->At(ik);
+      knot_weights[ik] = rsp_weights ->At(ik);
+    }
+    response.Set(nknots, &knot_dials[0], &knot_weights[0]);
+
+    double resperr = (has_resperr) ? rsp_resperr : response.LeaveOneOutError();
+    max_resperr = TMath::Max(max_resperr, resperr);
+    sum_resperr += resperr;
+    nentries++;
+
+    branch_eventnum = rsp_eventnum;
+    for(int ith_dial = 0; ith_dial < n_points; ith_dial++){  
+       double twk_dial = twk_dial_min + ith_dial * twk_dial_step;  
+       branch_weight_array   -> AddAt (response.Evaluate(twk_dial), ith_dial);
+       branch_twkdials_array -> AddAt (twk_dial,                   ith_dial);
+    }
+    wght_tree->Fill();
+  }
+
+  timer.Stop();
+  rsp_file.Close();
+
+  wght_file->cd();
+  wght_tree->Write();
+  delete wght_tree; 
+  wght_tree = 0; 
+  wght_file->Close();
+
+  LOG("grwght1scan", pNOTICE) 
+    << "Evaluated " << nentries << " response functions at " << n_points 
+    << " tweak dial values in " << timer.RealTime() << " sec";
+  LOG("grwght1scan", pNOTICE) 
+    << "Estimated interpolation error (max / mean): " << max_resperr 
+    << " / " << ((nentries>0) ? sum_resperr/nentries : 0.);
+  LOG("grwght1scan", pNOTICE)  << "Done!";
+
+  return 0;
+}
+//_________________________________________________________________________________
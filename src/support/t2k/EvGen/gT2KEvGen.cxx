@@ -25,6 +25,7 @@
                       [-P pre_gen_prob_file_name] 
                       [-S] [output_name]
                       [-m max_path_lengths_xml_file]
+                      [--geom-voxel-map voxel_map_file]
                       [-L length_units_at_geom] 
                       [-D density_units_at_geom]
                       [-n n_of_events] 
@@ -39,6 +40,7 @@
                       [--event-record-print-level level]
                       [--mc-job-status-refresh-rate  rate]
                       [--cache-file root_file]
+                      [--max-xsec-tables xml_file]
 
          *** Options :
 
@@ -125,6 +127,16 @@
               If no file is input, then the geometry will be scanned at MC job 
               initialization to determine those max path lengths. 
               Supplying this file can speed-up the MC job initialization. 
+           --geom-voxel-map
+              A binary file (generated by gmxpl --voxel-map) with a voxelized
+              map of the materials of the input ROOT geometry. If specified,
+              the path-lengths of each flux neutrino are computed by following
+              it through the voxel map rather than through the ROOT geometry,
+              which is much faster for complex geometries. Material boundaries
+              are then only known to within a voxel size (the gmxpl job that
+              built the map reports the path-length differences). The map
+              must have been built for the same geometry and top volume. It
+              can not be used with the -t +Vol1-Vol2... syntax.
            -L 
               Input geometry length units, eg 'm', 'cm', 'mm', ...
               [default: 'mm']
@@ -315,6 +327,10 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --max-xsec-tables
+              Allows users to specify an XML file with precomputed max
+              differential cross-section tables (see gmkmaxxsec), so that the
+              kinematics generators run at full speed from the first event.
 
          *** Examples:
         
@@ -487,6 +503,7 @@ string          gOptRootGeomTopVol = "";       // input geometry top event gener
 double          gOptGeomLUnits = 0;            // input geometry length units 
 double          gOptGeomDUnits = 0;            // input geometry density units 
 string          gOptExtMaxPlXml;               // max path lengths XML file for input geometry 
+string          gOptGeomVoxelMap;              // voxel map file for input geometry
 string          gOptFluxFile;                  // ROOT file with JNUBEAM flux ntuple
 string          gOptDetectorLocation;          // detector location ('sk','nd1','nd2',...)
 double          gOptFluxNorm;                  // JNUBEAM flux ntuple normalization 
@@ -514,6 +531,7 @@ int main(int argc, char ** argv)
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::MaxXSecTables(RunOpt::Instance()->MaxXSecTableFile());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, true);
 
@@ -556,6 +574,14 @@ int main(int argc, char ** argv)
       bool exhaust = (*gOptRootGeomTopVol.c_str() == '+');
       utils::geometry::RecursiveExhaust(topvol, gOptRootGeomTopVol, exhaust);
     }
+    // use a precomputed voxel map for the path-lengths, if one was specified
+    if ( gOptGeomVoxelMap.size() > 0 ) {
+      if ( !rgeom->LoadVoxelMap(gOptGeomVoxelMap) ) {
+        LOG("gevgen_t2k", pFATAL) 
+          << "Couldn't load the geometry voxel map: " << gOptGeomVoxelMap;
+        exit(1);
+      }
+    }
 
     // casting to the GENIE geometry driver interface
     geom_driver = dynamic_cast<GeomAnalyzerI *> (rgeom);
@@ -802,6 +828,7 @@ int main(int argc, char ** argv)
 
      // Generate a single event using neutrinos coming from the specified flux
      // and hitting the specified geometry or target mix
+     RandomGen::Instance()->SetEvent(gOptRunNu, ievent);
      EventRecord * event = mcj_driver->GenerateEvent();
 
      // Check whether a null event was returned due to the flux driver reaching
@@ -1014,6 +1041,21 @@ void GetCommandLineArgs(int argc, char ** argv)
            << "Will compute the maximum path lengths at job init";
         gOptExtMaxPlXml = "";
      } // -m
+
+     // check whether a voxel map of the geometry materials is specified
+     if( parser.OptionExists("geom-voxel-map") ) {
+        LOG("gevgen_t2k", pDEBUG) << "Checking for geometry voxel map file";
+        gOptGeomVoxelMap = parser.ArgAsString("geom-voxel-map");
+        if ( gOptRootGeomTopVol.size() > 0 &&
+             (gOptRootGeomTopVol[0] == '+' || gOptRootGeomTopVol[0] == '-') ) {
+          LOG("gevgen_t2k", pFATAL) 
+            << "A geometry voxel map can't be used with the -t +Vol1-Vol2... syntax";
+          PrintSyntax();
+          exit(1);
+        }
+     } else {
+        gOptGeomVoxelMap = "";
+     } // --geom-voxel-map
   } // using root geom?
 
   else {
@@ -1376,6 +1418,8 @@ void GetCommandLineArgs(int argc, char ** argv)
            << ((gOptRootGeomTopVol.size()==0) ? "<master volume>" : gOptRootGeomTopVol)
            << ", max{PL} file: " 
            << ((gOptExtMaxPlXml.size()==0) ? "<none>" : gOptExtMaxPlXml)
+           << ", voxel map file: " 
+           << ((gOptGeomVoxelMap.size()==0) ? "<none>" : gOptGeomVoxelMap)
            << ", length  units: " << lunits
            << ", density units: " << dunits;
   } else {
@@ -1457,6 +1501,7 @@ void PrintSyntax(void)
    << "\n           [-P pre_gen_prob_file]" 
    << "\n           [-S] [output_name]"
    << "\n           [-m max_path_lengths_xml_file]"
+   << "\n           [--geom-voxel-map voxel_map_file]"
    << "\n           [-L length_units_at_geom]"
    << "\n           [-D density_units_at_geom]"
    << "\n           [-n n_of_events]"
@@ -1472,6 +1517,7 @@ void PrintSyntax(void)
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
    << "\n           [--cache-file root_file]"
+   << "\n           [--max-xsec-tables xml_file]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << " or look at the source code: $GENIE/src/support/t2k/EvGen/gT2KEvGen.cxx"
@@ -6,15 +6,19 @@
 \brief   Program used for testing / debugging the GENIE DIS SF models
 
          Syntax :
-          gtestDISSF -a model -c config [-m mode] [-x x] [-q Q2]
+          gtestDISSF -a model -c config [-m mode] [-x x] [-q Q2] [-n npoints]
 
          Options :
            -a  DIS SF model (algorithm name, eg genie::BYStructureFuncModel)
            -c  DIS SF model configuration
-           -m  mode (1: make std SF ntuple, 2: vertical slice)
+           -m  mode (1: make std SF ntuple, 2: vertical slice,
+                     3: accuracy & speed of tabulated SFs - the model must
+                        be a genie::DISStrucFuncGrid - vs direct evaluation
+                        of the model they wrap)
                [default:1]
            -x  Specify Bjorken x to be used at the vertical slice
            -q  Specify mom. transfer Q2(>0) to be used at the vertical slice
+           -n  Number of random (x,Q2) points used in mode 3 [default: 100000]
          
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
@@ -29,30 +33,40 @@
 //____________________________________________________________________________
 
 #include <string>
+#include <vector>
+#include <sstream>
 
 #include <TFile.h>
 #include <TTree.h>
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
 
 #include "Algorithm/Algorithm.h"
 #include "Algorithm/AlgFactory.h"
 #include "Base/DISStructureFunc.h"
 #include "Base/DISStructureFuncModelI.h"
 #include "Messenger/Messenger.h"
+#include "PartonModel/DISStrucFuncGrid.h"
 #include "PDG/PDGCodes.h"
 #include "Utils/CmdLnArgParser.h"
 
 using namespace genie;
 using std::string;
+using std::vector;
+using std::ostringstream;
 
 void GetCommandLineArgs(int argc, char ** argv);
 void PrintSyntax(void);
 
 void BuildStdNtuple (void);
 void VerticalSlice  (void);
+void GridAccuracy   (void);
 
 int    gMode        = 1;
 double gX           = 0;
 double gQ2          = 0;
+int    gNPoints     = 100000;
 string gDISSFAlg    = "";
 string gDISSFConfig = "";
 
@@ -64,6 +78,7 @@ int main(int argc, char ** argv)
 
   if(gMode==1) BuildStdNtuple();
   if(gMode==2) VerticalSlice ();
+  if(gMode==3) GridAccuracy  ();
 
   return 0;
 }
@@ -230,6 +245,120 @@ void VerticalSlice(void)
   LOG("test", pNOTICE) << *algf;
 }
 //__________________________________________________________________________
+void GridAccuracy(void)
+{
+// Compares the structure functions interpolated by DISStrucFuncGrid with the
+// ones computed directly by the model it wraps, at random (x,Q2) points, and
+// reports the relative differences and the evaluation rates.
+
+  AlgFactory * algf = AlgFactory::Instance();
+  const DISStrucFuncGrid * grid_model =
+      dynamic_cast<const DISStrucFuncGrid *> (
+                              algf->GetAlgorithm(gDISSFAlg, gDISSFConfig));
+  if(!grid_model) {
+    LOG("test", pFATAL) << "Mode 3 needs a genie::DISStrucFuncGrid model";
+    exit(1);
+  }
+  const DISStructureFuncModelI * model = grid_model->Model();
+  assert(model);
+
+  const int kNInt = 4;
+  Interaction * interactions[kNInt] = {
+    Interaction::DISCC(kPdgTgtFe56, kPdgProton,  kPdgNuMu    ),
+    Interaction::DISCC(kPdgTgtFe56, kPdgNeutron, kPdgAntiNuMu),
+    Interaction::DISNC(kPdgTgtFe56, kPdgProton,  kPdgNuMu    ),
+    Interaction::DISNC(kPdgTgtFe56, kPdgNeutron, kPdgAntiNuMu)
+  };
+
+  // random points, log-uniform in x = [1E-3, 0.95] and Q2 = [0.1, 100] GeV^2
+  TRandom3 rnd(1);
+  vector<double> xv (gNPoints);
+  vector<double> Q2v(gNPoints);
+  for(int i = 0; i < gNPoints; i++) {
+    xv [i] = TMath::Power(10., -3.   + rnd.Rndm() * (3. + TMath::Log10(0.95)));
+    Q2v[i] = TMath::Power(10., -1.   + rnd.Rndm() * 3.);
+  }
+
+  vector<double> Fd(6*gNPoints);
+  vector<double> Fg(6*gNPoints);
+
+  for(int iint = 0; iint < kNInt; iint++) {
+    Interaction * in = interactions[iint];
+    Kinematics * kine = in->KinePtr();
+
+    // build (or load) the grid
+    TStopwatch tbuild;
+    tbuild.Start();
+    kine->Setx(0.1);
+    kine->SetQ2(1.0);
+    grid_model->Calculate(in);
+    tbuild.Stop();
+
+    // direct evaluation
+    TStopwatch tdirect;
+    tdirect.Start();
+    for(int i = 0; i < gNPoints; i++) {
+      kine->Setx(xv[i]);
+      kine->SetQ2(Q2v[i]);
+      model->Calculate(in);
+      double * F = &Fd[6*i];
+      F[0] = model->F1(); F[1] = model->F2(); F[2] = model->F3();
+      F[3] = model->F4(); F[4] = model->F5(); F[5] = model->F6();
+    }
+    tdirect.Stop();
+
+    // interpolation
+    TStopwatch tgrid;
+    tgrid.Start();
+    for(int i = 0; i < gNPoints; i++) {
+      kine->Setx(xv[i]);
+      kine->SetQ2(Q2v[i]);
+      grid_model->Calculate(in);
+      double * F = &Fg[6*i];
+      F[0] = grid_model->F1(); F[1] = grid_model->F2(); F[2] = grid_model->F3();
+      F[3] = grid_model->F4(); F[4] = grid_model->F5(); F[5] = grid_model->F6();
+    }
+    tgrid.Stop();
+
+    // relative differences, for points where |F| is above 1E-3 of its max
+    double Fmax[6] = { 0., 0., 0., 0., 0., 0. };
+    for(int i = 0; i < gNPoints; i++) {
+      for(int k = 0; k < 6; k++) {
+        Fmax[k] = TMath::Max(Fmax[k], TMath::Abs(Fd[6*i+k]));
+      }
+    }
+    double max_err[6] = { 0., 0., 0., 0., 0., 0. };
+    double sum_err[6] = { 0., 0., 0., 0., 0., 0. };
+    int    n_err  [6] = { 0,  0,  0,  0,  0,  0  };
+    for(int i = 0; i < gNPoints; i++) {
+      for(int k = 0; k < 6; k++) {
+        double fd = Fd[6*i+k];
+        if(TMath::Abs(fd) <= 1E-3 * Fmax[k]) continue;
+        double err = TMath::Abs(Fg[6*i+k] - fd) / TMath::Abs(fd);
+        max_err[k] = TMath::Max(max_err[k], err);
+        sum_err[k] += err;
+        n_err[k]++;
+      }
+    }
+
+    ostringstream report;
+    report << "\n " << in->AsString()
+           << "\n  grid build / load time : " << tbuild.CpuTime() << " sec"
+           << "\n  direct evaluation      : " 
+           << gNPoints / TMath::Max(tdirect.CpuTime(), 1E-9) << " points/sec"
+           << "\n  grid interpolation     : " 
+           << gNPoints / TMath::Max(tgrid.CpuTime(),   1E-9) << " points/sec";
+    for(int k = 0; k < 6; k++) {
+      if(n_err[k] == 0) continue;
+      report << "\n  F" << k+1 << " : relative difference max = " << max_err[k]
+             << ", mean = " << sum_err[k]/n_err[k];
+    }
+    LOG("test", pNOTICE) << report.str();
+
+    delete in;
+  }
+}
+//__________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
 {
 // Parse the command line arguments
@@ -286,13 +415,18 @@ void GetCommandLineArgs(int argc, char ** argv)
       exit(1);
     }
   }//mode=2
+
+  // number of points for the SF grid accuracy test
+  if( parser.OptionExists('n') ) {
+    gNPoints = parser.ArgAsInt('n');
+  }
 }
 //__________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("test", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-          << "  testDISSF -a model -c config [-m mode] [-x x] [-q Q2]\n";
+          << "  testDISSF -a model -c config [-m mode] [-x x] [-q Q2] [-n npoints]\n";
 }
 //____________________________________________________________________________
 
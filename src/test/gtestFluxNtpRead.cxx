@@ -0,0 +1,193 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestFluxNtpRead
+
+\brief   Benchmark for reading GSimpleNtpFlux flux ntuples.
+         Loops over the same flux entries with the TTreeCache on the flux
+         chain of the GSimpleNtpFlux driver switched off and on, reports the
+         number of flux entries read per second in each case and checks that
+         both give the same sequence of flux neutrinos.
+         If no flux files are specified, a set of small gsimple flux files
+         with random entries is written in the current directory and used
+         instead.
+
+         Syntax :
+           gtestFluxNtpRead [-f flux_file_pattern] [-n number_of_entries]
+                            [-c cache_size_in_bytes]
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <string>
+#include <vector>
+#include <sstream>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+
+#include "FluxDrivers/GSimpleNtpFlux.h"
+#include "Messenger/Messenger.h"
+#include "PDG/PDGCodes.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::ostringstream;
+
+using namespace genie;
+using namespace genie::flux;
+
+string WriteFluxFiles (int nfiles, int nentries_per_file);
+double ReadFlux       (string pattern, int nentries, Long64_t cache_size, vector<double> & E);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  int nentries = 1000000;
+  if(parser.OptionExists('n')) {
+    nentries = parser.ArgAsInt('n');
+  }
+  Long64_t cache_size = 10000000;
+  if(parser.OptionExists('c')) {
+    cache_size = parser.ArgAsLong('c');
+  }
+  string pattern = "";
+  if(parser.OptionExists('f')) {
+    pattern = parser.ArgAsString('f');
+  } else {
+    const int nfiles = 20;
+    pattern = WriteFluxFiles(nfiles, TMath::Max(1, nentries/nfiles));
+  }
+
+  vector<double> E_direct, E_cached;
+
+  double rate_direct = ReadFlux(pattern, nentries, 0,          E_direct);
+  double rate_cached = ReadFlux(pattern, nentries, cache_size, E_cached);
+
+  bool same = (E_direct == E_cached);
+
+  LOG("test", pNOTICE)
+    << "\n Read " << nentries << " flux entries from: " << pattern
+    << "\n  no TTreeCache        : " << rate_direct << " entries/sec"
+    << "\n  TTreeCache (" << cache_size << " bytes)"
+    << " : " << rate_cached << " entries/sec"
+    << "\n  same flux neutrinos  : " << (same ? "yes" : "NO");
+
+  return (same ? 0 : 1);
+}
+//____________________________________________________________________________
+double ReadFlux(string pattern, int nentries, Long64_t cache_size, vector<double> & E)
+{
+// Generate nentries weighted flux neutrinos, starting at the first ntuple
+// entry, and return the number of entries read per second (wall clock)
+
+  GSimpleNtpFlux * flux = new GSimpleNtpFlux;
+  flux->SetTreeCacheSize(cache_size);
+  flux->LoadBeamSimData(pattern, "no-offset-index");
+  flux->GenerateWeighted(true);
+
+  E.clear();
+  E.reserve(nentries);
+
+  TStopwatch timer;
+  timer.Start();
+  for(int i = 0; i < nentries; i++) {
+    if( ! flux->GenerateNext() ) {
+      if(flux->End()) break;
+      continue;
+    }
+    E.push_back(flux->Momentum().E());
+  }
+  timer.Stop();
+
+  double rate = (timer.RealTime() > 0) ? nentries/timer.RealTime() : 0;
+
+  delete flux;
+
+  return rate;
+}
+//____________________________________________________________________________
+string WriteFluxFiles(int nfiles, int nentries_per_file)
+{
+// Write nfiles gsimple flux files, each with its own meta data entry
+
+  LOG("test", pNOTICE)
+    << "Writing " << nfiles << " flux files with "
+    << nentries_per_file << " entries each";
+
+  TRandom3 rnd(1234);
+
+  const int pdg[4] = { kPdgNuMu, kPdgAntiNuMu, kPdgNuE, kPdgAntiNuE };
+
+  for(int ifile = 0; ifile < nfiles; ifile++) {
+    ostringstream name;
+    name << "gtestFluxNtpRead_" << ifile << ".root";
+
+    TFile file(name.str().c_str(), "recreate");
+    TTree * fluxntp = new TTree("flux", "a simple flux n-tuple");
+    TTree * metantp = new TTree("meta", "metadata for flux n-tuple");
+
+    GSimpleNtpEntry * entry = new GSimpleNtpEntry;
+    GSimpleNtpNuMI  * numi  = new GSimpleNtpNuMI;
+    GSimpleNtpMeta  * meta  = new GSimpleNtpMeta;
+
+    fluxntp->Branch("entry", &entry);
+    fluxntp->Branch("numi",  &numi);
+    metantp->Branch("meta",  &meta);
+
+    meta->metakey   = 1000 + ifile;
+    meta->minWgt    = 1.;
+    meta->maxWgt    = 1.;
+    meta->maxEnergy = 0;
+    meta->protons   = 1.E+15;
+    for(int i = 0; i < 4; i++) meta->AddFlavor(pdg[i]);
+
+    for(int i = 0; i < nentries_per_file; i++) {
+      entry->Reset();
+      numi ->Reset();
+      double E = 0.1 + 20. * rnd.Rndm();
+      double costh = 1. - 1.E-4 * rnd.Rndm();
+      double sinth = TMath::Sqrt(1. - costh*costh);
+      double phi   = 2 * TMath::Pi() * rnd.Rndm();
+      entry->pdg     = pdg[rnd.Integer(4)];
+      entry->wgt     = 1.;
+      entry->E       = E;
+      entry->px      = E * sinth * TMath::Cos(phi);
+      entry->py      = E * sinth * TMath::Sin(phi);
+      entry->pz      = E * costh;
+      entry->vtxx    = rnd.Uniform(-2.,2.);
+      entry->vtxy    = rnd.Uniform(-2.,2.);
+      entry->vtxz    = 0.;
+      entry->dist    = rnd.Uniform(100.,700.);
+      entry->metakey = meta->metakey;
+      numi->evtno    = i;
+      numi->entryno  = i;
+      meta->maxEnergy = TMath::Max(meta->maxEnergy, E);
+      fluxntp->Fill();
+    }
+    metantp->Fill();
+
+    fluxntp->Write();
+    metantp->Write();
+    file.Close();
+
+    delete entry;
+    delete numi;
+    delete meta;
+  }
+  return "gtestFluxNtpRead_*.root";
+}
+//____________________________________________________________________________
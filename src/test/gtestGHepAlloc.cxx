@@ -0,0 +1,269 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestGHepAlloc
+
+\brief   Counts the heap allocations made while filling, copying, resetting
+         and taking snapshots of GHEP event records, once the records have
+         been used for a few events (steady-state).
+         The global operator new / delete are replaced by counting versions.
+         Filling, resetting and copying a GHEP record (as done by the event
+         generation modules, the GHEP history and the ntuple writer) must
+         not allocate in the steady-state.
+         It also counts the allocations made while generating INTRANUKE
+         hadron+nucleus events (as in gevgen_hadron, but re-using the same
+         event record) and checks that their mean number per event stays
+         below an upper bound. Generation still allocates (the interaction
+         summary, temporary particles in INTRANUKE, message streams), so the
+         bound guards against new per-event allocations creeping in, such as
+         the per-particle allocations of non-recycled GHEP storage.
+         The test exits with a non-zero status at any failure.
+
+         Syntax :
+           gtestGHepAlloc [-n number_of_events] [-a max_allocations]
+
+         Options :
+           -n  number of events for each count (default: 1000)
+           -a  max mean number of allocations per generated INTRANUKE event
+               (default: 1000)
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+
+#include "Algorithm/AlgFactory.h"
+#include "EVGCore/EventRecord.h"
+#include "EVGCore/EventRecordVisitorI.h"
+#include "GHEP/GHepParticle.h"
+#include "GHEP/GHepRecordHistory.h"
+#include "GHEP/GHepStatus.h"
+#include "Interaction/Interaction.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/RandomGen.h"
+#include "PDG/PDGCodes.h"
+#include "PDG/PDGLibrary.h"
+#include "Utils/CmdLnArgParser.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+// counting global operator new / delete
+//
+static bool          gCountAllocs = false;
+static unsigned long gNAllocs     = 0;
+
+void * operator new (size_t size) throw (std::bad_alloc)
+{
+  if(gCountAllocs) gNAllocs++;
+  void * ptr = malloc(size>0 ? size : 1);
+  if(!ptr) throw std::bad_alloc();
+  return ptr;
+}
+void * operator new[] (size_t size) throw (std::bad_alloc)
+{
+  if(gCountAllocs) gNAllocs++;
+  void * ptr = malloc(size>0 ? size : 1);
+  if(!ptr) throw std::bad_alloc();
+  return ptr;
+}
+void operator delete   (void * ptr) throw() { free(ptr); }
+void operator delete[] (void * ptr) throw() { free(ptr); }
+
+//____________________________________________________________________________
+void          FillEvent    (EventRecord & event, int iev);
+bool          SameEvents   (const EventRecord & ev1, const EventRecord & ev2);
+unsigned long CountAllocs  (int nev, int mode,
+                  EventRecord & event, EventRecord & copy, GHepRecordHistory & history);
+void          GenerateEvent   (const EventRecordVisitorI * intranuke, EventRecord & event);
+unsigned long CountGenAllocs  (int nev,
+                  const EventRecordVisitorI * intranuke, EventRecord & event);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  int nev = 1000;
+  if(parser.OptionExists('n')) {
+    nev = parser.ArgAsInt('n');
+  }
+  double max_gen_allocs = 1000.;
+  if(parser.OptionExists('a')) {
+    max_gen_allocs = parser.ArgAsDouble('a');
+  }
+
+  // keep the GHEP & INTRANUKE messages out of the allocation counts
+  Messenger::Instance()->SetPriorityLevel("GHEP",        pWARN);
+  Messenger::Instance()->SetPriorityLevel("Intranuke",   pWARN);
+  Messenger::Instance()->SetPriorityLevel("HNIntranuke", pWARN);
+  Messenger::Instance()->SetPriorityLevel("INukeUtils",  pWARN);
+  PDGLibrary::Instance();
+
+  EventRecord       event;
+  EventRecord       copy;
+  GHepRecordHistory history;
+
+  // warm-up: let the records reach their steady-state size
+  CountAllocs(10, 2, event, copy, history);
+
+  unsigned long nfill = CountAllocs(nev, 0, event, copy, history);
+  unsigned long ncopy = CountAllocs(nev, 1, event, copy, history);
+  unsigned long nhist = CountAllocs(nev, 2, event, copy, history);
+
+  bool same = SameEvents(event, copy);
+
+  // INTRANUKE hadron+nucleus generation, re-using the same event record
+  const EventRecordVisitorI * intranuke =
+    dynamic_cast<const EventRecordVisitorI *> (
+       AlgFactory::Instance()->GetAlgorithm("genie::HNIntranuke","Default"));
+  assert(intranuke);
+
+  EventRecord gen_event;
+  RandomGen::Instance()->SetSeed(1234);
+  CountGenAllocs(20, intranuke, gen_event);  // warm-up
+
+  unsigned long ngen = CountGenAllocs(nev, intranuke, gen_event);
+  double ngen_per_event = (double)ngen/nev;
+
+  LOG("test", pNOTICE)
+    << "\n Heap allocations in " << nev << " events (steady-state):"
+    << "\n  fill / reset record         : " << nfill
+    << "\n  copy record                 : " << ncopy
+    << "\n  fill + history snapshot     : " << nhist
+    << "  (" << (double)nhist/nev << " per event)"
+    << "\n  copied record identical     : " << (same ? "yes" : "NO")
+    << "\n  INTRANUKE generation        : " << ngen
+    << "  (" << ngen_per_event << " per event, max: " << max_gen_allocs << ")";
+
+  bool gen_ok = (ngen_per_event <= max_gen_allocs);
+  if(!gen_ok) {
+    LOG("test", pERROR)
+      << "Too many heap allocations per generated INTRANUKE event: "
+      << ngen_per_event << " > " << max_gen_allocs;
+  }
+
+#ifdef __GENIE_GHEP_RECYCLE_PARTICLES__
+  bool ok = same && gen_ok && (nfill == 0) && (ncopy == 0);
+#else
+  LOG("test", pWARN)
+    << "GHepParticle recycling not supported by this ROOT version";
+  bool ok = same && gen_ok;
+#endif
+
+  return (ok ? 0 : 1);
+}
+//____________________________________________________________________________
+unsigned long CountAllocs(int nev, int mode,
+    EventRecord & event, EventRecord & copy, GHepRecordHistory & history)
+{
+// mode 0: fill the event record
+// mode 1: fill the event record and copy it over another one
+// mode 2: fill the event record and take a history snapshot
+
+  gNAllocs     = 0;
+  gCountAllocs = true;
+  for(int iev = 0; iev < nev; iev++) {
+    FillEvent(event, iev);
+    if(mode == 1) {
+      copy.Copy(event);
+    }
+    if(mode == 2) {
+      history.PurgeHistory();
+      history.AddSnapshot(-1, &event);
+    }
+  }
+  gCountAllocs = false;
+
+  return gNAllocs;
+}
+//____________________________________________________________________________
+unsigned long CountGenAllocs(
+    int nev, const EventRecordVisitorI * intranuke, EventRecord & event)
+{
+  gNAllocs     = 0;
+  gCountAllocs = true;
+  for(int iev = 0; iev < nev; iev++) {
+    GenerateEvent(intranuke, event);
+  }
+  gCountAllocs = false;
+
+  return gNAllocs;
+}
+//____________________________________________________________________________
+void GenerateEvent(const EventRecordVisitorI * intranuke, EventRecord & event)
+{
+// Generate a 500 MeV pi+ + Fe56 event, as in gevgen_hadron
+
+  event.ResetRecord();
+  event.AttachSummary(new Interaction);
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  double mh  = pdglib->Find(kPdgPiP)->Mass();
+  double M   = pdglib->Find(1000260560)->Mass();
+  double Eh  = mh + 0.5;
+  double pzh = TMath::Sqrt(TMath::Max(0.,Eh*Eh-mh*mh));
+
+  event.AddParticle(kPdgPiP,    kIStInitialState, -1,-1,-1,-1, 0,0,pzh,Eh, 0,0,0,0);
+  event.AddParticle(1000260560, kIStInitialState, -1,-1,-1,-1, 0,0,0,M,    0,0,0,0);
+
+  intranuke->ProcessEventRecord(&event);
+}
+//____________________________________________________________________________
+void FillEvent(EventRecord & event, int iev)
+{
+// Fill a numu CC-like event with a varying number of hadrons. Daughters of
+// the hadronic system are added after the primary lepton daughters, so that
+// the daughter-list compactifier gets exercised too.
+
+  event.ResetRecord();
+
+  double E = 1. + 0.01 * (iev % 100);
+  TLorentzVector x4(0,0,0,0);
+
+  event.AddParticle(kPdgNuMu,    kIStInitialState,  -1,-1,-1,-1,  0,0,E,E,  0,0,0,0);
+  event.AddParticle(kPdgTgtO16,  kIStInitialState,  -1,-1,-1,-1,  0,0,0,14.9, 0,0,0,0);
+  event.AddParticle(kPdgNeutron, kIStNucleonTarget,  1,-1,-1,-1,  0,0,0,0.94, 0,0,0,0);
+  event.AddParticle(kPdgMuon,    kIStStableFinalState, 0,-1,-1,-1,
+                    0.1,0.,0.6*E,0.6*E+0.01, 0,0,0,0);
+  event.AddParticle(kPdgProton,  kIStHadronInTheNucleus, 2,-1,-1,-1,
+                    -0.1,0.,0.4*E,1.2, 0,0,0,0);
+
+  int nhad = 2 + (iev % 5);
+  for(int i = 0; i < nhad; i++) {
+    TLorentzVector p4(0.01*i, -0.01*i, 0.1, 0.2);
+    int pdg = (i%2 == 0) ? kPdgPiP : kPdgPi0;
+    event.AddParticle(pdg, kIStStableFinalState, 4,-1,-1,-1, p4, x4);
+  }
+  // a late daughter of the neutrino breaks the compactness of daughter lists
+  event.AddParticle(kPdgGamma, kIStStableFinalState, 0,-1,-1,-1,
+                    0.,0.,0.01,0.01, 0,0,0,0);
+
+  event.SetVertex(1., 2., 3., 0.);
+  event.SetWeight(1.);
+  event.SetXSec(1.E-38);
+}
+//____________________________________________________________________________
+bool SameEvents(const EventRecord & ev1, const EventRecord & ev2)
+{
+  if(ev1.GetEntries() != ev2.GetEntries()) return false;
+
+  for(int i = 0; i < ev1.GetEntries(); i++) {
+    if(! (*ev1.Particle(i) == *ev2.Particle(i)) ) return false;
+    if(ev1.Particle(i)->Vx() != ev2.Particle(i)->Vx()) return false;
+  }
+  return (ev1.Weight() == ev2.Weight() && ev1.XSec() == ev2.XSec());
+}
+//____________________________________________________________________________
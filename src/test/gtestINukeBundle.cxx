@@ -0,0 +1,174 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestINukeBundle
+
+\brief   Regression test for the INTRANUKE data bundle and lookup tables.
+         The hA-mode fate fractions and the h+p, h+n total x-sections used for
+         computing the hadron mean free paths are evaluated on a kinetic energy
+         grid (not aligned with the lookup table knots) and either written out
+         as reference values, or compared with reference values written out
+         earlier.
+         In the comparison mode the values are checked twice: Evaluated from
+         the x-section splines (which are expected to be identical to the
+         reference ones when loaded from a data bundle) and served from the
+         lookup tables. The test exits with a non-zero status if any value
+         differs from the reference one by more than the tolerance.
+
+         Typical usage :
+           unset GINUKEHADRONBUNDLE
+           gtestINukeBundle -r ref.txt
+           export GINUKEHADRONBUNDLE=/some/path/intranuke.bundle
+           gtestINukeBundle -c ref.txt   (creates the bundle)
+           gtestINukeBundle -c ref.txt   (loads the bundle)
+
+         Syntax :
+           gtestINukeBundle [-r ref_file | -c ref_file] [-t tolerance]
+
+         Options :
+           -r  write the reference values in the input file
+           -c  compare with the reference values in the input file
+           -t  relative tolerance for the lookup table values (default: 1E-3)
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+
+#include "HadronTransport/INukeHadroData.h"
+#include "HadronTransport/INukeHadroFates.h"
+#include "Messenger/Messenger.h"
+#include "PDG/PDGCodes.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+using std::ifstream;
+using std::ofstream;
+using std::setprecision;
+using std::endl;
+
+using namespace genie;
+
+void Evaluate (vector<double> & values);
+int  Compare  (const vector<double> & values, const vector<double> & ref,
+               double tolerance, string what);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  bool write = parser.OptionExists('r');
+  bool check = parser.OptionExists('c');
+  if(write == check) {
+    LOG("test", pFATAL)
+      << "Syntax: gtestINukeBundle [-r ref_file | -c ref_file] [-t tolerance]";
+    exit(1);
+  }
+  string filename  = (write) ? parser.ArgAsString('r') : parser.ArgAsString('c');
+  double tolerance = (parser.OptionExists('t')) ? parser.ArgAsDouble('t') : 1E-3;
+
+  INukeHadroData * hd = INukeHadroData::Instance();
+  hd->UseLookupTables(false);
+
+  vector<double> values;
+  Evaluate(values);
+
+  if(write) {
+    ofstream out(filename.c_str());
+    out << setprecision(17);
+    for(unsigned int i = 0; i < values.size(); i++) out << values[i] << endl;
+    out.close();
+    LOG("test", pNOTICE)
+      << "Wrote " << values.size() << " reference values in " << filename;
+    return (out.fail() ? 1 : 0);
+  }
+
+  vector<double> ref;
+  ifstream in(filename.c_str());
+  double v = 0;
+  while(in >> v) ref.push_back(v);
+  if(ref.size() != values.size()) {
+    LOG("test", pFATAL)
+      << "Found " << ref.size() << " reference values in " << filename
+      << " - Expected " << values.size();
+    return 1;
+  }
+
+  int nfail = Compare(values, ref, 1E-9, "splines");
+
+  hd->UseLookupTables(true);
+  Evaluate(values);
+  nfail += Compare(values, ref, tolerance, "lookup tables");
+
+  return (nfail == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+void Evaluate(vector<double> & values)
+{
+  const int hadrons[7] = {
+    kPdgProton, kPdgNeutron, kPdgPiP, kPdgPiM, kPdgPi0, kPdgKP, kPdgGamma };
+  const INukeFateHA_t fates[5] = {
+    kIHAFtCEx, kIHAFtElas, kIHAFtInelas, kIHAFtAbs, kIHAFtPiProd };
+
+  INukeHadroData * hd = INukeHadroData::Instance();
+
+  values.clear();
+  for(double ke = 1.; ke < 1800.; ke += 7.3) {
+    for(int ih = 0; ih < 7; ih++) {
+      if(hadrons[ih] != kPdgGamma && ke <= INukeHadroData::fMaxKinEnergyHA) {
+        for(int ifate = 0; ifate < 5; ifate++) {
+          if(hadrons[ih] == kPdgKP &&
+             fates[ifate] != kIHAFtInelas && fates[ifate] != kIHAFtAbs) continue;
+          values.push_back(hd->Frac(hadrons[ih], fates[ifate], ke));
+        }
+      }
+      double xsec_p = 0, xsec_n = 0;
+      hd->TotXSecs(hadrons[ih], ke, xsec_p, xsec_n);
+      values.push_back(xsec_p);
+      values.push_back(xsec_n);
+    }
+  }
+}
+//____________________________________________________________________________
+int Compare(const vector<double> & values, const vector<double> & ref,
+            double tolerance, string what)
+{
+  int    nfail   = 0;
+  double maxdiff = 0;
+
+  for(unsigned int i = 0; i < values.size(); i++) {
+    double scale = TMath::Max(TMath::Abs(ref[i]), 1E-3);
+    double diff  = TMath::Abs(values[i] - ref[i]) / scale;
+    maxdiff = TMath::Max(maxdiff, diff);
+    if(diff > tolerance) {
+      nfail++;
+      if(nfail <= 10) {
+        LOG("test", pERROR)
+          << what << ": value " << i << " = " << values[i]
+          << ", reference = " << ref[i];
+      }
+    }
+  }
+
+  LOG("test", pNOTICE)
+    << what << ": " << values.size() << " values, max relative difference = "
+    << maxdiff << ", " << nfail << " above tolerance (" << tolerance << ")";
+
+  return nfail;
+}
+//____________________________________________________________________________
@@ -0,0 +1,199 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestINukeStepping
+
+\brief   Seeded regression test for the batched hadron stepping in INTRANUKE
+         (see Intranuke::StepToInteraction()).
+         Generates hadron+nucleus events for a few probe / target / energy
+         combinations, twice per event and with the same random number seed:
+         With the step-by-step loop (BatchStepping = false) and with the
+         batched stepping (BatchStepping = true). The two event records must
+         be identical (same particles, status & rescattering codes, mother /
+         daughter links, 4-momenta and 4-positions).
+         The test exits with a non-zero status at any difference.
+
+         Syntax :
+           gtestINukeStepping [-n nevents] [-m mode] [--seed seed]
+
+         Options :
+           -n  number of events per probe / target combination (default: 200)
+           -m  INTRANUKE mode: hN or hA (default: hN)
+           --seed  random number seed (default: 1234)
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TStopwatch.h>
+
+#include "Algorithm/AlgFactory.h"
+#include "EVGCore/EventRecord.h"
+#include "EVGCore/EventRecordVisitorI.h"
+#include "GHEP/GHepParticle.h"
+#include "Interaction/Interaction.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/RandomGen.h"
+#include "PDG/PDGCodes.h"
+#include "PDG/PDGLibrary.h"
+#include "Registry/Registry.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+
+using namespace genie;
+
+EventRecordVisitorI * GetIntranuke (string name, bool batch_stepping);
+EventRecord *         Generate     (const EventRecordVisitorI * intranuke,
+                                    int probe, int tgt, double ke, long seed);
+bool                  Compare      (const EventRecord & ev1, const EventRecord & ev2);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  int    nev  = (parser.OptionExists('n'))    ? parser.ArgAsInt('n')        : 200;
+  string mode = (parser.OptionExists('m'))    ? parser.ArgAsString('m')     : "hN";
+  long   seed = (parser.OptionExists("seed")) ? parser.ArgAsLong("seed")    : 1234;
+
+  string name = "";
+  if      (mode == "hN") name = "genie::HNIntranuke";
+  else if (mode == "hA") name = "genie::HAIntranuke";
+  else {
+    LOG("test", pFATAL) << "Invalid INTRANUKE mode: " << mode;
+    exit(1);
+  }
+
+  EventRecordVisitorI * inuke_step  = GetIntranuke(name, false);
+  EventRecordVisitorI * inuke_batch = GetIntranuke(name, true);
+
+  const int    kNCases = 5;
+  const int    kProbe [kNCases] = {
+    kPdgPiP, kPdgProton, kPdgPiM, kPdgNeutron, kPdgKP };
+  const int    kTarget[kNCases] = {
+    1000260560, 1000822080, 1000060120, 1000180400, 1000080160 };
+  const double kKinE  [kNCases] = { 0.5, 1.0, 0.3, 0.8, 0.6 }; // GeV
+
+  int nfail = 0;
+
+  for(int icase = 0; icase < kNCases; icase++) {
+    TStopwatch tstep, tbatch;
+    tstep.Reset();
+    tbatch.Reset();
+    int ndiff = 0;
+    for(int iev = 0; iev < nev; iev++) {
+      long evseed = seed + icase*nev + iev;
+
+      tstep.Start(kFALSE);
+      EventRecord * ev_step = Generate(
+         inuke_step, kProbe[icase], kTarget[icase], kKinE[icase], evseed);
+      tstep.Stop();
+
+      tbatch.Start(kFALSE);
+      EventRecord * ev_batch = Generate(
+         inuke_batch, kProbe[icase], kTarget[icase], kKinE[icase], evseed);
+      tbatch.Stop();
+
+      if(!Compare(*ev_step, *ev_batch)) {
+        ndiff++;
+        if(ndiff <= 3) {
+          LOG("test", pERROR) << "Stepping event record: "  << *ev_step;
+          LOG("test", pERROR) << "Batched stepping event record: " << *ev_batch;
+        }
+      }
+      delete ev_step;
+      delete ev_batch;
+    }
+    LOG("test", pNOTICE)
+      << mode << " " << kProbe[icase] << " + " << kTarget[icase]
+      << " @ KE = " << kKinE[icase] << " GeV: "
+      << ndiff << " / " << nev << " events differ"
+      << " -- stepping: " << tstep.CpuTime() << " s"
+      << ", batched stepping: " << tbatch.CpuTime() << " s";
+    nfail += ndiff;
+  }
+
+  delete inuke_step;
+  delete inuke_batch;
+
+  return (nfail == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+EventRecordVisitorI * GetIntranuke(string name, bool batch_stepping)
+{
+  AlgFactory * algf = AlgFactory::Instance();
+  EventRecordVisitorI * intranuke =
+    dynamic_cast<EventRecordVisitorI *> (algf->AdoptAlgorithm(name,"Default"));
+  assert(intranuke);
+
+  Registry r(intranuke->GetConfig());
+  r.UnLock();
+  r.Set("BatchStepping", batch_stepping);
+  intranuke->Configure(r);
+
+  return intranuke;
+}
+//____________________________________________________________________________
+EventRecord * Generate(
+   const EventRecordVisitorI * intranuke,
+   int probe, int tgt, double ke, long seed)
+{
+// Generate a hadron+nucleus event, as in gevgen_hadron
+
+  RandomGen::Instance()->SetSeed(seed);
+
+  EventRecord * evrec = new EventRecord();
+  Interaction * interaction = new Interaction;
+  evrec->AttachSummary(interaction);
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  double mh  = pdglib->Find(probe)->Mass();
+  double M   = pdglib->Find(tgt  )->Mass();
+  double Eh  = mh + ke;
+  double pzh = TMath::Sqrt(TMath::Max(0.,Eh*Eh-mh*mh));
+
+  TLorentzVector x4null(0.,0.,0.,0.);
+  TLorentzVector p4h   (0.,0.,pzh,Eh);
+  TLorentzVector p4tgt (0.,0.,0., M);
+
+  evrec->AddParticle(probe, kIStInitialState, -1,-1,-1,-1, p4h,   x4null);
+  evrec->AddParticle(tgt,   kIStInitialState, -1,-1,-1,-1, p4tgt, x4null);
+
+  intranuke->ProcessEventRecord(evrec);
+
+  return evrec;
+}
+//____________________________________________________________________________
+bool Compare(const EventRecord & ev1, const EventRecord & ev2)
+{
+  if(ev1.GetEntries() != ev2.GetEntries()) return false;
+
+  for(int i = 0; i < ev1.GetEntries(); i++) {
+    GHepParticle * p1 = ev1.Particle(i);
+    GHepParticle * p2 = ev2.Particle(i);
+    if(p1->Pdg()           != p2->Pdg()          ) return false;
+    if(p1->Status()        != p2->Status()       ) return false;
+    if(p1->RescatterCode() != p2->RescatterCode()) return false;
+    if(p1->FirstMother()   != p2->FirstMother()  ) return false;
+    if(p1->LastMother()    != p2->LastMother()   ) return false;
+    if(p1->FirstDaughter() != p2->FirstDaughter()) return false;
+    if(p1->LastDaughter()  != p2->LastDaughter() ) return false;
+    if(*p1->P4() != *p2->P4()) return false;
+    if(*p1->X4() != *p2->X4()) return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,177 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestINukeSurvival
+
+\brief   Regression test for the tabulated hadron survival probabilities
+         (INukeSurvivalTable) used by the INTRANUKE reweighting.
+         Hadrons (p, n, pi+, pi-, pi0, K+) are generated at random positions
+         in the tracking volume of a few nuclei, with random directions and
+         kinetic energies. Their survival probabilities, for the nominal and
+         for a few tweaked mean free paths, are computed by stepping (see
+         utils::intranuke::ProbSurvival()) and from the tables, and compared.
+         The test exits with a non-zero status if any tabulated probability
+         differs from the stepping one by more than the tolerance.
+
+         Syntax :
+           gtestINukeSurvival [-n nhadrons] [-t tolerance] [--seed seed]
+
+         Options :
+           -n  number of hadrons per nucleus (default: 2000)
+           -t  max absolute difference in survival probability (default: 5E-3)
+           --seed  random number seed
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <vector>
+
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TStopwatch.h>
+#include <TVector3.h>
+
+#include "Conventions/Constants.h"
+#include "Conventions/Units.h"
+#include "HadronTransport/INukeSurvivalTable.h"
+#include "HadronTransport/INukeUtils.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/RandomGen.h"
+#include "PDG/PDGCodes.h"
+#include "PDG/PDGLibrary.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::vector;
+
+using namespace genie;
+using namespace genie::constants;
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  int    nhadrons  = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : 2000;
+  double tolerance = (parser.OptionExists('t')) ? parser.ArgAsDouble('t') : 5E-3;
+  if(parser.OptionExists("seed")) {
+    RandomGen::Instance()->SetSeed(parser.ArgAsLong("seed"));
+  }
+
+  const int    kNNuclei = 5;
+  const double kA[kNNuclei] = { 12, 16, 40,  56, 208 };
+  const double kZ[kNNuclei] = {  6,  8, 18,  26,  82 };
+
+  const int    kNHadrons = 6;
+  const int    kHadrons[kNHadrons] = {
+    kPdgProton, kPdgNeutron, kPdgPiP, kPdgPiM, kPdgPi0, kPdgKP };
+
+  const int    kNScales = 3;
+  const double kScales[kNScales] = { 1.0, 0.8, 1.2 };
+
+  const double NR = 3, R0 = 1.4;
+
+  TRandom & rnd = RandomGen::Instance()->RndGen();
+  INukeSurvivalTable * table = INukeSurvivalTable::Instance();
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  int nfail = 0;
+
+  for(int inuc = 0; inuc < kNNuclei; inuc++) {
+    double A = kA[inuc];
+    double Z = kZ[inuc];
+    double R = NR * R0 * TMath::Power(A, 1./3.);
+
+    // build the table before timing the lookups
+    table->ProbSurvival(kPdgProton,
+      TLorentzVector(0,0,0,0), TLorentzVector(0,0,0.5,1.1), A, Z);
+
+    vector<TLorentzVector> x4(nhadrons), p4(nhadrons);
+    vector<int> pdgc(nhadrons);
+    for(int i = 0; i < nhadrons; i++) {
+      pdgc[i] = kHadrons[i % kNHadrons];
+      double m  = pdglib->Find(pdgc[i])->Mass();
+      double ke = (0.01 + 1.5*rnd.Rndm()) * units::GeV;
+      double p  = TMath::Sqrt(ke*(ke + 2*m));
+      TVector3 x3, p3;
+      x3.SetMagThetaPhi(1.02 * R * TMath::Power(rnd.Rndm(), 1./3.),
+                        TMath::ACos(2*rnd.Rndm()-1), 2*kPi*rnd.Rndm());
+      p3.SetMagThetaPhi(p, TMath::ACos(2*rnd.Rndm()-1), 2*kPi*rnd.Rndm());
+      x4[i].SetVect(x3);
+      p4[i].SetVectM(p3, m);
+    }
+
+    vector<double> pstep(kNScales*nhadrons), ptable(kNScales*nhadrons);
+
+    TStopwatch tstep;
+    tstep.Start();
+    for(int i = 0; i < nhadrons; i++) {
+      for(int is = 0; is < kNScales; is++) {
+        pstep[i*kNScales+is] = utils::intranuke::ProbSurvival(
+           pdgc[i], x4[i], p4[i], A, Z, kScales[is]);
+      }
+    }
+    tstep.Stop();
+
+    TStopwatch ttable;
+    ttable.Start();
+    for(int i = 0; i < nhadrons; i++) {
+      double depth = table->OpticalDepth(pdgc[i], x4[i], p4[i], A, Z);
+      for(int is = 0; is < kNScales; is++) {
+        ptable[i*kNScales+is] = TMath::Exp(-depth/kScales[is]);
+      }
+    }
+    ttable.Stop();
+
+    // also check the probabilities served directly
+    for(int i = 0; i < nhadrons; i++) {
+      double pdirect = table->ProbSurvival(pdgc[i], x4[i], p4[i], A, Z, kScales[1]);
+      if(TMath::Abs(pdirect - ptable[i*kNScales+1]) > 1E-12) {
+        LOG("test", pERROR)
+          << "A = " << A << ": ProbSurvival() = " << pdirect
+          << " differs from exp(-depth/scale) = " << ptable[i*kNScales+1];
+        nfail++;
+      }
+    }
+
+    double maxdiff = 0;
+    for(int i = 0; i < nhadrons; i++) {
+      for(int is = 0; is < kNScales; is++) {
+        int k = i*kNScales+is;
+        double diff = TMath::Abs(ptable[k] - pstep[k]);
+        maxdiff = TMath::Max(maxdiff, diff);
+        if(diff > tolerance) {
+          nfail++;
+          if(nfail <= 10) {
+            LOG("test", pERROR)
+              << "A = " << A << ", pdgc = " << pdgc[i]
+              << ", |x| = " << x4[i].Vect().Mag() << " fm"
+              << ", p = " << p4[i].P() << " GeV"
+              << ", mfp scale = " << kScales[is]
+              << ": Psurv(stepping) = " << pstep[k]
+              << ", Psurv(table) = " << ptable[k];
+          }
+        }
+      }
+    }
+
+    LOG("test", pNOTICE)
+      << "A = " << A << ": " << nhadrons << " hadrons x " << kNScales
+      << " mfp scales, max |dPsurv| = " << maxdiff
+      << " -- stepping: " << tstep.CpuTime() << " s"
+      << ", table: " << ttable.CpuTime() << " s";
+  }
+
+  LOG("test", pNOTICE)
+    << nfail << " survival probabilities above tolerance (" << tolerance << ")";
+
+  return (nfail == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
@@ -0,0 +1,207 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestNtpFlat
+
+\brief   Compares the GHEP (kNFGHEP) and flat columnar (kNFFlat) event tree
+         formats on file size, write rate and read rate.
+         The events of an input GHEP file are loaded in memory and written
+         out in both formats. Then both files are read back: the GHEP file
+         event by event (as any GHEP reader has to do) and the flat file
+         both in full and for a selection of columns only.
+
+         Syntax :
+           gtestNtpFlat -i ghep_file [-n number_of_events] [-c columns]
+
+         Options :
+           -i  input GHEP event file
+           -n  number of events to use (default: all)
+           -c  comma-separated list of columns read in the column-selection
+               test of the flat format (default: "pdg,ist,p4")
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TFile.h>
+#include <TTree.h>
+#include <TMath.h>
+#include <TStopwatch.h>
+
+#include "EVGCore/EventRecord.h"
+#include "GHEP/GHepParticle.h"
+#include "Messenger/Messenger.h"
+#include "Ntuple/NtpMCFormat.h"
+#include "Ntuple/NtpMCEventRecord.h"
+#include "Ntuple/NtpMCFlatEvent.h"
+#include "Ntuple/NtpWriter.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+double   WriteEvents (NtpMCFormat_t fmt, string filename, const vector<EventRecord *> & events);
+double   ReadGHEP    (string filename, double & checksum);
+double   ReadFlat    (string filename, string columns, double & checksum);
+Long64_t FileSize    (string filename);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  if(!parser.OptionExists('i')) {
+    LOG("test", pFATAL)
+      << "Syntax: gtestNtpFlat -i ghep_file [-n nev] [-c columns]";
+    exit(1);
+  }
+  string   inpfile = parser.ArgAsString('i');
+  Long64_t nev     = (parser.OptionExists('n')) ? parser.ArgAsLong('n') : -1;
+  string   columns = (parser.OptionExists('c')) ?
+                     parser.ArgAsString('c') : "pdg,ist,p4";
+
+  // load the input events in memory
+  TFile fin(inpfile.c_str(), "READ");
+  TTree * tree = dynamic_cast<TTree *> (fin.Get("gtree"));
+  if(!tree) {
+    LOG("test", pFATAL) << "No GHEP event tree in " << inpfile;
+    exit(1);
+  }
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+  Long64_t nmax = (nev < 0) ?
+      tree->GetEntries() : TMath::Min(tree->GetEntries(), nev);
+
+  vector<EventRecord *> events;
+  for(Long64_t iev = 0; iev < nmax; iev++) {
+    tree->GetEntry(iev);
+    events.push_back(new EventRecord(*(mcrec->event)));
+    mcrec->Clear();
+  }
+  fin.Close();
+
+  LOG("test", pNOTICE) << "Loaded " << events.size() << " events";
+
+  const string ghepfile = "gtestNtpFlat.ghep.root";
+  const string flatfile = "gtestNtpFlat.gflat.root";
+
+  double twr_ghep = WriteEvents(kNFGHEP, ghepfile, events);
+  double twr_flat = WriteEvents(kNFFlat, flatfile, events);
+
+  double sum_ghep = 0, sum_flat = 0, sum_cols = 0;
+  double trd_ghep = ReadGHEP (ghepfile,            sum_ghep);
+  double trd_flat = ReadFlat (flatfile, "*",       sum_flat);
+  double trd_cols = ReadFlat (flatfile, columns,   sum_cols);
+
+  double n = events.size();
+
+  LOG("test", pNOTICE)
+    << "\n " << events.size() << " events:"
+    << "\n  GHEP : " << FileSize(ghepfile)/1024 << " kB"
+    << ", write " << ((twr_ghep>0) ? n/twr_ghep : 0) << " ev/sec"
+    << ", read "  << ((trd_ghep>0) ? n/trd_ghep : 0) << " ev/sec"
+    << "\n  flat : " << FileSize(flatfile)/1024 << " kB"
+    << ", write " << ((twr_flat>0) ? n/twr_flat : 0) << " ev/sec"
+    << ", read "  << ((trd_flat>0) ? n/trd_flat : 0) << " ev/sec"
+    << ", read [" << columns << "] "
+                  << ((trd_cols>0) ? n/trd_cols : 0) << " ev/sec"
+    << "\n  sum of particle energies, GHEP / flat : "
+    << sum_ghep << " / " << sum_flat
+    << ((sum_ghep == sum_flat) ? " (same)" : " (DIFFERENT)");
+
+  for(unsigned int i = 0; i < events.size(); i++) delete events[i];
+
+  return (sum_ghep == sum_flat) ? 0 : 1;
+}
+//____________________________________________________________________________
+double WriteEvents(
+    NtpMCFormat_t fmt, string filename, const vector<EventRecord *> & events)
+{
+// Write the events in the requested format and return the time it took
+
+  TStopwatch timer;
+  timer.Start();
+
+  NtpWriter ntpw(fmt, 0);
+  ntpw.CustomizeFilename(filename);
+  ntpw.Initialize();
+  for(unsigned int iev = 0; iev < events.size(); iev++) {
+    ntpw.AddEventRecord(iev, events[iev]);
+  }
+  ntpw.Save();
+
+  timer.Stop();
+  return timer.RealTime();
+}
+//____________________________________________________________________________
+double ReadGHEP(string filename, double & checksum)
+{
+  TStopwatch timer;
+  timer.Start();
+
+  TFile f(filename.c_str(), "READ");
+  TTree * tree = dynamic_cast<TTree *> (f.Get("gtree"));
+  NtpMCEventRecord * mcrec = 0;
+  tree->SetBranchAddress("gmcrec", &mcrec);
+
+  checksum = 0;
+  Long64_t nev = tree->GetEntries();
+  for(Long64_t iev = 0; iev < nev; iev++) {
+    tree->GetEntry(iev);
+    EventRecord & event = *(mcrec->event);
+    for(int i = 0; i < event.GetEntries(); i++) {
+      checksum += event.Particle(i)->E();
+    }
+    mcrec->Clear();
+  }
+  f.Close();
+
+  timer.Stop();
+  return timer.RealTime();
+}
+//____________________________________________________________________________
+double ReadFlat(string filename, string columns, double & checksum)
+{
+  TStopwatch timer;
+  timer.Start();
+
+  TFile f(filename.c_str(), "READ");
+  TTree * tree = dynamic_cast<TTree *> (f.Get("gtree"));
+  NtpMCFlatEvent * rec = new NtpMCFlatEvent;
+  rec->SetBranchAddresses(tree, columns);
+
+  checksum = 0;
+  Long64_t nev = tree->GetEntries();
+  for(Long64_t iev = 0; iev < nev; iev++) {
+    tree->GetEntry(iev);
+    for(int i = 0; i < rec->n; i++) {
+      checksum += rec->p4[4*i+3];
+    }
+  }
+  f.Close();
+  delete rec;
+
+  timer.Stop();
+  return timer.RealTime();
+}
+//____________________________________________________________________________
+Long64_t FileSize(string filename)
+{
+  TFile f(filename.c_str(), "READ");
+  Long64_t size = f.GetSize();
+  f.Close();
+  return size;
+}
+//____________________________________________________________________________
@@ -3,7 +3,10 @@
 
 \program gtestPDFLIB
 
-\brief   Test interface to PDFLIB library
+\brief   Test interface to PDFLIB library.
+         The PDFs are also computed with the PDFGrid model (a grid tabulated
+         from the same PDF set) and the largest differences and the time per
+         evaluation (single-point and batched) are reported.
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          STFC, Rutherford Appleton Laboratory
@@ -16,9 +19,12 @@
 */
 //____________________________________________________________________________
 
+#include <vector>
+
 #include <TNtuple.h>
 #include <TFile.h>
 #include <TMath.h>
+#include <TStopwatch.h>
 
 #include "Algorithm/AlgFactory.h"
 #include "Messenger/Messenger.h"
@@ -26,6 +32,8 @@
 #include "PDF/PDFLIB.h"
 #include "PDF/PDF.h"
 
+using std::vector;
+
 using namespace genie;
 
 //___________________________________________________________________
@@ -40,7 +48,8 @@ int main(int /*argc*/, char ** /*argv*/)
   const double dx_idx   = (xmax_idx-xmin_idx)/(nx-1);
 
   // Output ntuple
-  TNtuple * nt = new TNtuple("nt","pdfs","uv:dv:us:ds:s:g:x:Q2");
+  TNtuple * nt = new TNtuple("nt","pdfs",
+     "uv:dv:us:ds:s:g:x:Q2:uvg:dvg:usg:dsg:sg:gg");
 
   // PDF model
   AlgFactory * algf = AlgFactory::Instance();
@@ -48,10 +57,16 @@ int main(int /*argc*/, char ** /*argv*/)
         dynamic_cast<const PDFModelI *> (
                     algf->GetAlgorithm("genie::PDFLIB","GRVLO"));
   
+  const PDFModelI * gridmodel = 
+        dynamic_cast<const PDFModelI *> (
+                    algf->GetAlgorithm("genie::PDFGrid","Default"));
+
   PDF pdf;
   pdf.SetModel(pdfmodel);
 
   // Extract PDFs
+  vector<double> xv, Q2v;
+  double maxdiff = 0;
   for(int iq2 = 0; iq2 < nQ2; iq2++) {
     for(int ix = 0; ix < nx; ix++) {
 
@@ -61,15 +76,58 @@ int main(int /*argc*/, char ** /*argv*/)
       pdf.Calculate(x, Q2);
       LOG("test", pINFO) << "PDFs:\n" << pdf;
 
-      nt->Fill(pdf.UpValence(),
-               pdf.DownValence(),
-               pdf.UpSea(),
-               pdf.DownSea(),
-               pdf.Strange(),
-               pdf.Gluon(),
-               x, Q2);
+      PDF_t g = gridmodel->AllPDFs(x, Q2);
+
+      double lib [6] = { pdf.UpValence(), pdf.DownValence(), pdf.UpSea(),
+                         pdf.DownSea(),   pdf.Strange(),     pdf.Gluon() };
+      double grid[6] = { g.uval, g.dval, g.usea, g.dsea, g.str, g.gl };
+
+      float vars[14];
+      for(int k = 0; k < 6; k++) {
+        vars[k]   = lib [k];
+        vars[8+k] = grid[k];
+      }
+      vars[6] = x;
+      vars[7] = Q2;
+      nt->Fill(vars);
+
+      // differences relative to the largest PDF (the gluon, or the
+      // u valence at high x)
+      double norm = TMath::Max(pdf.Gluon(), pdf.UpValence());
+      if(norm > 0) {
+        for(int k = 0; k < 6; k++) {
+          maxdiff = TMath::Max(maxdiff, TMath::Abs(grid[k]-lib[k])/norm);
+        }
+      }
+      xv .push_back(x);
+      Q2v.push_back(Q2);
     }
   }
+
+  // timing
+  int np = xv.size();
+  vector<PDF_t> pdfv(np);
+  TStopwatch timer;
+  timer.Start();
+  for(int i = 0; i < np; i++) pdfv[i] = pdfmodel->AllPDFs(xv[i], Q2v[i]);
+  timer.Stop();
+  double tlib = timer.CpuTime();
+  timer.Start();
+  for(int i = 0; i < np; i++) pdfv[i] = gridmodel->AllPDFs(xv[i], Q2v[i]);
+  timer.Stop();
+  double tgrid = timer.CpuTime();
+  timer.Start();
+  gridmodel->AllPDFs(np, &xv[0], &Q2v[0], &pdfv[0]);
+  timer.Stop();
+  double tbatch = timer.CpuTime();
+
+  LOG("test", pNOTICE)
+     << "\n PDFGrid vs PDFLIB at " << np << " points:"
+     << "\n  max difference / max(g, uv) : " << maxdiff
+     << "\n  PDFLIB                : " << 1E6*tlib/np   << " usec / point"
+     << "\n  PDFGrid               : " << 1E6*tgrid/np  << " usec / point"
+     << "\n  PDFGrid (batched)     : " << 1E6*tbatch/np << " usec / point";
+
   TFile f("./genie-pdflib.root","recreate");
   nt->Write("pdflib");
 
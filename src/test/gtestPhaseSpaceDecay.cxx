@@ -0,0 +1,291 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestPhaseSpaceDecay
+
+\brief   Regression test and benchmark for the fast phase space decays used
+         in the KNO hadronization model (NBodyPhaseSpace generator and
+         tabulated phase space weights, see KNOHadronization).
+
+         1) Generates unweighted N-body decays (for a few sets of decay
+            products, at rest and in flight) with NBodyPhaseSpace and with
+            TGenPhaseSpace, and compares the average energy and pT^2 of each
+            decay product.
+         2) Hadronizes DIS final states at a few hadronic invariant masses,
+            with the KNO model using TGenPhaseSpace and 200 trial decays per
+            decay (PhaseSpDec-Fast = false) and using the fast phase space
+            decays (PhaseSpDec-Fast = true). Reports the hadronization rates
+            and compares the average multiplicity and the average hadron
+            pT^2 and xF.
+
+         The test exits with a non-zero status if any average differs by more
+         than the given number of standard deviations.
+
+         Syntax :
+           gtestPhaseSpaceDecay [-n nevents] [-t nsigma] [--seed seed]
+
+         Options :
+           -n  number of decays / hadronizations per configuration
+               (default: 5000)
+           -t  max difference in averages, in standard deviations (default: 5)
+           --seed  random number seed
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
+#include <TMCParticle.h>
+#else
+#include <TMCParticle6.h>
+#endif
+#include <TClonesArray.h>
+#include <TGenPhaseSpace.h>
+#include <TLorentzVector.h>
+#include <TMath.h>
+#include <TRandom.h>
+#include <TStopwatch.h>
+
+#include "Algorithm/AlgFactory.h"
+#include "Fragmentation/HadronizationModelI.h"
+#include "Fragmentation/NBodyPhaseSpace.h"
+#include "Interaction/InitialState.h"
+#include "Interaction/Interaction.h"
+#include "Interaction/ProcessInfo.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/RandomGen.h"
+#include "PDG/PDGCodes.h"
+#include "PDG/PDGLibrary.h"
+#include "Registry/Registry.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+// running average
+class Average {
+public:
+  Average() : fN(0), fSum(0), fSum2(0) { }
+  void   Fill  (double x)       { fN++; fSum += x; fSum2 += x*x; }
+  double Mean  (void)     const { return (fN>0) ? fSum/fN : 0; }
+  double Error (void)     const {
+    if(fN<2) return 0;
+    double m = this->Mean();
+    return TMath::Sqrt(TMath::Max(0., fSum2/fN - m*m) / (fN-1));
+  }
+private:
+  long   fN;
+  double fSum;
+  double fSum2;
+};
+
+int  TestGenerator   (int ndecays, double nsigma);
+int  TestKNO         (int nevents, double nsigma);
+bool Compare         (string what, const Average & a1, const Average & a2, double nsigma);
+const HadronizationModelI * GetKNO (bool fast);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  int    nev    = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : 5000;
+  double nsigma = (parser.OptionExists('t')) ? parser.ArgAsDouble('t') : 5.;
+  if(parser.OptionExists("seed")) {
+    RandomGen::Instance()->SetSeed(parser.ArgAsLong("seed"));
+  }
+
+  int nfail = 0;
+  nfail += TestGenerator (nev, nsigma);
+  nfail += TestKNO       (nev, nsigma);
+
+  LOG("test", pNOTICE) << nfail << " averages differ by more than "
+                       << nsigma << " standard deviations";
+
+  return (nfail == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+int TestGenerator(int ndecays, double nsigma)
+{
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  TRandom & rnd = RandomGen::Instance()->RndGen();
+
+  // decay products (deliberately not ordered by mass) & decaying system
+  const int kNDecays = 4;
+  const int kNMax    = 6;
+  const int kN   [kNDecays] = { 3, 4, 6, 6 };
+  const int kPdgc[kNDecays][kNMax] = {
+    { kPdgPiP,  kPdgProton, kPdgPiM                     },
+    { kPdgPi0,  kPdgKP,     kPdgNeutron, kPdgPiM        },
+    { kPdgPi0,  kPdgPiP,    kPdgPiM,     kPdgProton, kPdgPi0, kPdgPiP },
+    { kPdgPi0,  kPdgPiP,    kPdgPiM,     kPdgProton, kPdgPi0, kPdgPiP }
+  };
+  const double kW  [kNDecays] = { 1.6, 2.5, 3.0, 3.0 };
+  const double kPxy[kNDecays] = { 0.0, 0.0, 0.0, 0.4 }; // system pT (GeV)
+  const double kPz [kNDecays] = { 0.0, 0.0, 0.0, 1.0 }; // system pz (GeV)
+
+  NBodyPhaseSpace fast;
+  TGenPhaseSpace  root;
+
+  int nfail = 0;
+
+  for(int id = 0; id < kNDecays; id++) {
+    int n = kN[id];
+    double mass[kNMax];
+    for(int i = 0; i < n; i++) mass[i] = pdglib->Find(kPdgc[id][i])->Mass();
+
+    TLorentzVector p4;
+    p4.SetXYZM(kPxy[id], 0., kPz[id], kW[id]);
+
+    bool ok_fast = fast.SetDecay(p4, n, mass);
+    bool ok_root = root.SetDecay(p4, n, mass);
+    assert(ok_fast && ok_root);
+
+    // unweighted decays (both generators normalize the weights to <= 1)
+    vector<Average> E_fast(n), E_root(n), pT2_fast(n), pT2_root(n);
+    TStopwatch tfast, troot;
+
+    tfast.Start();
+    for(int idec = 0; idec < ndecays; idec++) {
+      while(rnd.Rndm() > fast.GenerateWeight()) { }
+      fast.GenerateMomenta();
+      for(int i = 0; i < n; i++) {
+        const TLorentzVector & p = fast.Decay(i);
+        E_fast  [i].Fill(p.Energy());
+        pT2_fast[i].Fill(p.Px()*p.Px() + p.Py()*p.Py());
+      }
+    }
+    tfast.Stop();
+
+    troot.Start();
+    for(int idec = 0; idec < ndecays; idec++) {
+      while(rnd.Rndm() > root.Generate()) { }
+      for(int i = 0; i < n; i++) {
+        TLorentzVector * p = root.GetDecay(i);
+        E_root  [i].Fill(p->Energy());
+        pT2_root[i].Fill(p->Px()*p->Px() + p->Py()*p->Py());
+      }
+    }
+    troot.Stop();
+
+    LOG("test", pNOTICE)
+      << "Decay " << id << " (N = " << n << ", W = " << kW[id] << " GeV)"
+      << " -- NBodyPhaseSpace: " << tfast.CpuTime() << " s"
+      << ", TGenPhaseSpace: " << troot.CpuTime() << " s";
+
+    for(int i = 0; i < n; i++) {
+      if(!Compare("E",   E_fast  [i], E_root  [i], nsigma)) nfail++;
+      if(!Compare("pT2", pT2_fast[i], pT2_root[i], nsigma)) nfail++;
+    }
+  }
+  return nfail;
+}
+//____________________________________________________________________________
+int TestKNO(int nevents, double nsigma)
+{
+  const HadronizationModelI * kno_root = GetKNO(false);
+  const HadronizationModelI * kno_fast = GetKNO(true);
+
+  InitialState init (26, 56, kPdgNuMu);
+  ProcessInfo  proc (kScDeepInelastic, kIntWeakCC);
+  Interaction  intr (init, proc);
+  intr.InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgProton);
+
+  const int    kNW = 5;
+  const double kW[kNW] = { 1.8, 2.5, 4.0, 8.0, 15.0 };
+
+  int nfail = 0;
+
+  for(int iw = 0; iw < kNW; iw++) {
+    intr.KinePtr()->SetW(kW[iw]);
+
+    Average mult[2], pT2[2], xF[2];
+    double  cpu [2];
+
+    for(int imod = 0; imod < 2; imod++) {
+      const HadronizationModelI * kno = (imod==0) ? kno_root : kno_fast;
+      TStopwatch timer;
+      timer.Start();
+      for(int iev = 0; iev < nevents; iev++) {
+        TClonesArray * plist = kno->Hadronize(&intr);
+        if(!plist) continue;
+        mult[imod].Fill(plist->GetEntries());
+        for(int i = 0; i < plist->GetEntries(); i++) {
+          TMCParticle * p = (TMCParticle *) (*plist)[i];
+          pT2[imod].Fill(p->GetPx()*p->GetPx() + p->GetPy()*p->GetPy());
+          xF [imod].Fill(p->GetPz() / (kW[iw]/2));
+        }
+        plist->Delete();
+        delete plist;
+      }
+      timer.Stop();
+      cpu[imod] = timer.CpuTime();
+    }
+
+    LOG("test", pNOTICE)
+      << "KNO @ W = " << kW[iw] << " GeV, " << nevents << " events"
+      << " -- TGenPhaseSpace: " << nevents/TMath::Max(cpu[0],1E-9) << " events/s"
+      << ", fast phase space: " << nevents/TMath::Max(cpu[1],1E-9) << " events/s"
+      << " (x " << cpu[0]/TMath::Max(cpu[1],1E-9) << ")";
+
+    if(!Compare("multiplicity", mult[0], mult[1], nsigma)) nfail++;
+    if(!Compare("hadron pT2",   pT2 [0], pT2 [1], nsigma)) nfail++;
+    if(!Compare("hadron xF",    xF  [0], xF  [1], nsigma)) nfail++;
+  }
+
+  delete kno_root;
+  delete kno_fast;
+
+  return nfail;
+}
+//____________________________________________________________________________
+bool Compare(
+  string what, const Average & a1, const Average & a2, double nsigma)
+{
+  double diff  = a1.Mean() - a2.Mean();
+  double error = TMath::Sqrt(TMath::Power(a1.Error(),2) + TMath::Power(a2.Error(),2));
+  bool   ok    = (TMath::Abs(diff) <= nsigma * error);
+
+  if(ok) {
+    LOG("test", pINFO)
+      << "<" << what << ">: " << a1.Mean() << " +/- " << a1.Error()
+      << " vs " << a2.Mean() << " +/- " << a2.Error();
+  } else {
+    LOG("test", pERROR)
+      << "<" << what << ">: " << a1.Mean() << " +/- " << a1.Error()
+      << " vs " << a2.Mean() << " +/- " << a2.Error() << " *** differ";
+  }
+  return ok;
+}
+//____________________________________________________________________________
+const HadronizationModelI * GetKNO(bool fast)
+{
+  AlgFactory * algf = AlgFactory::Instance();
+  Algorithm * alg = algf->AdoptAlgorithm("genie::KNOHadronization","Default");
+  assert(alg);
+
+  Registry r(alg->GetConfig());
+  r.UnLock();
+  r.Set("PhaseSpDec-Fast", fast);
+  alg->Configure(r);
+
+  const HadronizationModelI * kno =
+          dynamic_cast<const HadronizationModelI *> (alg);
+  assert(kno);
+  return kno;
+}
+//____________________________________________________________________________
@@ -0,0 +1,186 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestRandomStream
+
+\brief   Known-answer test for the counter-based random number streams
+         (see RandomStream and RandomGen).
+         1) Checks the Philox-4x32-10 block function against the published
+            Random123 known-answer vectors.
+         2) Checks that RandomStream::Rndm() returns the numbers built from
+            the Philox output for the (seed, run, stream id) key and the
+            (draw, event) counter, and that Skip() and SetEvent() reach the
+            same positions as drawing.
+         3) Checks that the position used before the first event (for the
+            draws made while configuring a job) differs from event 0.
+         Any change to the Philox rounds, keys or to the way the streams are
+         keyed would change every random number in GENIE and is reported.
+         The test exits with a non-zero status at any failure.
+
+         Syntax :
+           gtestRandomStream
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include "Conventions/Controls.h"
+#include "Messenger/Messenger.h"
+#include "Numerical/RandomGen.h"
+#include "Numerical/RandomStream.h"
+
+using namespace genie;
+using namespace genie::controls;
+
+int    TestKnownAnswers (void);
+int    TestStream       (void);
+int    TestPreRun       (void);
+double ToDouble         (UInt_t hi, UInt_t lo);
+
+//____________________________________________________________________________
+int main(int /*argc*/, char ** /*argv*/)
+{
+  int nfail = 0;
+  nfail += TestKnownAnswers ();
+  nfail += TestStream       ();
+  nfail += TestPreRun       ();
+
+  LOG("test", pNOTICE) << nfail << " random number stream checks failed";
+
+  return (nfail == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+int TestKnownAnswers(void)
+{
+// Random123 known-answer vectors for philox4x32 with 10 rounds:
+// counter (4 words), key (2 words) -> output (4 words)
+
+  const int kNVec = 3;
+  const UInt_t kCtr[kNVec][4] = {
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+    { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+    { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }
+  };
+  const UInt_t kKey[kNVec][2] = {
+    { 0x00000000, 0x00000000 },
+    { 0xffffffff, 0xffffffff },
+    { 0xa4093822, 0x299f31d0 }
+  };
+  const UInt_t kOut[kNVec][4] = {
+    { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 },
+    { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd },
+    { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }
+  };
+
+  int nfail = 0;
+  for(int iv = 0; iv < kNVec; iv++) {
+    UInt_t out[4];
+    RandomStream::Philox(kCtr[iv], kKey[iv], out);
+    bool ok = true;
+    for(int i = 0; i < 4; i++) ok = ok && (out[i] == kOut[iv][i]);
+    if(!ok) {
+      LOG("test", pERROR)
+        << "Philox-4x32-10 known-answer vector " << iv << " failed";
+      nfail++;
+    }
+  }
+  LOG("test", pNOTICE)
+    << "Philox-4x32-10 known-answer vectors: " << kNVec-nfail << " / "
+    << kNVec << " passed";
+  return nfail;
+}
+//____________________________________________________________________________
+int TestStream(void)
+{
+  const UInt_t       kSeed   = 1234567;
+  const Long_t       kRun    = 1000;
+  const Long64_t     kEvent  = 0x123456789LL;
+  const unsigned int kStream = kRndFsi;
+  const int          kNDraw  = 16;
+
+  int nfail = 0;
+
+  RandomStream rnd(kStream, kSeed);
+  rnd.SetEvent(kRun, kEvent);
+
+  // expected: 2 doubles per philox block, from 27+26 bits of each half
+  UInt_t key[2] = { kSeed, (UInt_t) ((kRun << 4) | kStream) };
+  double expected[kNDraw];
+  for(int iblock = 0; iblock < kNDraw/2; iblock++) {
+    UInt_t ctr[4] = { (UInt_t) iblock, 0,
+                      (UInt_t) (kEvent & 0xFFFFFFFF), (UInt_t) (kEvent >> 32) };
+    UInt_t out[4];
+    RandomStream::Philox(ctr, key, out);
+    expected[2*iblock  ] = ToDouble(out[0], out[1]);
+    expected[2*iblock+1] = ToDouble(out[2], out[3]);
+  }
+  for(int i = 0; i < kNDraw; i++) {
+    double r = rnd.Rndm();
+    if(r != expected[i]) {
+      LOG("test", pERROR)
+        << "Draw " << i << ": " << r << ", expected: " << expected[i];
+      nfail++;
+    }
+  }
+
+  // skip-ahead & re-positioning
+  RandomStream skip(kStream, kSeed);
+  skip.SetEvent(kRun, kEvent);
+  skip.Skip(kNDraw-3);
+  if(skip.Rndm() != expected[kNDraw-3]) {
+    LOG("test", pERROR) << "Skip() does not match drawing";
+    nfail++;
+  }
+  rnd.SetEvent(kRun, kEvent);
+  if(rnd.Rndm() != expected[0]) {
+    LOG("test", pERROR) << "SetEvent() does not restart the event";
+    nfail++;
+  }
+
+  LOG("test", pNOTICE)
+    << "RandomStream draws: " << ((nfail==0) ? "as expected" : "FAILED");
+  return nfail;
+}
+//____________________________________________________________________________
+int TestPreRun(void)
+{
+  int nfail = 0;
+
+  RandomStream prerun(kRndKine, kDefaultRandSeed);
+  RandomStream event0(kRndKine, kDefaultRandSeed);
+  event0.SetEvent(0, 0);
+
+  double r_prerun = prerun.Rndm();
+  double r_event0 = event0.Rndm();
+  if(prerun.Event() != kRndPreRunEvent || r_prerun == r_event0) {
+    LOG("test", pERROR)
+      << "Draws before the first event overlap with event 0";
+    nfail++;
+  }
+
+  event0.SetEvent(0, kRndPreRunEvent);
+  if(event0.Rndm() != r_prerun) {
+    LOG("test", pERROR)
+      << "SetEvent(run, kRndPreRunEvent) does not reach the pre-run position";
+    nfail++;
+  }
+
+  LOG("test", pNOTICE)
+    << "Pre-run stream position: " << ((nfail==0) ? "as expected" : "FAILED");
+  return nfail;
+}
+//____________________________________________________________________________
+double ToDouble(UInt_t hi, UInt_t lo)
+{
+// same as RandomStream::Rndm(), written independently
+
+  ULong64_t k = ( ((ULong64_t) (hi >> 5)) << 26 ) | (ULong64_t) (lo >> 6);
+  return (k + 0.5) / 9007199254740992.; // 2^53
+}
+//____________________________________________________________________________
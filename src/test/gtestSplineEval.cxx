@@ -0,0 +1,164 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestSplineEval
+
+\brief   Micro-benchmark for genie::Spline evaluation.
+         Compares the flat-table Spline::Evaluate() (single point and batch
+         version) against the TSpline3-based evaluation that Spline used to
+         do, both for timing and for the interpolated values.
+
+         Syntax :
+           gtestSplineEval [-n number_of_points]
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TSpline.h>
+#include <TStopwatch.h>
+
+#include "Messenger/Messenger.h"
+#include "Numerical/Spline.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+double LegacyEvaluate (const Spline & spl, double x);
+void   Benchmark      (const Spline & spl, string name, int n);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+  int n = 1000000;
+  if(parser.OptionExists('n')) {
+    n = parser.ArgAsInt('n');
+  }
+
+  const int nknots = 100;
+  double x[nknots], y[nknots];
+
+  // a total cross section -like spline: log-uniform knots, a threshold
+  // (first knots at zero) and rising with energy
+  double emin = 0.01;
+  double emax = 120.;
+  double dlog = (TMath::Log10(emax) - TMath::Log10(emin))/(nknots-1);
+  for(int i=0; i<nknots; i++) {
+    x[i] = TMath::Power(10., TMath::Log10(emin) + i*dlog);
+    y[i] = (x[i] < 0.03) ? 0. : x[i] * (1 - TMath::Exp(-(x[i]-0.03)));
+  }
+  Spline spl_log(nknots, x, y);
+
+  // same function on uniform knots
+  for(int i=0; i<nknots; i++) {
+    x[i] = emin + i*(emax-emin)/(nknots-1);
+    y[i] = (x[i] < 0.03) ? 0. : x[i] * (1 - TMath::Exp(-(x[i]-0.03)));
+  }
+  Spline spl_lin(nknots, x, y);
+
+  // same function on irregular knots (log-uniform + extra knots near
+  // threshold), as in splines made by gmkspl
+  vector<double> vx, vy;
+  for(int i=0; i<nknots; i++) {
+    double xi = TMath::Power(10., TMath::Log10(emin) + i*dlog);
+    vx.push_back(xi);
+    if(i < 20) vx.push_back(xi * (1 + 0.3*dlog));
+  }
+  for(unsigned int i=0; i<vx.size(); i++) {
+    vy.push_back( (vx[i] < 0.03) ? 0. : vx[i] * (1 - TMath::Exp(-(vx[i]-0.03))) );
+  }
+  Spline spl_irr((int)vx.size(), &vx[0], &vy[0]);
+
+  Benchmark(spl_log, "log-uniform knots", n);
+  Benchmark(spl_lin, "uniform knots",     n);
+  Benchmark(spl_irr, "irregular knots",   n);
+
+  return 0;
+}
+//____________________________________________________________________________
+void Benchmark(const Spline & spl, string name, int n)
+{
+  TRandom3 rnd(1234);
+
+  vector<double> x(n), y_legacy(n), y_scalar(n), y_batch(n);
+  double xmin = spl.XMin();
+  double xmax = spl.XMax();
+  for(int i=0; i<n; i++) {
+    x[i] = xmin + (xmax-xmin) * rnd.Rndm();
+  }
+
+  TStopwatch timer;
+
+  timer.Start();
+  for(int i=0; i<n; i++) y_legacy[i] = LegacyEvaluate(spl, x[i]);
+  timer.Stop();
+  double t_legacy = timer.CpuTime();
+
+  timer.Start();
+  for(int i=0; i<n; i++) y_scalar[i] = spl.Evaluate(x[i]);
+  timer.Stop();
+  double t_scalar = timer.CpuTime();
+
+  timer.Start();
+  spl.Evaluate(&x[0], &y_batch[0], n);
+  timer.Stop();
+  double t_batch = timer.CpuTime();
+
+  double maxdiff = 0;
+  bool   batch_ok = true;
+  for(int i=0; i<n; i++) {
+    double diff = TMath::Abs(y_scalar[i] - y_legacy[i]);
+    if(y_legacy[i] != 0) diff /= TMath::Abs(y_legacy[i]);
+    maxdiff  = TMath::Max(maxdiff, diff);
+    batch_ok = batch_ok && (y_batch[i] == y_scalar[i]);
+  }
+
+  LOG("test", pNOTICE)
+    << "\n Spline with " << spl.NKnots() << " " << name
+    << ", evaluated at " << n << " points:"
+    << "\n  TSpline3-based Evaluate(x)  : " << 1E+9*t_legacy/n << " ns/point"
+    << "\n  flat-table Evaluate(x)      : " << 1E+9*t_scalar/n << " ns/point"
+    << "\n  flat-table Evaluate(x,y,n)  : " << 1E+9*t_batch /n << " ns/point"
+    << "\n  max relative difference     : " << maxdiff
+    << "\n  batch == single point eval  : " << (batch_ok ? "yes" : "NO");
+}
+//____________________________________________________________________________
+double LegacyEvaluate(const Spline & spl, double x)
+{
+// Spline::Evaluate() as it was before the flat coefficient tables, except
+// for the fix in intervals whose right knot is zero
+
+  double y = 0;
+  if( spl.IsWithinValidRange(x) ) {
+    bool is0p = spl.ClosestKnotValueIsZero(x, "+");
+    bool is0n = spl.ClosestKnotValueIsZero(x, "-");
+    if(!is0p && !is0n) {
+      y = spl.GetAsTSpline()->Eval(x);
+    } else if(is0p && is0n) {
+      y = 0;
+    } else {
+      double xpknot=0, ypknot=0, xnknot=0, ynknot=0;
+      spl.FindClosestKnot(x, xnknot, ynknot, "-");
+      spl.FindClosestKnot(x, xpknot, ypknot, "+");
+      if(is0n) y = ypknot * (x-xnknot)/(xpknot-xnknot);
+      else     y = ynknot * (xpknot-x)/(xpknot-xnknot);
+    }
+  }
+  return y;
+}
+//____________________________________________________________________________
@@ -0,0 +1,194 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestSplineIO
+
+\brief   Regression test for reading genie::Spline objects back from a ROOT
+         file (the flat evaluation tables of Spline are not persistent and
+         are rebuilt by Spline::Streamer()).
+         Writes a few splines, both directly and as part of a CacheBranchFx
+         (as in the cache file used with --cache-file), reads them back and
+         checks that the knots and the values evaluated at random points are
+         identical to those of the original splines. Also checks that the
+         knots are returned as input, including knots so close to zero that
+         the evaluation treats them as zero, and that EvaluateNonZeroInterval()
+         matches 'ClosestKnotValueIsZero(x,"-") ? 0 : Evaluate(x)' between
+         the knots.
+         The test exits with a non-zero status at any difference.
+
+         Syntax :
+           gtestSplineIO [-n number_of_points] [-f filename]
+
+         Options :
+           -n  number of points at which splines are compared (default: 10000)
+           -f  name of the temporary ROOT file (default: gtestSplineIO.root)
+
+\author  agent <agent \at local>
+
+\created October 17, 2026
+
+\cpright Copyright (c) 2003-2013, GENIE Neutrino MC Generator Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <string>
+#include <vector>
+
+#include <TFile.h>
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include "Messenger/Messenger.h"
+#include "Numerical/Spline.h"
+#include "Utils/CacheBranchFx.h"
+#include "Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+int  Compare (const Spline & spl, const Spline & spl_read, string name,
+              const vector<double> & x, const vector<double> & y, int n);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  CmdLnArgParser parser(argc,argv);
+
+  int    n        = (parser.OptionExists('n')) ? parser.ArgAsInt('n')    : 10000;
+  string filename = (parser.OptionExists('f')) ? parser.ArgAsString('f') : "gtestSplineIO.root";
+
+  const int kNSpl   = 3;
+  const int nknots  = 100;
+  const string kName[kNSpl] = {
+     "log-uniform knots", "uniform knots", "irregular knots" };
+  const string kKey [kNSpl] = { "spl0", "spl1", "spl2" };
+
+  // a total cross section -like spline: a threshold (first knots at zero,
+  // or numerically zero) and rising with energy
+  double emin = 0.01;
+  double emax = 120.;
+  double dlog = (TMath::Log10(emax) - TMath::Log10(emin))/(nknots-1);
+
+  vector<double> x[kNSpl], y[kNSpl];
+  for(int i=0; i<nknots; i++) {
+    x[0].push_back(TMath::Power(10., TMath::Log10(emin) + i*dlog));
+    x[1].push_back(emin + i*(emax-emin)/(nknots-1));
+    x[2].push_back(TMath::Power(10., TMath::Log10(emin) + i*dlog));
+    if(i < 20) x[2].push_back(x[2].back() * (1 + 0.3*dlog));
+  }
+  for(int ispl=0; ispl<kNSpl; ispl++) {
+    for(unsigned int i=0; i<x[ispl].size(); i++) {
+      double xi = x[ispl][i];
+      double yi = (xi < 0.03) ? 0. : xi * (1 - TMath::Exp(-(xi-0.03)));
+      if(i == 1) yi = 1E-20;
+      y[ispl].push_back(yi);
+    }
+  }
+
+  // write out the splines & a cache branch
+  {
+    TFile f(filename.c_str(), "RECREATE");
+    for(int ispl=0; ispl<kNSpl; ispl++) {
+      Spline spl((int)x[ispl].size(), &x[ispl][0], &y[ispl][0]);
+      spl.Write(kKey[ispl].c_str());
+    }
+    CacheBranchFx branch("test");
+    for(unsigned int i=0; i<x[0].size(); i++) branch.AddValues(x[0][i], y[0][i]);
+    branch.CreateSpline();
+    branch.Write("branch");
+    f.Close();
+  }
+
+  // read them back and compare with the original splines
+  int nfail = 0;
+
+  TFile f(filename.c_str(), "READ");
+  for(int ispl=0; ispl<kNSpl; ispl++) {
+    Spline spl((int)x[ispl].size(), &x[ispl][0], &y[ispl][0]);
+    Spline * spl_read = (Spline *) f.Get(kKey[ispl].c_str());
+    if(!spl_read) {
+      LOG("test", pERROR) << "Couldn't read spline " << ispl;
+      nfail++;
+      continue;
+    }
+    nfail += Compare(spl, *spl_read, kName[ispl], x[ispl], y[ispl], n);
+    delete spl_read;
+  }
+
+  CacheBranchFx * branch_read = (CacheBranchFx *) f.Get("branch");
+  if(!branch_read || !branch_read->Spl()) {
+    LOG("test", pERROR) << "Couldn't read the cache branch spline";
+    nfail++;
+  } else {
+    Spline spl((int)x[0].size(), &x[0][0], &y[0][0]);
+    nfail += Compare(spl, *branch_read->Spl(), "cache branch", x[0], y[0], n);
+  }
+  delete branch_read;
+  f.Close();
+
+  LOG("test", pNOTICE) << nfail << " spline I/O checks failed";
+
+  return (nfail == 0) ? 0 : 1;
+}
+//____________________________________________________________________________
+int Compare(
+   const Spline & spl, const Spline & spl_read, string name,
+   const vector<double> & x, const vector<double> & y, int n)
+{
+  int nfail = 0;
+
+  // knots, as input
+  if(spl_read.NKnots() != (int)x.size() ||
+     spl_read.XMin() != spl.XMin() || spl_read.XMax() != spl.XMax()) {
+    LOG("test", pERROR) << name << ": spline range / knots differ";
+    return 1;
+  }
+  for(unsigned int i=0; i<x.size(); i++) {
+    double xk=0, yk=0;
+    spl_read.GetKnot(i, xk, yk);
+    if(xk != x[i] || yk != y[i] || spl.GetKnotY(i) != y[i]) {
+      LOG("test", pERROR)
+        << name << ": knot " << i << " = (" << xk << ", " << yk << ")"
+        << ", input: (" << x[i] << ", " << y[i] << ")";
+      nfail++;
+    }
+  }
+
+  // evaluated values, at the knots & at random points
+  TRandom3 rnd(1234);
+  vector<double> xe(x);
+  for(int i=0; i<n; i++) {
+    xe.push_back(spl.XMin() + (spl.XMax()-spl.XMin()) * rnd.Rndm());
+  }
+  vector<double> ye(xe.size()), ye_read(xe.size());
+  spl_read.Evaluate(&xe[0], &ye_read[0], (int)xe.size());
+  for(unsigned int i=0; i<xe.size(); i++) {
+    ye[i] = spl.Evaluate(xe[i]);
+    if(ye[i] != ye_read[i] || ye[i] != spl_read.Evaluate(xe[i])) {
+      LOG("test", pERROR)
+        << name << ": y(x = " << xe[i] << ") = " << ye_read[i]
+        << ", expected: " << ye[i];
+      nfail++;
+    }
+    // (TSpline3::FindX() takes a knot to belong to the interval below it)
+    if(i < x.size()) continue;
+    double ynz = (spl.ClosestKnotValueIsZero(xe[i],"-")) ? 0. : ye[i];
+    if(spl_read.EvaluateNonZeroInterval(xe[i]) != ynz) {
+      LOG("test", pERROR)
+        << name << ": y(x = " << xe[i] << ") excl. zero-knot intervals = " 
+        << spl_read.EvaluateNonZeroInterval(xe[i]) << ", expected: " << ynz;
+      nfail++;
+    }
+  }
+
+  LOG("test", pNOTICE)
+    << name << ": " << spl_read.NKnots() << " knots, "
+    << xe.size() << " points compared, " << nfail << " differences";
+
+  return nfail;
+}
+//____________________________________________________________________________